@@ -33,6 +33,7 @@
 #include "random.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 #include "util_driver.hpp"
 
 #include "../test/verify.hpp"
@@ -144,18 +145,14 @@ public:
     int VerifyForward() override;
 
     Timer t;
-    double fulltime;
-    float lowtime;
-    float avgtime;
-    float time;
+    TimingStats wall_timing;
+    TimingStats kernel_timing;
     int iters;
 
     void initTiming()
     {
-        fulltime = 0.;
-        lowtime  = 100000000.0;
-        avgtime  = 0.;
-        time     = 0.0;
+        wall_timing   = {};
+        kernel_timing = {};
         return;
     }
 
@@ -165,28 +162,20 @@ public:
         return;
     }
 
-    void finishTiming(int i)
+    void finishTiming()
     {
         if(inflags.GetValueStr("time") == "1")
         {
-            time = 0.0;
+            float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
-            lowtime = (time < lowtime) ? time : lowtime;
-            if(iters > 1 && i > 0)
-                avgtime += time;
+            kernel_timing.Add(time);
         }
 
         miopen::deref(GetHandle()).Finish();
         STOP_TIME
 
         if(WALL_CLOCK)
-        {
-            if(iters > 1 && i > 0)
-                fulltime += t.gettime_ms();
-            else if(iters == 1)
-                fulltime = t.gettime_ms();
-            // else do nothing, drop the first iteration
-        }
+            wall_timing.Add(t.gettime_ms());
         return;
     }
 
@@ -741,7 +730,7 @@ void CBAInferFusionDriver<Tgpu, Tref>::runGPUBatchNormActivInference()
                                 outputTensor,
                                 out_dev->GetMem(),
                                 fusionArgs);
-        finishTiming(it);
+        finishTiming();
     }
 }
 
@@ -824,7 +813,7 @@ void CBAInferFusionDriver<Tgpu, Tref>::runGPUConvBatchNormActivInference()
                                 outputTensor,
                                 out_dev->GetMem(),
                                 fusionArgs);
-        finishTiming(it);
+        finishTiming();
     }
 }
 
@@ -881,7 +870,7 @@ void CBAInferFusionDriver<Tgpu, Tref>::runGPUConvActivInference()
                                 outputTensor,
                                 out_dev->GetMem(),
                                 fusionArgs);
-        finishTiming(it);
+        finishTiming();
     }
 }
 
@@ -993,7 +982,7 @@ void CBAInferFusionDriver<Tgpu, Tref>::runGPUFusedConvBiasInference()
                                 outputTensor,
                                 out_dev->GetMem(),
                                 fusionArgs);
-        finishTiming(it);
+        finishTiming();
     }
 }
 
@@ -1028,19 +1017,19 @@ int CBAInferFusionDriver<Tgpu, Tref>::RunForwardGPU()
 
     if(WALL_CLOCK)
     {
-        printf("Wall-clock Time Elapsed: %f ms, for %d iterations.\n",
-               (iters == 1) ? t.gettime_ms() : (fulltime / float(iters - 1)),
-               (iters > 1) ? iters - 1 : 1);
+        const auto wall = wall_timing.Summarize();
+        printf("Wall-clock Time Elapsed: %f ms, for %zu iterations.\n", wall.mean, wall.samples);
     }
 
     if(inflags.GetValueStr("time") == "1")
     {
-        printf("GPU Fused Kernel Min Time Elapsed: %f ms\n", lowtime);
+        const auto kernel = kernel_timing.Summarize();
+        printf("GPU Fused Kernel Min Time Elapsed: %f ms\n", kernel.min);
         if(iters > 1)
-            printf("GPU Fused Kernel Avg Time Elapsed: %f ms, for %d "
+            printf("GPU Fused Kernel Avg Time Elapsed: %f ms, for %zu "
                    "iterations.\n",
-                   avgtime / (iters - 1),
-                   iters - 1);
+                   kernel.mean,
+                   kernel.samples);
     }
 
     out_dev->FromGPU(GetStream(), out.data());
@@ -217,6 +217,13 @@ void InputFlags::StoreOptionalFlagValue(char short_name, const std::string& inpu
     }
 }
 
+bool InputFlags::HasFlag(const std::string& long_name) const
+{
+    return std::any_of(MapInputs.begin(), MapInputs.end(), [&](const auto& content) {
+        return content.second.long_name == long_name;
+    });
+}
+
 std::string InputFlags::GetValueStr(const std::string& long_name) const
 {
     char short_name   = FindShortName(long_name);
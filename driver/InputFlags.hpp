@@ -102,6 +102,7 @@ public:
 
     void Parse(int argc, char* argv[]);
     char FindShortName(const std::string& _long_name) const;
+    bool HasFlag(const std::string& long_name) const;
     [[noreturn]] void Print() const;
 
     std::string GetValueStr(const std::string& _long_name) const;
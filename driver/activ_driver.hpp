@@ -32,6 +32,7 @@
 #include "random.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 #include "util_driver.hpp"
 
 #include <miopen/miopen.h>
@@ -295,11 +296,10 @@ int ActivationDriver<Tgpu, Tref>::RunForwardGPU()
 {
 
     float alpha = 1, beta = 0;
-    double fulltime = 0.;
-    float avgtime   = 0.0f;
-    float lowtime   = 100000000.0f;
-    int iters       = inflags.GetValueInt("iter");
+    int iters = inflags.GetValueInt("iter");
     Timer t;
+    TimingStats wall_timing;
+    TimingStats kernel_timing;
 
     for(int i = 0; i < iters; i++)
     {
@@ -317,38 +317,32 @@ int ActivationDriver<Tgpu, Tref>::RunForwardGPU()
         miopen::deref(GetHandle()).Finish();
         STOP_TIME
         if(WALL_CLOCK)
-        {
-            if(iters > 1 && i > 0)
-                fulltime += t.gettime_ms();
-            else if(iters == 1)
-                fulltime = t.gettime_ms();
-            // else do nothing, drop the first iteration
-        }
+            wall_timing.Add(t.gettime_ms());
 
         if(inflags.GetValueInt("time") == 1)
         {
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
-            lowtime = (time < lowtime) ? time : lowtime;
-            if(iters > 1 && i > 0)
-                avgtime += time;
+            kernel_timing.Add(time);
         }
     }
 
     if(WALL_CLOCK)
     {
-        printf("Wall-clock Time Forward GPU Activation Elapsed: %f ms, for %d iterations.\n",
-               (iters == 1) ? t.gettime_ms() : (fulltime / float(iters - 1)),
-               (iters > 1) ? iters - 1 : 1);
+        const auto wall = wall_timing.Summarize();
+        printf("Wall-clock Time Forward GPU Activation Elapsed: %f ms, for %zu iterations.\n",
+               wall.mean,
+               wall.samples);
     }
 
     if(inflags.GetValueInt("time") == 1)
     {
-        printf("GPU Kernel Min Time Forward Activation Elapsed: %f ms\n", lowtime);
+        const auto kernel = kernel_timing.Summarize();
+        printf("GPU Kernel Min Time Forward Activation Elapsed: %f ms\n", kernel.min);
         if(iters > 1)
-            printf("GPU Kernel Avg Time Forward Activation Elapsed: %f ms, for %d iterations.\n",
-                   avgtime / (iters - 1),
-                   iters - 1);
+            printf("GPU Kernel Avg Time Forward Activation Elapsed: %f ms, for %zu iterations.\n",
+                   kernel.mean,
+                   kernel.samples);
         int in_n, in_c, in_h, in_w;
         std::tie(in_n, in_c, in_h, in_w) = miopen::tien<4>(miopen::deref(inputTensor).GetLengths());
         size_t dataSz =
@@ -359,8 +353,8 @@ int ActivationDriver<Tgpu, Tref>::RunForwardGPU()
         printf("stats: fwd-activ, %zu, %zu, %f, %f\n",
                dataSz,
                dataSz,
-               2 * dataSz / lowtime / 1e6,
-               avgtime / (iters - 1));
+               2 * dataSz / kernel.min / 1e6,
+               kernel.mean);
     }
 
     out_dev->FromGPU(GetStream(), out.data());
@@ -377,11 +371,10 @@ template <typename Tgpu, typename Tref>
 int ActivationDriver<Tgpu, Tref>::RunBackwardGPU()
 {
     float alpha = 1, beta = 0;
-    double fulltime = 0.;
-    float avgtime   = 0.0f;
-    float lowtime   = 100000000.0f;
-    int iters       = inflags.GetValueInt("iter");
+    int iters = inflags.GetValueInt("iter");
     Timer t;
+    TimingStats wall_timing;
+    TimingStats kernel_timing;
 
     for(int i = 0; i < iters; i++)
     {
@@ -403,38 +396,32 @@ int ActivationDriver<Tgpu, Tref>::RunBackwardGPU()
         miopen::deref(GetHandle()).Finish();
         STOP_TIME
         if(WALL_CLOCK)
-        {
-            if(iters > 1 && i > 0)
-                fulltime += t.gettime_ms();
-            else if(iters == 1)
-                fulltime = t.gettime_ms();
-            // else do nothing, drop the first iteration
-        }
+            wall_timing.Add(t.gettime_ms());
 
         if(inflags.GetValueInt("time") == 1)
         {
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
-            lowtime = (time < lowtime) ? time : lowtime;
-            if(iters > 1 && i > 0)
-                avgtime += time;
+            kernel_timing.Add(time);
         }
     }
 
     if(WALL_CLOCK)
     {
-        printf("Wall-clock Time Backward GPU Activation Elapsed: %f ms, for %d iterations.\n",
-               (iters == 1) ? t.gettime_ms() : (fulltime / float(iters - 1)),
-               (iters > 1) ? iters - 1 : 1);
+        const auto wall = wall_timing.Summarize();
+        printf("Wall-clock Time Backward GPU Activation Elapsed: %f ms, for %zu iterations.\n",
+               wall.mean,
+               wall.samples);
     }
 
     if(inflags.GetValueInt("time") == 1)
     {
-        printf("GPU Kernel Min Time Backward Activation Elapsed: %f ms\n", lowtime);
+        const auto kernel = kernel_timing.Summarize();
+        printf("GPU Kernel Min Time Backward Activation Elapsed: %f ms\n", kernel.min);
         if(iters > 1)
-            printf("GPU Kernel Avg Time Backward Activation Elapsed: %f ms, for %d iterations.\n",
-                   avgtime / (iters - 1),
-                   iters - 1);
+            printf("GPU Kernel Avg Time Backward Activation Elapsed: %f ms, for %zu iterations.\n",
+                   kernel.mean,
+                   kernel.samples);
         int in_n, in_c, in_h, in_w;
         std::tie(in_n, in_c, in_h, in_w) = miopen::tien<4>(miopen::deref(inputTensor).GetLengths());
         size_t dataSz =
@@ -445,8 +432,8 @@ int ActivationDriver<Tgpu, Tref>::RunBackwardGPU()
         printf("stats: bwd-activ, %zu, %zu, %f, %f\n",
                dataSz,
                dataSz,
-               2 * dataSz / lowtime / 1e6,
-               avgtime / (iters - 1));
+               2 * dataSz / kernel.min / 1e6,
+               kernel.mean);
     }
 
     din_dev->FromGPU(GetStream(), din.data());
@@ -33,6 +33,7 @@
 #include "random.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 #include <algorithm>
 #include <cfloat>
 #include <cstdlib>
@@ -355,8 +356,7 @@ int AddLayerNormDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
 template <typename Tgpu, typename Tref>
 int AddLayerNormDriver<Tgpu, Tref>::RunForwardGPU()
 {
-    float kernel_total_time = 0.0;
-    float kernel_first_time = 0.0;
+    TimingStats kernel_timing;
 
     Timer t;
     START_TIME
@@ -384,9 +384,7 @@ int AddLayerNormDriver<Tgpu, Tref>::RunForwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
-        kernel_total_time += time;
-        if(i == 0)
-            kernel_first_time = time;
+        kernel_timing.Add(time);
     }
 
     if(inflags.GetValueInt("time") == 1)
@@ -397,8 +395,7 @@ int AddLayerNormDriver<Tgpu, Tref>::RunForwardGPU()
             std::cout << "Wall-clock Time Forward AddLayerNorm Elapsed: " << t.gettime_ms() / iter
                       << " ms\n";
 
-        float kernel_average_time =
-            iter > 1 ? (kernel_total_time - kernel_first_time) / (iter - 1) : kernel_first_time;
+        const auto kernel_average_time = kernel_timing.Summarize().mean;
         std::cout << "GPU Kernel Time Forward AddLayerNorm Elapsed: " << kernel_average_time
                   << " ms\n";
     }
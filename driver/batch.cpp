@@ -0,0 +1,350 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "batch.hpp"
+#include "InputFlags.hpp"
+#include "random.hpp"
+#include "registry_driver_maker.hpp"
+
+#include <miopen/stringutils.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+struct BatchEntry
+{
+    std::size_t line;
+    std::string command;
+};
+
+struct BatchResult
+{
+    const BatchEntry* entry;
+    std::string status;
+    int rc = 0;
+    DriverRunTimes times;
+    double total_ms = 0.0;
+};
+
+/// Blank lines and lines starting with '#' are skipped.
+std::vector<BatchEntry> ReadBatch(std::istream& is)
+{
+    std::vector<BatchEntry> entries;
+    std::string line;
+    for(std::size_t number = 1; std::getline(is, line); ++number)
+    {
+        const auto first = line.find_first_not_of(" \t\r");
+        if(first == std::string::npos || line[first] == '#')
+            continue;
+        const auto last = line.find_last_not_of(" \t\r");
+        entries.push_back({number, line.substr(first, last - first + 1)});
+    }
+    return entries;
+}
+
+/// Also accepts the lines logged with MIOPEN_ENABLE_LOGGING_CMD, which start with the
+/// path of the driver.
+std::vector<std::string> SplitCommand(const std::string& command)
+{
+    std::istringstream ss(command);
+    std::vector<std::string> tokens;
+    for(std::string token; ss >> token;)
+        tokens.push_back(token);
+    if(!tokens.empty() && (miopen::EndsWith(tokens.front(), "MIOpenDriver") ||
+                           miopen::EndsWith(tokens.front(), "MIOpenDriver.exe")))
+        tokens.erase(tokens.begin());
+    return tokens;
+}
+
+std::string JsonEscape(const std::string& str)
+{
+    std::ostringstream ss;
+    for(const auto c : str)
+    {
+        switch(c)
+        {
+        case '"': ss << "\\\""; break;
+        case '\\': ss << "\\\\"; break;
+        case '\t': ss << "\\t"; break;
+        default:
+            if(static_cast<unsigned char>(c) < 0x20)
+                ss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int{c}
+                   << std::dec;
+            else
+                ss << c;
+        }
+    }
+    return ss.str();
+}
+
+void WriteOptional(std::ostream& os, const std::optional<float>& value)
+{
+    if(value)
+        os << *value;
+    else
+        os << "null";
+}
+
+void WriteResult(std::ostream& os, const BatchResult& result)
+{
+    os << std::fixed << std::setprecision(3) << "{\"line\": " << result.entry->line
+       << ", \"command\": \"" << JsonEscape(result.entry->command) << "\", \"status\": \""
+       << JsonEscape(result.status) << "\", \"rc\": " << result.rc
+       << ", \"setup_ms\": " << result.times.setup_ms << ", \"run_ms\": " << result.times.run_ms
+       << ", \"forward_kernel_ms\": ";
+    WriteOptional(os, result.times.forward_kernel_ms);
+    os << ", \"backward_kernel_ms\": ";
+    WriteOptional(os, result.times.backward_kernel_ms);
+    os << ", \"total_ms\": " << result.total_ms << "}" << std::endl;
+}
+
+BatchResult RunEntry(const BatchEntry& entry)
+{
+    BatchResult result{&entry};
+    const auto start = Clock::now();
+    // Each configuration gets the same data as when it is run on its own.
+    prng::reset_seed();
+
+    auto args = SplitCommand(entry.command);
+    const auto drv = args.empty() ? nullptr : MakeDriver(args.front());
+    if(drv == nullptr)
+    {
+        result.status = "unknown driver";
+        result.rc     = -1;
+        return result;
+    }
+
+    std::cout << "MIOpenDriver " << entry.command << std::endl;
+
+    args.insert(args.begin(), "MIOpenDriver");
+    std::vector<char*> argv;
+    for(auto& arg : args)
+        argv.push_back(arg.data());
+    argv.push_back(nullptr);
+
+    try
+    {
+        result.rc = RunDriver(
+            *drv, args[1], static_cast<int>(args.size()), argv.data(), &result.times);
+        result.status = result.rc == 0 ? "ok" : "failed";
+    }
+    catch(const std::exception& ex)
+    {
+        result.status = std::string{"exception: "} + ex.what();
+        result.rc     = -1;
+    }
+
+    // The drivers enable profiling for timing, do not let it leak into the next configuration.
+    miopenEnableProfiling(drv->GetHandle(), false);
+    result.total_ms = ElapsedMs(start);
+    return result;
+}
+
+} // namespace
+
+std::unique_ptr<Driver> MakeDriver(const std::string& base_arg)
+{
+    for(auto f : rdm::GetRegistry())
+    {
+        if(auto* const drv = f(base_arg))
+            return std::unique_ptr<Driver>{drv};
+    }
+    return nullptr;
+}
+
+int RunDriver(Driver& drv, const std::string& base_arg, int argc, char* argv[], DriverRunTimes* times)
+{
+    const auto setup_start = Clock::now();
+    drv.AddCmdLineArgs();
+    int rc = drv.ParseCmdLineArgs(argc, argv);
+    if(rc != 0)
+    {
+        std::cout << "ParseCmdLineArgs() FAILED, rc = " << rc << std::endl;
+        return rc;
+    }
+    drv.GetandSetData();
+    rc = drv.AllocateBuffersAndCopy();
+    if(rc != 0)
+    {
+        std::cout << "AllocateBuffersAndCopy() FAILED, rc = " << rc << std::endl;
+        return rc;
+    }
+    if(times != nullptr)
+        times->setup_ms = ElapsedMs(setup_start);
+
+    const auto run_start = Clock::now();
+    int fargval =
+        !miopen::StartsWith(base_arg, "CBAInfer") ? drv.GetInputFlags().GetValueInt("forw") : 1;
+    bool bnFwdInVer   = (fargval == 2 && miopen::StartsWith(base_arg, "bnorm"));
+    bool verifyarg    = (drv.GetInputFlags().GetValueInt("verify") == 1);
+    bool timed =
+        drv.GetInputFlags().HasFlag("time") && drv.GetInputFlags().GetValueInt("time") != 0;
+    int cumulative_rc = 0; // Do not stop running tests in case of errors.
+
+    // The drivers read the kernel time right after their timed runs, so it is still there.
+    const auto kernel_time = [&]() -> std::optional<float> {
+        float time = 0.0f;
+        if(!timed || miopenGetKernelTime(drv.GetHandle(), &time) != miopenStatusSuccess)
+            return std::nullopt;
+        return time;
+    };
+
+    if(fargval & 1 || fargval == 0 || bnFwdInVer)
+    {
+        rc = drv.RunForwardGPU();
+        cumulative_rc |= rc;
+        if(times != nullptr)
+            times->forward_kernel_ms = kernel_time();
+        if(rc != 0)
+            std::cout << "RunForwardGPU() FAILED, rc = "
+                      << "0x" << std::hex << rc << std::dec << std::endl;
+        if(verifyarg) // Verify even if Run() failed.
+            cumulative_rc |= drv.VerifyForward();
+    }
+
+    if(fargval != 1)
+    {
+        rc = drv.RunBackwardGPU();
+        cumulative_rc |= rc;
+        if(times != nullptr)
+            times->backward_kernel_ms = kernel_time();
+        if(rc != 0)
+            std::cout << "RunBackwardGPU() FAILED, rc = "
+                      << "0x" << std::hex << rc << std::dec << std::endl;
+        if(verifyarg) // Verify even if Run() failed.
+            cumulative_rc |= drv.VerifyBackward();
+    }
+
+    if(times != nullptr)
+        times->run_ms = ElapsedMs(run_start);
+    return cumulative_rc;
+}
+
+int RunBatch(int argc, char* argv[])
+{
+    InputFlags flags;
+    flags.AddInputFlag(
+        "input", 'i', "-", "File with driver command lines, one per line (- for stdin)", "string");
+    flags.AddInputFlag("output",
+                       'o',
+                       "batch_results.jsonl",
+                       "File to write one JSON line per configuration to",
+                       "string");
+    flags.AddInputFlag("streams",
+                       's',
+                       "1",
+                       "Number of streams, each with its own handle, running independent "
+                       "configurations concurrently",
+                       "int");
+    flags.Parse(argc, argv);
+
+    std::vector<BatchEntry> entries;
+    const auto input = flags.GetValueStr("input");
+    if(input == "-")
+    {
+        entries = ReadBatch(std::cin);
+    }
+    else
+    {
+        std::ifstream file(input);
+        if(!file)
+        {
+            std::cout << "Unable to open batch input file: " << input << std::endl;
+            return 1;
+        }
+        entries = ReadBatch(file);
+    }
+
+    // The drivers print to stdout, so the results written there could not be parsed.
+    const auto output = flags.GetValueStr("output");
+    if(output == "-")
+    {
+        std::cout << "Batch results can't be written to stdout, use a file" << std::endl;
+        return 1;
+    }
+    std::ofstream results(output);
+    if(!results)
+    {
+        std::cout << "Unable to open batch output file: " << output << std::endl;
+        return 1;
+    }
+
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> failed{0};
+    std::mutex results_mutex;
+
+    // Each worker keeps one handle for all of its configurations, so that the kernels
+    // and invokers found for a configuration are reused by the next ones.
+    const auto worker = [&]() {
+        auto& handle = SharedDriverHandle();
+        handle       = CreateDriverHandle();
+        for(auto i = next++; i < entries.size(); i = next++)
+        {
+            const auto result = RunEntry(entries[i]);
+            if(result.rc != 0)
+                ++failed;
+            std::lock_guard<std::mutex> lock(results_mutex);
+            WriteResult(results, result);
+        }
+        miopenDestroy(handle);
+        handle = nullptr;
+    };
+
+    const auto streams = std::max(flags.GetValueInt("streams"), 1);
+    if(streams == 1)
+    {
+        worker();
+    }
+    else
+    {
+        std::vector<std::thread> threads;
+        for(int i = 0; i < streams; ++i)
+            threads.emplace_back(worker);
+        for(auto& thread : threads)
+            thread.join();
+    }
+
+    std::cout << "Batch: " << entries.size() << " configurations, " << failed << " failed"
+              << std::endl;
+    return failed == 0 ? 0 : 1;
+}
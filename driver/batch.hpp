@@ -0,0 +1,59 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_DRIVER_BATCH_HPP
+#define GUARD_MIOPEN_DRIVER_BATCH_HPP
+
+#include "driver.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+
+struct DriverRunTimes
+{
+    double setup_ms = 0.0; ///< Parsing, data generation and buffer allocation.
+    double run_ms   = 0.0; ///< Forward and backward runs, including verification.
+    /// Kernel time of the last primitive each direction timed, when the driver ran with -t 1.
+    std::optional<float> forward_kernel_ms;
+    std::optional<float> backward_kernel_ms;
+};
+
+/// Instantiates the driver registered for the base argument, nullptr if there is none.
+std::unique_ptr<Driver> MakeDriver(const std::string& base_arg);
+
+/// Runs the configuration given by the command line with the driver.
+/// Returns 0 on success.
+int RunDriver(Driver& drv,
+              const std::string& base_arg,
+              int argc,
+              char* argv[],
+              DriverRunTimes* times = nullptr);
+
+/// Runs the driver command lines read from a file or stdin in this process, writing
+/// one JSON line with the result of each of them.
+int RunBatch(int argc, char* argv[]);
+
+#endif // GUARD_MIOPEN_DRIVER_BATCH_HPP
@@ -32,6 +32,7 @@
 #include "random.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 #include "util_driver.hpp"
 #include "rocrand_wrapper.hpp"
 
@@ -783,10 +784,9 @@ int BatchNormDriver<TInput, Tref, TAcc, TScaleBias, TOut>::RunForwardGPU()
     Tref eAF     = static_cast<Tref>(1.0);
 
     Timer t;
-    double fulltime = 0.;
-    auto iters      = inflags.GetValueInt("iter");
-    float lowtime   = 100000000.0;
-    float avgtime   = 0.;
+    TimingStats wall_timing;
+    TimingStats kernel_timing;
+    auto iters = inflags.GetValueInt("iter");
 
     for(int i = 0; i < iters; i++)
     {
@@ -817,39 +817,33 @@ int BatchNormDriver<TInput, Tref, TAcc, TScaleBias, TOut>::RunForwardGPU()
         miopen::deref(GetHandle()).Finish();
         STOP_TIME
         if(WALL_CLOCK)
-        {
-            if(iters > 1 && i > 0)
-                fulltime += t.gettime_ms();
-            else if(iters == 1)
-                fulltime = t.gettime_ms();
-            // else do nothing, drop the first iteration
-        }
+            wall_timing.Add(t.gettime_ms());
 
         if(inflags.GetValueStr("time") == "1")
         {
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
-            lowtime = (time < lowtime) ? time : lowtime;
-            if(iters > 1 && i > 0)
-                avgtime += time;
+            kernel_timing.Add(time);
         }
     }
 
     if(WALL_CLOCK)
     {
-        printf("Wall-clock Time Forward GPU Batch Norm Elapsed: %f ms, for %d iterations.\n",
-               (iters == 1) ? t.gettime_ms() : (fulltime / float(iters - 1)),
-               (iters > 1) ? iters - 1 : 1);
+        const auto wall = wall_timing.Summarize();
+        printf("Wall-clock Time Forward GPU Batch Norm Elapsed: %f ms, for %zu iterations.\n",
+               wall.mean,
+               wall.samples);
     }
 
     if(inflags.GetValueStr("time") == "1")
     {
-        printf("GPU Kernel Min Time Forward Batch Normalization Elapsed: %f ms\n", lowtime);
+        const auto kernel = kernel_timing.Summarize();
+        printf("GPU Kernel Min Time Forward Batch Normalization Elapsed: %f ms\n", kernel.min);
         if(iters > 1)
-            printf("GPU Kernel Avg Time Forward Batch Normalization Elapsed: %f ms, for %d "
+            printf("GPU Kernel Avg Time Forward Batch Normalization Elapsed: %f ms, for %zu "
                    "iterations.\n",
-                   avgtime / (iters - 1),
-                   iters - 1);
+                   kernel.mean,
+                   kernel.samples);
         int in_n, in_c, in_h, in_w;
         std::tie(in_n, in_c, in_h, in_w) = miopen::tien<4>(in.GetTensor().desc.GetLengths());
         size_t M                         = in_n * in_c * in_h * in_w;
@@ -868,8 +862,8 @@ int BatchNormDriver<TInput, Tref, TAcc, TScaleBias, TOut>::RunForwardGPU()
         printf("stats: bnormf, 0, %zu, %zu, 0, %f, %f\n",
                dataSz,
                dataSz,
-               (rdCnt * dataSz + wrCnt * dataSz) / lowtime / 1e6,
-               lowtime);
+               (rdCnt * dataSz + wrCnt * dataSz) / kernel.min / 1e6,
+               kernel.min);
     }
     return miopenStatusSuccess;
 }
@@ -1032,10 +1026,9 @@ int BatchNormDriver<TInput, Tref, TAcc, TScaleBias, TOut>::RunBackwardGPU()
     Tref epsilon = static_cast<Tref>(EPSILON);
 
     Timer t;
-    double fulltime = 0.;
-    auto iters      = inflags.GetValueInt("iter");
-    float lowtime   = 100000000.0;
-    float avgtime   = 0.;
+    TimingStats wall_timing;
+    TimingStats kernel_timing;
+    auto iters = inflags.GetValueInt("iter");
 
     for(int i = 0; i < iters; i++)
     {
@@ -1095,47 +1088,41 @@ int BatchNormDriver<TInput, Tref, TAcc, TScaleBias, TOut>::RunBackwardGPU()
         miopen::deref(GetHandle()).Finish();
         STOP_TIME
         if(WALL_CLOCK)
-        {
-            if(iters > 1 && i > 0)
-                fulltime += t.gettime_ms();
-            else if(iters == 1)
-                fulltime = t.gettime_ms();
-        }
+            wall_timing.Add(t.gettime_ms());
 
         if(inflags.GetValueStr("time") == "1")
         {
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
-            lowtime = (time < lowtime) ? time : lowtime;
-            if(iters > 1 && i > 0)
-                avgtime += time;
-
-            int in_n, in_c, in_h, in_w;
-            std::tie(in_n, in_c, in_h, in_w) = miopen::tien<4>(in.GetTensor().desc.GetLengths());
-            size_t M                         = in_n * in_c * in_h * in_w;
-            size_t dataSz = (M + 2 * in_c) * miopen::GetTypeSize(in.GetTensor().desc.GetType());
-            float rdCnt   = 2.0;
-            float wrCnt   = 1.0;
-            // layer, flopCnt, reads, writes, GFLOPS, GB/s, timeMs
-            printf("stats: bnormb, 0, %zu, %zu, 0, %f, %f\n",
-                   dataSz,
-                   dataSz,
-                   (rdCnt * dataSz + wrCnt * dataSz) / lowtime / 1e6,
-                   lowtime);
+            kernel_timing.Add(time);
         }
     }
 
     if(WALL_CLOCK)
     {
         printf("Wall-clock Time Backward GPU Batch Norm Elapsed: %f ms\n",
-               (iters == 1) ? t.gettime_ms() : (fulltime / float(iters - 1)));
+               wall_timing.Summarize().mean);
     }
     if(inflags.GetValueStr("time") == "1")
     {
-        printf("GPU Kernel Min Time Backwards Batch Normalization Elapsed: %f ms\n", lowtime);
+        const auto kernel = kernel_timing.Summarize();
+        int in_n, in_c, in_h, in_w;
+        std::tie(in_n, in_c, in_h, in_w) = miopen::tien<4>(in.GetTensor().desc.GetLengths());
+        size_t M                         = in_n * in_c * in_h * in_w;
+        size_t dataSz = (M + 2 * in_c) * miopen::GetTypeSize(in.GetTensor().desc.GetType());
+        float rdCnt   = 2.0;
+        float wrCnt   = 1.0;
+        // layer, flopCnt, reads, writes, GFLOPS, GB/s, timeMs
+        printf("stats: bnormb, 0, %zu, %zu, 0, %f, %f\n",
+               dataSz,
+               dataSz,
+               (rdCnt * dataSz + wrCnt * dataSz) / kernel.min / 1e6,
+               kernel.min);
+
+        printf("GPU Kernel Min Time Backwards Batch Normalization Elapsed: %f ms\n", kernel.min);
         if(iters > 1)
             printf("GPU Kernel Avg Time Backward Batch Normalization Elapsed: %f ms\n",
-                   avgtime / (iters - 1));
+                   kernel.mean);
     }
 
     return miopenStatusSuccess;
@@ -31,6 +31,7 @@
 #include "random.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 #include <algorithm>
 #include <cfloat>
 #include <cstdlib>
@@ -254,8 +255,7 @@ int CatDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
 template <typename Tgpu, typename Tref>
 int CatDriver<Tgpu, Tref>::RunForwardGPU()
 {
-    float kernel_total_time = 0;
-    float kernel_first_time = 0;
+    TimingStats kernel_timing;
 
     Timer t;
     START_TIME
@@ -272,9 +272,7 @@ int CatDriver<Tgpu, Tref>::RunForwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
-        kernel_total_time += time;
-        if(i == 0)
-            kernel_first_time = time;
+        kernel_timing.Add(time);
     }
 
     if(inflags.GetValueInt("time") == 1)
@@ -284,8 +282,7 @@ int CatDriver<Tgpu, Tref>::RunForwardGPU()
         if(WALL_CLOCK)
             printf("Wall-clock Time Forward Cat Elapsed: %f ms\n", t.gettime_ms() / iter);
 
-        float kernel_average_time =
-            iter > 1 ? (kernel_total_time - kernel_first_time) / (iter - 1) : kernel_first_time;
+        const auto kernel_average_time = kernel_timing.Summarize().mean;
         printf("GPU Kernel Time Forward Cat Elapsed: %f ms\n", kernel_average_time);
     }
 
@@ -35,6 +35,7 @@
 #include "rocrand_wrapper.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 #include "util_driver.hpp"
 #include "util_file.hpp"
 
@@ -46,6 +47,7 @@
 #include <miopen/find_controls.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/miopen.h>
+#include <miopen/conv/selection_report.hpp>
 #include <miopen/conv/solvers.hpp>
 #include <miopen/tensor.hpp>
 
@@ -53,6 +55,7 @@
 #include <../test/cpu_conv.hpp>
 #include <../test/serialize.hpp>
 #include <../test/tensor_holder.hpp>
+#include <../test/verification_cache.hpp>
 #include <../test/verify.hpp>
 
 #include <boost/optional.hpp>
@@ -400,6 +403,10 @@ private:
     bool warmup_enabled  = false;
     bool is_gpualloc     = false;
     int num_iterations   = 1;
+    bool timing_json     = false;
+    int explain_selection = 0;
+    TimingOptions timing_options;
+    TimingStats kernel_timing;
 
     // Used to avoid wasting time for verification after failure of Run*GPU().
     // We can't properly control this from the main() level.
@@ -419,11 +426,21 @@ private:
 
     float ComputeAverageTime(const float total_time, const float first_time) const
     {
-        if(num_iterations > 1)
-            return (total_time - first_time) / (num_iterations - 1);
+        const auto iterations = kernel_timing.Iterations();
+        if(iterations > 1)
+            return (total_time - first_time) / (iterations - 1);
         return total_time;
     }
 
+    void PrintTimingStats(const std::string& name) const
+    {
+        const auto summary = kernel_timing.Summarize();
+        PrintTimingSummary(std::cout, name, summary);
+        if(timing_json)
+            PrintTimingJson(std::cout, name, summary);
+    }
+
+    void PrintSelectionReport(miopen::conv::Direction direction);
     void PrintForwardTime(float kernel_total_time, float kernel_first_time) const;
     int RunForwardGpuImmed(bool is_transform);
     int RunForwardGpuFind(bool is_transform);
@@ -458,7 +475,16 @@ private:
         BwdBias
     };
 
+    /// Counter-based PRNG streams of the host buffers that are filled in parallel.
+    enum RandomStream : std::uint64_t
+    {
+        In   = 1,
+        Dout = 2,
+        Wei  = 3,
+    };
+
     std::string GetVerificationCacheFileName(const Direction& direction) const;
+    verification_cache::Key GetVerificationCacheKey(const Direction& direction) const;
     bool IsInputTensorTransform() const;
 
     bool TryReadVerificationCache(const Direction& direction,
@@ -622,6 +648,17 @@ int ConvDriver<Tgpu, Tref>::ParseCmdLineArgs(int argc, char* argv[])
         }
     }
 
+    timing_options.min_iterations = num_iterations;
+    timing_options.adaptive       = (inflags.GetValueInt("adaptive_iter") != 0);
+    timing_options.max_iterations = std::max(inflags.GetValueInt("max_iter"), num_iterations);
+    timing_options.ci_percent     = inflags.GetValueDouble("timing_ci");
+    timing_json                   = (inflags.GetValueInt("timing_json") != 0);
+    explain_selection             = inflags.GetValueInt("explain_selection");
+    if(timing_options.adaptive && !time_enabled)
+    {
+        std::cout << "Info: '--adaptive_iter' is ignored because '--time' is not set" << std::endl;
+    }
+
     if(time_enabled)
     {
         miopenEnableProfiling(GetHandle(), true);
@@ -925,11 +962,40 @@ int ConvDriver<Tgpu, Tref>::AddCmdLineArgs()
     inflags.AddInputFlag(
         "trans_output_pad_w", 'X', "0", "Zero Padding Output for Width (Default=0)", "int");
     inflags.AddInputFlag("iter", 'i', "10", "Number of Iterations (Default=10)", "int");
+    inflags.AddInputFlag("adaptive_iter",
+                         'A',
+                         "0",
+                         "Adaptive number of iterations, requires '--time 1'. Warms up until"
+                         "\nkernel times stabilize, then runs at least '--iter' iterations and"
+                         "\nuntil the 95% confidence interval of the mean is within '--timing_ci'"
+                         "\n(Default=0)",
+                         "int");
+    inflags.AddInputFlag(
+        "max_iter", 'M', "1000", "Maximum Number of Adaptive Iterations (Default=1000)", "int");
+    inflags.AddInputFlag("timing_ci",
+                         'K',
+                         "1.0",
+                         "Target half-width of the 95% confidence interval of the mean kernel"
+                         "\ntime, in percents of the mean (Default=1.0)",
+                         "double");
+    inflags.AddInputFlag(
+        "timing_json", 'J', "0", "Print Kernel Time Statistics as JSON (Default=0)", "int");
+    inflags.AddInputFlag("explain_selection",
+                         'E',
+                         "0",
+                         "Print how each solver fared in solver selection: applicability, perf-db,"
+                         "\nfind-db and AI heuristic data, workspace and the final ranking"
+                         "\n0 Off (Default)"
+                         "\n1 Print a table"
+                         "\n2 Print JSON",
+                         "int");
     inflags.AddInputFlag("verify", 'V', "1", "Verify Each Layer (Default=1)", "int");
     inflags.AddInputFlag("verification_cache",
                          'C',
                          "",
-                         "Use specified directory to cache verification data. Off by default.",
+                         "Use specified directory to cache verification data. Entries are keyed by "
+                         "digests of the problem, the input data and the host reference version. "
+                         "Off by default.",
                          "string");
     inflags.AddInputFlag("time", 't', "0", "Time Each Layer (Default=0)", "int");
     inflags.AddInputFlag("wall",
@@ -1487,11 +1553,11 @@ int ConvDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
 
         if(!doutRead)
         {
-            auto gen = [&]() -> auto
-            {
-                return is_fp8 ? prng::gen_A_to_B(Data_min, Data_max) : prng::gen_0_to_B(Data_scale);
-            };
-            dout.InitHostData(out_sz, is_bwd || is_wrw, gen);
+            dout.InitHostData(out_sz,
+                              is_bwd || is_wrw,
+                              is_fp8 ? Data_min : static_cast<Tgpu>(0),
+                              is_fp8 ? Data_max : Data_scale,
+                              RandomStream::Dout);
         }
 
         if(is_wrw)
@@ -1539,16 +1605,17 @@ int ConvDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
 
     if(!dataRead)
     {
-        auto gen = [&]() -> Tgpu {
-            return is_fp8 ? prng::gen_A_to_B(Data_min, Data_max) : prng::gen_0_to_B(Data_scale);
-        };
-        in.InitHostData(in_sz, is_fwd || is_wrw, gen);
+        in.InitHostData(in_sz,
+                        is_fwd || is_wrw,
+                        is_fp8 ? Data_min : static_cast<Tgpu>(0),
+                        is_fp8 ? Data_max : Data_scale,
+                        RandomStream::In);
     }
 
     if(!weiRead)
     {
         auto gen = [&]() -> auto { return Data_scale * conv::RanGenWeights<Tgpu>(); };
-        wei.InitHostData(wei_sz, is_fwd || is_bwd, gen);
+        wei.InitHostData(wei_sz, is_fwd || is_bwd, gen, RandomStream::Wei);
     }
 
     if(is_fwd || is_bwd)
@@ -1657,12 +1724,61 @@ int ConvDriver<Tgpu, Tref>::FindForward(int& ret_algo_count,
     return rc;
 }
 
+template <typename Tgpu, typename Tref>
+void ConvDriver<Tgpu, Tref>::PrintSelectionReport(const miopen::conv::Direction direction)
+{
+    using miopen::conv::Direction;
+    using miopen::conv::ProblemDescription;
+
+    if(explain_selection == 0)
+        return;
+
+    const auto& conv     = miopen::deref(convDesc);
+    const auto& x        = miopen::deref(inputTensor);
+    const auto& w        = miopen::deref(weightTensor);
+    const auto& y        = miopen::deref(outputTensor);
+    const auto transpose = (conv.mode == miopenTranspose);
+
+    // Same as the problems the convolution API builds, including the swapping of x and y
+    // in transpose mode.
+    const auto problem = [&]() {
+        switch(direction)
+        {
+        case Direction::Forward:
+            return ProblemDescription{
+                x, w, y, conv, transpose ? Direction::BackwardData : Direction::Forward};
+        case Direction::BackwardData:
+            return ProblemDescription{
+                y, w, x, conv, transpose ? Direction::Forward : Direction::BackwardData};
+        case Direction::BackwardWeights: break;
+        }
+        return transpose ? ProblemDescription{x, w, y, conv, Direction::BackwardWeights}
+                         : ProblemDescription{y, w, x, conv, Direction::BackwardWeights};
+    }();
+
+    try
+    {
+        auto ctx = miopen::ExecutionContext{&miopen::deref(GetHandle())};
+        problem.SetupFloats(ctx);
+        const auto report = miopen::conv::ExplainSelection(ctx, problem);
+        if(explain_selection == 2)
+            std::cout << report.ToJson() << std::endl;
+        else
+            std::cout << report;
+    }
+    catch(const miopen::Exception& ex)
+    {
+        std::cerr << "Solver selection report failed: " << ex.what() << std::endl;
+    }
+}
+
 template <typename Tgpu, typename Tref>
 void ConvDriver<Tgpu, Tref>::PrintForwardTime(const float kernel_total_time,
                                               const float kernel_first_time) const
 {
     float kernel_average_time = ComputeAverageTime(kernel_total_time, kernel_first_time);
     printf("GPU Kernel Time Forward Conv. Elapsed: %f ms (average)\n", kernel_average_time);
+    PrintTimingStats("Forward Conv.");
 
     const auto num_dim = miopen::deref(inputTensor).GetNumDims() - 2;
     if(num_dim != 2 && num_dim != 3)
@@ -1896,6 +2012,8 @@ int ConvDriver<Tgpu, Tref>::RunForwardGPU()
                               wei_vect4_dev->GetMem());
     }
 
+    PrintSelectionReport(miopen::conv::Direction::Forward);
+
     if(immediate_solution)
         rc = RunForwardGpuImmed(is_transform);
     else
@@ -2046,7 +2164,8 @@ int ConvDriver<Tgpu, Tref>::RunForwardGpuFind(const bool is_transform)
     ResizeWorkspaceDev(ctx, ws_size);
     wall.start(wall_enabled);
 
-    for(int i = 0; i < num_iterations; i++)
+    kernel_timing.Reset(timing_options);
+    for(int i = 0; kernel_timing.Continue(i); i++)
     {
         rc = miopenConvolutionForward(GetHandle(),
                                       &alpha,
@@ -2072,6 +2191,7 @@ int ConvDriver<Tgpu, Tref>::RunForwardGpuFind(const bool is_transform)
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
             kernel_total_time += time;
+            kernel_timing.Add(time);
             if(i == 0)
                 kernel_first_time = time;
         }
@@ -2201,7 +2321,8 @@ int ConvDriver<Tgpu, Tref>::RunForwardGpuImmed(const bool is_transform)
 
     wall.start(wall_enabled);
 
-    for(int i = 0; i < num_iterations; i++)
+    kernel_timing.Reset(timing_options);
+    for(int i = 0; kernel_timing.Continue(i); i++)
     {
         rc = miopenConvolutionForwardImmediate(
             handle,
@@ -2226,6 +2347,7 @@ int ConvDriver<Tgpu, Tref>::RunForwardGpuImmed(const bool is_transform)
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
             kernel_total_time += time;
+            kernel_timing.Add(time);
             if(i == 0)
                 kernel_first_time = time;
         }
@@ -2427,6 +2549,7 @@ int ConvDriver<Tgpu, Tref>::RunBackwardGPU()
 
     if(is_bwd)
     {
+        PrintSelectionReport(miopen::conv::Direction::BackwardData);
         auto rc = immediate_solution ? RunBackwardDataGpuImmed() : RunBackwardDataGpuFind();
         is_bwd_run_failed = (rc != 0);
         ret |= rc;
@@ -2434,6 +2557,7 @@ int ConvDriver<Tgpu, Tref>::RunBackwardGPU()
 
     if(is_wrw)
     {
+        PrintSelectionReport(miopen::conv::Direction::BackwardWeights);
         auto rc           = immediate_solution ? RunBackwardWrwGpuImmed() : RunBackwardWrwGpuFind();
         is_wrw_run_failed = (rc != 0);
         ret |= (rc << 16); // Differentiate WrW and Bwd error codes.
@@ -2516,7 +2640,8 @@ int ConvDriver<Tgpu, Tref>::RunBackwardDataGpuFind()
     ResizeWorkspaceDev(ctx, ws_size);
     wall.start(wall_enabled);
 
-    for(int i = 0; i < num_iterations; i++)
+    kernel_timing.Reset(timing_options);
+    for(int i = 0; kernel_timing.Continue(i); i++)
     {
         rc = miopenConvolutionBackwardData(GetHandle(),
                                            &alpha,
@@ -2543,6 +2668,7 @@ int ConvDriver<Tgpu, Tref>::RunBackwardDataGpuFind()
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
             kernel_total_time += time;
+            kernel_timing.Add(time);
             if(i == 0)
                 kernel_first_time = time;
         }
@@ -2581,6 +2707,7 @@ void ConvDriver<Tgpu, Tref>::PrintBackwardDataTime(float kernel_total_time, floa
 {
     float kernel_average_time = ComputeAverageTime(kernel_total_time, kernel_first_time);
     printf("GPU Kernel Time Backward Data Conv. Elapsed: %f ms (average)\n", kernel_average_time);
+    PrintTimingStats("Backward Data Conv.");
 
     const auto num_dim = miopen::deref(inputTensor).GetNumDims() - 2;
     if(num_dim != 2 && num_dim != 3)
@@ -2726,7 +2853,8 @@ int ConvDriver<Tgpu, Tref>::RunBackwardWrwGpuFind()
     ResizeWorkspaceDev(ctx, ws_size);
     wall.start(wall_enabled);
 
-    for(int i = 0; i < num_iterations; i++)
+    kernel_timing.Reset(timing_options);
+    for(int i = 0; kernel_timing.Continue(i); i++)
     {
         rc = miopenConvolutionBackwardWeights(GetHandle(),
                                               &alpha,
@@ -2753,6 +2881,7 @@ int ConvDriver<Tgpu, Tref>::RunBackwardWrwGpuFind()
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
             kernel_total_time += time;
+            kernel_timing.Add(time);
             if(i == 0)
                 kernel_first_time = time;
         }
@@ -2792,6 +2921,7 @@ void ConvDriver<Tgpu, Tref>::PrintBackwardWrwTime(float kernel_total_time, float
     float kernel_average_time = ComputeAverageTime(kernel_total_time, kernel_first_time);
     printf("GPU Kernel Time Backward Weights Conv. Elapsed: %f ms (average)\n",
            kernel_average_time);
+    PrintTimingStats("Backward Weights Conv.");
 
     const auto num_dim = miopen::deref(inputTensor).GetNumDims() - 2;
     if(num_dim != 2 && num_dim != 3)
@@ -2963,7 +3093,8 @@ int ConvDriver<Tgpu, Tref>::RunBackwardDataGpuImmed()
 
     wall.start(wall_enabled);
 
-    for(int i = 0; i < num_iterations; i++)
+    kernel_timing.Reset(timing_options);
+    for(int i = 0; kernel_timing.Continue(i); i++)
     {
         rc = miopenConvolutionBackwardDataImmediate(handle,
                                                     outputTensor,
@@ -2987,6 +3118,7 @@ int ConvDriver<Tgpu, Tref>::RunBackwardDataGpuImmed()
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
             kernel_total_time += time;
+            kernel_timing.Add(time);
             if(i == 0)
                 kernel_first_time = time;
         }
@@ -3092,7 +3224,8 @@ int ConvDriver<Tgpu, Tref>::RunBackwardWrwGpuImmed()
 
     wall.start(wall_enabled);
 
-    for(int i = 0; i < num_iterations; i++)
+    kernel_timing.Reset(timing_options);
+    for(int i = 0; kernel_timing.Continue(i); i++)
     {
         rc = miopenConvolutionBackwardWeightsImmediate(handle,
                                                        outputTensor,
@@ -3116,6 +3249,7 @@ int ConvDriver<Tgpu, Tref>::RunBackwardWrwGpuImmed()
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
             kernel_total_time += time;
+            kernel_timing.Add(time);
             if(i == 0)
                 kernel_first_time = time;
         }
@@ -3415,26 +3549,49 @@ std::string ConvDriver<Tgpu, Tref>::GetVerificationCacheFileName(
     return ss.str();
 }
 
+template <typename Tgpu, typename Tref>
+verification_cache::Key ConvDriver<Tgpu, Tref>::GetVerificationCacheKey(
+    const ConvDriver<Tgpu, Tref>::Direction& direction) const
+{
+    auto key = verification_cache::Key{"conv", GetVerificationCacheFileName(direction)};
+    const auto add_input = [&](const auto& buffer) {
+        key.AddInput(buffer.GetVectorData(), buffer.GetVectorSize());
+    };
+
+    switch(direction)
+    {
+    case Direction::Fwd:
+        add_input(in);
+        add_input(wei);
+        if(inflags.GetValueInt("bias") != 0)
+            add_input(b);
+        break;
+    case Direction::Bwd:
+        add_input(dout);
+        add_input(wei);
+        break;
+    case Direction::WrW:
+        add_input(in);
+        add_input(dout);
+        break;
+    case Direction::BwdBias: add_input(dout); break;
+    }
+    return key;
+}
+
 template <typename Tgpu, typename Tref>
 bool ConvDriver<Tgpu, Tref>::TryReadVerificationCache(
     const ConvDriver<Tgpu, Tref>::Direction& direction,
     miopenTensorDescriptor_t& tensorDesc,
     Tref* data) const
 {
-    const auto verification_cache_path = inflags.GetValueStr("verification_cache");
+    const auto store = verification_cache::Store{inflags.GetValueStr("verification_cache")};
+    const auto key   = GetVerificationCacheKey(direction);
 
-    if(!verification_cache_path.empty())
+    if(store.Load(key, data, GetTensorSize(tensorDesc)))
     {
-        const auto file_path =
-            verification_cache_path + "/" + GetVerificationCacheFileName(direction);
-
-        if(std::ifstream(file_path).good())
-        {
-            if(readBufferFromFile<Tref>(data, GetTensorSize(tensorDesc), file_path.c_str()))
-            {
-                return true;
-            }
-        }
+        std::cout << "Read verification data from " << store.GetPath(key) << std::endl;
+        return true;
     }
 
     return false;
@@ -3444,13 +3601,8 @@ template <typename Tgpu, typename Tref>
 void ConvDriver<Tgpu, Tref>::TrySaveVerificationCache(
     const ConvDriver<Tgpu, Tref>::Direction& direction, std::vector<Tref>& data) const
 {
-    const auto verification_cache_path = inflags.GetValueStr("verification_cache");
-    if(!verification_cache_path.empty())
-    {
-        const auto file_path =
-            verification_cache_path + "/" + GetVerificationCacheFileName(direction);
-        dumpBufferToFile<Tref>(file_path.c_str(), data.data(), data.size());
-    }
+    const auto store = verification_cache::Store{inflags.GetValueStr("verification_cache")};
+    store.Save(GetVerificationCacheKey(direction), data.data(), data.size());
 }
 
 template <typename Tgpu, typename Tref>
@@ -30,6 +30,7 @@
 #include "driver.hpp"
 #include "random.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 #include "util_driver.hpp"
 #include "util_file.hpp"
 
@@ -279,8 +280,8 @@ int CTCDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
                                   ctcLossDesc,
                                   &workSpaceSize);
 
-    GetCTCLossWorkspaceSizeCPU<Tgpu>(miopen::deref(probsDesc).GetLengths(),
-                                     miopen::deref(gradientsDesc).GetLengths(),
+    GetCTCLossWorkspaceSizeCPU<Tgpu>(std::vector<size_t>(miopen::deref(probsDesc).GetLengths()),
+                                     std::vector<size_t>(miopen::deref(gradientsDesc).GetLengths()),
                                      labels.data(),
                                      labelLengths.data(),
                                      inputLengths.data(),
@@ -347,8 +348,7 @@ int CTCDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
 template <typename Tgpu, typename Tref>
 int CTCDriver<Tgpu, Tref>::RunForwardGPU()
 {
-    float kernel_total_time = 0.0;
-    float kernel_first_time = 0.0;
+    TimingStats kernel_timing;
 
     Timer t;
     START_TIME
@@ -370,9 +370,7 @@ int CTCDriver<Tgpu, Tref>::RunForwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
-        kernel_total_time += time;
-        if(i == 0)
-            kernel_first_time = time;
+        kernel_timing.Add(time);
     }
 
     if(inflags.GetValueInt("time") == 1)
@@ -382,9 +380,7 @@ int CTCDriver<Tgpu, Tref>::RunForwardGPU()
             printf("Wall-clock Time CTC Loss Elapsed: %f ms\n",
                    t.gettime_ms() / inflags.GetValueInt("iter"));
 
-        int iter = inflags.GetValueInt("iter");
-        float kernel_average_time =
-            iter > 1 ? (kernel_total_time - kernel_first_time) / (iter - 1) : kernel_first_time;
+        const auto kernel_average_time = kernel_timing.Summarize().mean;
         printf("GPU Kernel Time Forward Conv. Elapsed: %f ms (average)\n", kernel_average_time);
     }
 
@@ -399,10 +395,10 @@ template <typename Tgpu, typename Tref>
 int CTCDriver<Tgpu, Tref>::RunCTCLossCPU()
 {
     RunCTCLossCPUVerify<Tgpu, Tref>(num_class,
-                                    miopen::deref(probsDesc).GetLengths(),
-                                    miopen::deref(probsDesc).GetStrides(),
-                                    miopen::deref(gradientsDesc).GetLengths(),
-                                    miopen::deref(gradientsDesc).GetStrides(),
+                                    std::vector<size_t>(miopen::deref(probsDesc).GetLengths()),
+                                    std::vector<size_t>(miopen::deref(probsDesc).GetStrides()),
+                                    std::vector<size_t>(miopen::deref(gradientsDesc).GetLengths()),
+                                    std::vector<size_t>(miopen::deref(gradientsDesc).GetStrides()),
                                     probs,
                                     labels,
                                     labelLengths,
@@ -195,6 +195,7 @@ public:
     }
 
     Tgpu* GetVectorData() { return is_gpualloc ? nullptr : host.data.data(); }
+    const Tgpu* GetVectorData() const { return is_gpualloc ? nullptr : host.data.data(); }
     std::size_t GetVectorSize() const { return is_gpualloc ? 0 : host.data.size(); }
 
     void
@@ -226,6 +227,33 @@ public:
         }
     }
 
+    /// Parallel initialization with uniform values in [A, B). Values come from the counter-based
+    /// generator, so every element depends only on the seed, `prng_stream` and its index. Unlike the
+    /// overload above, unused buffers need not be generated to keep other buffers reproducible.
+    void InitHostData(
+        const size_t sz, const bool do_write, Tgpu A, Tgpu B, std::uint64_t prng_stream)
+    {
+        if(is_gpualloc || !do_write)
+            return;
+        prng::fill_A_to_B(GetVectorData(), sz, A, B, prng_stream);
+    }
+
+    /// Parallel variant of the generator overload. Blocks of elements are generated concurrently,
+    /// each after reseeding the prng from the counter-based generator (see
+    /// prng::par_for_blocks), so the data depends only on the seed and `prng_stream`.
+    void InitHostData(const size_t sz,
+                      const bool do_write,
+                      std::function<Tgpu()> generator,
+                      std::uint64_t prng_stream)
+    {
+        if(is_gpualloc || !do_write)
+            return;
+        auto* data = GetVectorData();
+        prng::par_for_blocks(sz, prng_stream, [&](std::size_t first, std::size_t last) {
+            std::generate(data + first, data + last, generator);
+        });
+    }
+
     status_t AllocOnDevice(stream, context_t ctx, const size_t sz)
     {
         dev = std::make_unique<GPUMem>(ctx, sz, sizeof(Tgpu));
@@ -314,7 +342,7 @@ inline void PadBufferSize(size_t& sz, int datatype_sz)
            "adamw[fp16], ampadamw, transformersadamw[fp16], transformersampadamw, "
            "getitem[bfp16|fp16], reducecalculation[bfp16|fp16], rope[bfp16|fp16], "
            "prelu[bfp16|fp16], kthvalue[bfp16|fp16], glu[bfp16|fp16], softmarginloss[bfp16|fp16], "
-           "multimarginloss[bfp16|fp16]\n");
+           "multimarginloss[bfp16|fp16], batch\n");
     exit(0); // NOLINT (concurrency-mt-unsafe)
 }
 
@@ -352,7 +380,7 @@ inline std::string ParseBaseArg(int argc, char* argv[])
        arg != "kthvaluebfp16" && arg != "glu" && arg != "glufp16" && arg != "glubfp16" &&
        arg != "softmarginloss" && arg != "softmarginlossfp16" && arg != "softmarginlossbfp16" &&
        arg != "multimarginloss" && arg != "multimarginlossfp16" && arg != "multimarginlossbfp16" &&
-       arg != "--version")
+       arg != "batch" && arg != "--version")
     {
         printf("FAILED: Invalid Base Input Argument\n");
         Usage();
@@ -363,19 +391,39 @@ inline std::string ParseBaseArg(int argc, char* argv[])
         return arg;
 }
 
+inline miopenHandle_t CreateDriverHandle()
+{
+    miopenHandle_t handle;
+#if MIOPEN_BACKEND_OPENCL
+    miopenCreate(&handle);
+#elif MIOPEN_BACKEND_HIP
+    hipStream_t s;
+    hipStreamCreate(&s);
+    miopenCreateWithStream(&handle, s);
+#endif
+    return handle;
+}
+
+/// When set, drivers created on the calling thread use this handle instead of creating
+/// their own one, so that consecutive configurations share the handle's kernel caches.
+inline miopenHandle_t& SharedDriverHandle()
+{
+    thread_local miopenHandle_t handle = nullptr;
+    return handle;
+}
+
 class Driver
 {
 public:
     Driver()
     {
         data_type = miopenFloat;
-#if MIOPEN_BACKEND_OPENCL
-        miopenCreate(&handle);
-#elif MIOPEN_BACKEND_HIP
-        hipStream_t s;
-        hipStreamCreate(&s);
-        miopenCreateWithStream(&handle, s);
-#endif
+        handle    = SharedDriverHandle();
+        if(handle == nullptr)
+        {
+            handle      = CreateDriverHandle();
+            owns_handle = true;
+        }
 
         miopenGetStream(handle, &q);
     }
@@ -388,7 +436,11 @@ public:
 #elif MIOPEN_BACKEND_HIP
     hipStream_t& GetStream() { return q; }
 #endif
-    virtual ~Driver() { miopenDestroy(handle); }
+    virtual ~Driver()
+    {
+        if(owns_handle)
+            miopenDestroy(handle);
+    }
 
     // TODO: add timing APIs
     virtual int AddCmdLineArgs()                         = 0;
@@ -405,6 +457,7 @@ protected:
     template <typename Tgpu>
     void InitDataType();
     miopenHandle_t handle;
+    bool owns_handle = false;
     miopenDataType_t data_type;
 
 #if MIOPEN_BACKEND_OPENCL
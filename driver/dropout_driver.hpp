@@ -31,6 +31,7 @@
 #include "dropout_gpu_emulator.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 #include "util_driver.hpp"
 #include "util_file.hpp"
 
@@ -315,8 +316,7 @@ int DropoutDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
 template <typename Tgpu, typename Tref>
 int DropoutDriver<Tgpu, Tref>::RunForwardGPU()
 {
-    float kernel_total_time = 0.0;
-    float kernel_first_time = 0.0;
+    TimingStats kernel_timing;
 
     Timer t;
     START_TIME
@@ -334,9 +334,7 @@ int DropoutDriver<Tgpu, Tref>::RunForwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
-        kernel_total_time += time;
-        if(i == 0)
-            kernel_first_time = time;
+        kernel_timing.Add(time);
     }
 
     if(inflags.GetValueInt("time") == 1)
@@ -346,9 +344,7 @@ int DropoutDriver<Tgpu, Tref>::RunForwardGPU()
             printf("Wall-clock Time Dropout Elapsed: %f ms\n",
                    t.gettime_ms() / inflags.GetValueInt("iter"));
 
-        int iter = inflags.GetValueInt("iter");
-        float kernel_average_time =
-            iter > 1 ? (kernel_total_time - kernel_first_time) / (iter - 1) : kernel_first_time;
+        const auto kernel_average_time = kernel_timing.Summarize().mean;
         printf("GPU Kernel Time Forward Dropout. Elapsed: %f ms (average)\n", kernel_average_time);
     }
 
@@ -383,8 +379,7 @@ int DropoutDriver<Tgpu, Tref>::RunForwardCPU()
 template <typename Tgpu, typename Tref>
 int DropoutDriver<Tgpu, Tref>::RunBackwardGPU()
 {
-    float kernel_total_time = 0.0;
-    float kernel_first_time = 0.0;
+    TimingStats kernel_timing;
 
     Timer t;
     START_TIME
@@ -402,9 +397,7 @@ int DropoutDriver<Tgpu, Tref>::RunBackwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
-        kernel_total_time += time;
-        if(i == 0)
-            kernel_first_time = time;
+        kernel_timing.Add(time);
     }
 
     if(inflags.GetValueInt("time") == 1)
@@ -414,9 +407,7 @@ int DropoutDriver<Tgpu, Tref>::RunBackwardGPU()
             printf("Wall-clock Time Backward Dropout Elapsed: %f ms\n",
                    t.gettime_ms() / inflags.GetValueInt("iter"));
 
-        int iter = inflags.GetValueInt("iter");
-        float kernel_average_time =
-            iter > 1 ? (kernel_total_time - kernel_first_time) / (iter - 1) : kernel_first_time;
+        const auto kernel_average_time = kernel_timing.Summarize().mean;
         printf("GPU Kernel Time Backward Dropout. Elapsed: %f ms (average)\n", kernel_average_time);
     }
 
@@ -67,11 +67,11 @@ static void InitKernelStateEmulator(std::vector<rocrand_state_xorwow>& states,
     }
 }
 
-template <typename T>
-inline void ExpandTensorDim(std::vector<T> x_len,
-                            std::vector<T> x_str,
-                            std::vector<T> y_len,
-                            std::vector<T> y_str,
+template <typename TDims, typename T>
+inline void ExpandTensorDim(const TDims& x_len,
+                            const TDims& x_str,
+                            const TDims& y_len,
+                            const TDims& y_str,
                             std::vector<T>& in_len,
                             std::vector<T>& in_str,
                             std::vector<T>& out_len,
@@ -32,6 +32,7 @@
 #include "InputFlags.hpp"
 #include "driver.hpp"
 #include "random.hpp"
+#include "timing_stats.hpp"
 #include "util_driver.hpp"
 
 #include <../test/verify.hpp>
@@ -302,6 +303,7 @@ int GemmDriver<T>::AllocateBuffersAndCopy()
 template <typename T>
 int GemmDriver<T>::RunForwardGPU()
 {
+    TimingStats kernel_timing;
     for(int i = 0; i < inflags.GetValueInt("iter"); i++)
     {
 #if GEMM_DRIVER_DEBUG
@@ -358,13 +360,18 @@ int GemmDriver<T>::RunForwardGPU()
             std::cout << __func__ << ": after_GEMM, c_tmp: " << c_tmp << std::endl;
         }
 #endif
+        if(inflags.GetValueInt("time") == 1)
+        {
+            float time = 0.0;
+            miopenGetKernelTime(GetHandle(), &time);
+            kernel_timing.Add(time);
+        }
     }
 
     if(inflags.GetValueInt("time") == 1)
     {
-        float time = 0.0;
-        miopenGetKernelTime(GetHandle(), &time);
-        printf("GPU Kernel Time Gemm Elapsed: %f ms\n", time);
+        const auto kernel = kernel_timing.Summarize();
+        printf("GPU Kernel Time Gemm Elapsed: %f ms\n", kernel.mean);
     }
 
     c_dev->FromGPU(GetStream(), c.data());
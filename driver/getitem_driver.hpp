@@ -30,6 +30,7 @@
 #include "driver.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 #include "random.hpp"
 #include <algorithm>
 #include <cfloat>
@@ -402,8 +403,7 @@ int GetitemDriver<Tgpu, Tref>::RunForwardGPU()
 template <typename Tgpu, typename Tref>
 int GetitemDriver<Tgpu, Tref>::RunBackwardGPU()
 {
-    float kernel_total_time = 0;
-    float kernel_first_time = 0;
+    TimingStats kernel_timing;
 
     Timer t;
     START_TIME
@@ -434,9 +434,7 @@ int GetitemDriver<Tgpu, Tref>::RunBackwardGPU()
 
         float time = 0;
         miopenGetKernelTime(GetHandle(), &time);
-        kernel_total_time += time;
-        if(i == 0)
-            kernel_first_time = time;
+        kernel_timing.Add(time);
     }
 
     if(inflags.GetValueInt("time") == 1)
@@ -447,8 +445,7 @@ int GetitemDriver<Tgpu, Tref>::RunBackwardGPU()
             std::cout << "Wall-clock Time Backward Getitem Elapsed: " << t.gettime_ms() / iter
                       << " ms" << std::endl;
 
-        float kernel_average_time =
-            iter > 1 ? (kernel_total_time - kernel_first_time) / (iter - 1) : kernel_first_time;
+        const auto kernel_average_time = kernel_timing.Summarize().mean;
         std::cout << "GPU Kernel Time Backward Getitem Elapsed: " << kernel_average_time << " ms"
                   << std::endl;
     }
@@ -30,6 +30,7 @@
 #include "driver.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 #include "random.hpp"
 
 #include <cstdint>
@@ -329,8 +330,7 @@ int GLUDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
 template <typename Tgpu, typename Tref>
 int GLUDriver<Tgpu, Tref>::RunForwardGPU()
 {
-    float kernel_total_time = 0;
-    float kernel_first_time = 0;
+    TimingStats kernel_timing;
 
     Timer t;
     START_TIME
@@ -344,9 +344,7 @@ int GLUDriver<Tgpu, Tref>::RunForwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
-        kernel_total_time += time;
-        if(i == 0)
-            kernel_first_time = time;
+        kernel_timing.Add(time);
     }
 
     if(inflags.GetValueInt("time") == 1)
@@ -357,8 +355,7 @@ int GLUDriver<Tgpu, Tref>::RunForwardGPU()
             std::cout << "Wall-clock Time Forward GLU Elapsed: " << t.gettime_ms() / iter
                       << " ms\n";
 
-        float kernel_average_time =
-            iter > 1 ? (kernel_total_time - kernel_first_time) / (iter - 1) : kernel_first_time;
+        const auto kernel_average_time = kernel_timing.Summarize().mean;
         std::cout << "GPU Kernel Time Forward GLU Elapsed: " << kernel_average_time << " ms\n";
     }
 
@@ -380,8 +377,7 @@ int GLUDriver<Tgpu, Tref>::RunForwardCPU()
 template <typename Tgpu, typename Tref>
 int GLUDriver<Tgpu, Tref>::RunBackwardGPU()
 {
-    float kernel_total_time = 0;
-    float kernel_first_time = 0;
+    TimingStats kernel_timing;
     Timer t;
     START_TIME;
     for(int i = 0; i < inflags.GetValueInt("iter"); i++)
@@ -399,9 +395,7 @@ int GLUDriver<Tgpu, Tref>::RunBackwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
-        kernel_total_time += time;
-        if(i == 0)
-            kernel_first_time = time;
+        kernel_timing.Add(time);
     }
 
     if(inflags.GetValueInt("time") == 1)
@@ -411,8 +405,7 @@ int GLUDriver<Tgpu, Tref>::RunBackwardGPU()
         if(WALL_CLOCK)
             std::cout << "Wall-clock Time Backward GLU Elapsed: " << t.gettime_ms() / iter
                       << " ms\n";
-        float kernel_average_time =
-            iter > 1 ? (kernel_total_time - kernel_first_time) / (iter - 1) : kernel_first_time;
+        const auto kernel_average_time = kernel_timing.Summarize().mean;
         std::cout << "GPU Kernel Time Backward GLU Elapsed: " << kernel_average_time << " ms\n";
     }
 
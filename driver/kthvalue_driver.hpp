@@ -28,6 +28,7 @@
 #include "driver.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 #include "random.hpp"
 
 #include <../test/tensor_holder.hpp>
@@ -280,8 +281,7 @@ int KthvalueDriver<TIO>::AllocateBuffersAndCopy()
 template <typename TIO>
 int KthvalueDriver<TIO>::RunForwardGPU()
 {
-    float kernel_total_time = 0;
-    float kernel_first_time = 0;
+    TimingStats kernel_timing;
 
     Timer t;
     START_TIME
@@ -300,9 +300,7 @@ int KthvalueDriver<TIO>::RunForwardGPU()
                               keepDim);
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
-        kernel_total_time += time;
-        if(i == 0)
-            kernel_first_time = time;
+        kernel_timing.Add(time);
     }
 
     if(inflags.GetValueInt("time") == 1)
@@ -313,8 +311,7 @@ int KthvalueDriver<TIO>::RunForwardGPU()
             std::cout << "Wall-clock Time Kthvalue Fwd Elapsed: " << t.gettime_ms() / iter << " ms"
                       << std::endl;
 
-        float kernel_average_time =
-            iter > 1 ? (kernel_total_time - kernel_first_time) / (iter - 1) : kernel_first_time;
+        const auto kernel_average_time = kernel_timing.Summarize().mean;
         std::cout << "GPU Kernel Time Kthvalue Fwd Elapsed: " << kernel_average_time << " ms"
                   << std::endl;
     }
@@ -32,6 +32,7 @@
 #include "random.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 #include "util_driver.hpp"
 
 #include "../test/verify.hpp"
@@ -313,6 +314,7 @@ int LRNDriver<Tgpu, Tref>::RunForwardGPU()
     Timer t;
     START_TIME
 
+    TimingStats kernel_timing;
     for(int i = 0; i < inflags.GetValueInt("iter"); i++)
     {
         miopenLRNForward(GetHandle(),
@@ -325,18 +327,23 @@ int LRNDriver<Tgpu, Tref>::RunForwardGPU()
                          out_dev->GetMem(),
                          do_backward,
                          do_backward ? scale_dev->GetMem() : nullptr);
+        if(inflags.GetValueInt("time") == 1)
+        {
+            float time = 0.0;
+            miopenGetKernelTime(GetHandle(), &time);
+            kernel_timing.Add(time);
+        }
     }
 
     if(inflags.GetValueInt("time") == 1)
     {
-        float time = 0.0;
-        miopenGetKernelTime(GetHandle(), &time);
+        const auto kernel = kernel_timing.Summarize();
 
         STOP_TIME
         if(WALL_CLOCK)
             printf("Wall-clock Time Forward LRN Elapsed: %f ms\n",
                    t.gettime_ms() / inflags.GetValueInt("iter"));
-        printf("GPU Kernel Time Forward LRN Elapsed: %f ms\n", time);
+        printf("GPU Kernel Time Forward LRN Elapsed: %f ms\n", kernel.mean);
     }
 
     out_dev->FromGPU(GetStream(), out.data());
@@ -377,6 +384,7 @@ int LRNDriver<Tgpu, Tref>::RunBackwardGPU()
     Timer t;
     START_TIME
 
+    TimingStats kernel_timing;
     for(int i = 0; i < inflags.GetValueInt("iter"); i++)
     {
         miopenLRNBackward(GetHandle(),
@@ -392,18 +400,23 @@ int LRNDriver<Tgpu, Tref>::RunBackwardGPU()
                           dInputTensor,
                           din_dev->GetMem(),
                           scale_dev->GetMem());
+        if(inflags.GetValueInt("time") == 1)
+        {
+            float time = 0.0;
+            miopenGetKernelTime(GetHandle(), &time);
+            kernel_timing.Add(time);
+        }
     }
 
     if(inflags.GetValueInt("time") == 1)
     {
-        float time = 0.0;
-        miopenGetKernelTime(GetHandle(), &time);
+        const auto kernel = kernel_timing.Summarize();
 
         STOP_TIME
         if(WALL_CLOCK)
             printf("Wall-clock Time Backward LRN Elapsed: %f ms\n",
                    t.gettime_ms() / inflags.GetValueInt("iter"));
-        printf("GPU Kernel Time Backward LRN Elapsed: %f ms\n", time);
+        printf("GPU Kernel Time Backward LRN Elapsed: %f ms\n", kernel.mean);
     }
 
     din_dev->FromGPU(GetStream(), din.data());
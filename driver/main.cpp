@@ -23,15 +23,27 @@
  * SOFTWARE.
  *
  *******************************************************************************/
+#include "batch.hpp"
 #include "driver.hpp"
-#include "registry_driver_maker.hpp"
 
 #include <miopen/config.h>
+#include <miopen/env.hpp>
+#include <miopen/stats.hpp>
 #include <miopen/stringutils.hpp>
 
 #include <cstdio>
 #include <iostream>
 
+/// Prints the library performance counters (see miopen/stats.hpp) after the runs.
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DRIVER_PRINT_STATS)
+
+static void PrintStats()
+{
+    // The invoker profile is printed by the library at exit when MIOPEN_INVOKER_PROFILE is set.
+    if(miopen::env::enabled(MIOPEN_DRIVER_PRINT_STATS))
+        std::cout << miopen::stats::Collect();
+}
+
 int main(int argc, char* argv[])
 {
 
@@ -46,67 +58,27 @@ int main(int argc, char* argv[])
         exit(0); // NOLINT (concurrency-mt-unsafe)
     }
 
+    if(base_arg == "batch")
+    {
+        const int rc = RunBatch(argc, argv);
+        PrintStats();
+        return rc;
+    }
+
     // show command
     std::cout << "MIOpenDriver";
     for(int i = 1; i < argc; i++)
         std::cout << " " << argv[i];
     std::cout << std::endl;
 
-    std::shared_ptr<Driver> drv;
-    for(auto f : rdm::GetRegistry())
-    {
-        drv.reset(f(base_arg));
-        if(drv != nullptr)
-            break;
-    }
+    const auto drv = MakeDriver(base_arg);
     if(drv == nullptr)
     {
         printf("Incorrect BaseArg\n");
         exit(0); // NOLINT (concurrency-mt-unsafe)
     }
 
-    drv->AddCmdLineArgs();
-    int rc = drv->ParseCmdLineArgs(argc, argv);
-    if(rc != 0)
-    {
-        std::cout << "ParseCmdLineArgs() FAILED, rc = " << rc << std::endl;
-        return rc;
-    }
-    drv->GetandSetData();
-    rc = drv->AllocateBuffersAndCopy();
-    if(rc != 0)
-    {
-        std::cout << "AllocateBuffersAndCopy() FAILED, rc = " << rc << std::endl;
-        return rc;
-    }
-
-    int fargval =
-        !miopen::StartsWith(base_arg, "CBAInfer") ? drv->GetInputFlags().GetValueInt("forw") : 1;
-    bool bnFwdInVer   = (fargval == 2 && miopen::StartsWith(base_arg, "bnorm"));
-    bool verifyarg    = (drv->GetInputFlags().GetValueInt("verify") == 1);
-    int cumulative_rc = 0; // Do not stop running tests in case of errors.
-
-    if(fargval & 1 || fargval == 0 || bnFwdInVer)
-    {
-        rc = drv->RunForwardGPU();
-        cumulative_rc |= rc;
-        if(rc != 0)
-            std::cout << "RunForwardGPU() FAILED, rc = "
-                      << "0x" << std::hex << rc << std::dec << std::endl;
-        if(verifyarg) // Verify even if Run() failed.
-            cumulative_rc |= drv->VerifyForward();
-    }
-
-    if(fargval != 1)
-    {
-        rc = drv->RunBackwardGPU();
-        cumulative_rc |= rc;
-        if(rc != 0)
-            std::cout << "RunBackwardGPU() FAILED, rc = "
-                      << "0x" << std::hex << rc << std::dec << std::endl;
-        if(verifyarg) // Verify even if Run() failed.
-            cumulative_rc |= drv->VerifyBackward();
-    }
-
-    return cumulative_rc;
+    const int rc = RunDriver(*drv, base_arg, argc, argv);
+    PrintStats();
+    return rc;
 }
@@ -29,6 +29,7 @@
 #include "driver.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 #include "random.hpp"
 #include <cstdint>
 #include <cstdlib>
@@ -354,8 +355,7 @@ int MultiMarginLossDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
 template <typename Tgpu, typename Tref>
 int MultiMarginLossDriver<Tgpu, Tref>::RunForwardGPU()
 {
-    float kernel_total_time = 0;
-    float kernel_first_time = 0;
+    TimingStats kernel_timing;
 
     Timer t;
     START_TIME
@@ -382,9 +382,7 @@ int MultiMarginLossDriver<Tgpu, Tref>::RunForwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
-        kernel_total_time += time;
-        if(i == 0)
-            kernel_first_time = time;
+        kernel_timing.Add(time);
     }
 
     if(inflags.GetValueInt("time") == 1)
@@ -395,8 +393,7 @@ int MultiMarginLossDriver<Tgpu, Tref>::RunForwardGPU()
             std::cout << "Wall-clock Time Forward MultiMarginLoss Elapsed: "
                       << t.gettime_ms() / iter << " ms" << std::endl;
 
-        float kernel_average_time =
-            iter > 1 ? (kernel_total_time - kernel_first_time) / (iter - 1) : kernel_first_time;
+        const auto kernel_average_time = kernel_timing.Summarize().mean;
         std::cout << "GPU Kernel Time Forward MultiMarginLoss Elapsed: " << kernel_average_time
                   << " ms" << std::endl;
     }
@@ -33,6 +33,7 @@
 #include "random.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 #include "util_driver.hpp"
 #include "util_file.hpp"
 
@@ -456,6 +457,7 @@ int PoolDriver_impl<Tgpu, Tref, Index>::RunForwardGPU()
     START_TIME
     int rc = 0;
 
+    TimingStats kernel_timing;
     for(int i = 0; i < inflags.GetValueInt("iter"); i++)
     {
         rc |= miopenPoolingForward(GetHandle(),
@@ -469,19 +471,23 @@ int PoolDriver_impl<Tgpu, Tref, Index>::RunForwardGPU()
                                    do_backward,
                                    mask_dev->GetMem(),
                                    0);
+        if(rc == 0 && inflags.GetValueInt("time") == 1)
+        {
+            float time = 0.0;
+            miopenGetKernelTime(GetHandle(), &time);
+            kernel_timing.Add(time);
+        }
     }
     if(inflags.GetValueInt("time") == 1)
     {
-        float time = 0.0;
-        if(rc == 0)
-            miopenGetKernelTime(GetHandle(), &time);
+        const auto kernel = kernel_timing.Summarize();
 
         STOP_TIME
         if(WALL_CLOCK)
             printf("Wall-clock Time Forward Pooling Elapsed: %f ms\n",
                    t.gettime_ms() / inflags.GetValueInt("iter"));
 
-        printf("GPU Kernel Time Forward Pooling Elapsed: %f ms\n", time);
+        printf("GPU Kernel Time Forward Pooling Elapsed: %f ms\n", kernel.mean);
     }
 
     out_dev->FromGPU(GetStream(), out.data());
@@ -526,6 +532,7 @@ int PoolDriver_impl<Tgpu, Tref, Index>::RunBackwardGPU()
     START_TIME
     int rc = 0;
 
+    TimingStats kernel_timing;
     for(int i = 0; i < inflags.GetValueInt("iter"); i++)
     {
         rc |= miopenPoolingBackward(GetHandle(),
@@ -541,18 +548,22 @@ int PoolDriver_impl<Tgpu, Tref, Index>::RunBackwardGPU()
                                     dInputTensor,
                                     din_dev->GetMem(),
                                     mask_dev->GetMem());
+        if(rc == 0 && inflags.GetValueInt("time") == 1)
+        {
+            float time = 0.0;
+            miopenGetKernelTime(GetHandle(), &time);
+            kernel_timing.Add(time);
+        }
     }
     if(inflags.GetValueInt("time") == 1)
     {
-        float time = 0.0;
-        if(rc == 0)
-            miopenGetKernelTime(GetHandle(), &time);
+        const auto kernel = kernel_timing.Summarize();
 
         STOP_TIME
         if(WALL_CLOCK)
             printf("Wall-clock Time Backward Pooling Elapsed: %f ms\n",
                    t.gettime_ms() / inflags.GetValueInt("iter"));
-        printf("GPU Kernel Time Backward Pooling Elapsed: %f ms\n", time);
+        printf("GPU Kernel Time Backward Pooling Elapsed: %f ms\n", kernel.mean);
     }
 
     din_dev->FromGPU(GetStream(), din.data());
@@ -30,6 +30,7 @@
 #include "mloPReLUHost.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 
 #include <../test/ford.hpp>
 #include <../test/verify.hpp>
@@ -266,8 +267,7 @@ int PReLUDriver<Tgpu, Tref>::RunForwardCPU()
 template <typename Tgpu, typename Tref>
 int PReLUDriver<Tgpu, Tref>::RunBackwardGPU()
 {
-    float kernel_total_time = 0;
-    float kernel_first_time = 0;
+    TimingStats kernel_timing;
 
     Timer t;
     START_TIME
@@ -290,9 +290,7 @@ int PReLUDriver<Tgpu, Tref>::RunBackwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
-        kernel_total_time += time;
-        if(i == 0)
-            kernel_first_time = time;
+        kernel_timing.Add(time);
     }
 
     if(inflags.GetValueInt("time") == 1)
@@ -303,8 +301,7 @@ int PReLUDriver<Tgpu, Tref>::RunBackwardGPU()
             std::cout << "Wall-clock Time Backward PReLU Elapsed: " << t.gettime_ms() / iter
                       << " ms" << std::endl;
 
-        float kernel_average_time =
-            iter > 1 ? (kernel_total_time - kernel_first_time) / (iter - 1) : kernel_first_time;
+        const auto kernel_average_time = kernel_timing.Summarize().mean;
         std::cout << "GPU Kernel Time Backward PReLU Elapsed: " << kernel_average_time << " ms"
                   << std::endl;
     }
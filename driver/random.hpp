@@ -2,10 +2,16 @@
 #define GUARD_RANDOM_GEN_
 
 #include <miopen/env.hpp>
+#include <miopen/par_for.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <random>
+#include <thread>
 
 MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_DEBUG_DRIVER_PRNG_SEED, 12345678)
 
@@ -130,5 +136,145 @@ inline T gen_subnorm()
     }
     return denorm_val;
 }
+
+/// Counter-based Philox4x32-10 generator (Salmon et al., "Parallel Random Numbers: As Easy as
+/// 1, 2, 3"). Unlike get_prng(), the value of the n-th element of a stream is a pure function of
+/// (seed, stream, n), so a buffer can be filled in any order and by any number of threads with
+/// bit-identical results.
+struct philox
+{
+    std::uint64_t key;
+    std::uint64_t stream;
+
+    std::array<std::uint32_t, 4> operator()(std::uint64_t block) const
+    {
+        constexpr std::uint32_t M0 = 0xD2511F53;
+        constexpr std::uint32_t M1 = 0xCD9E8D57;
+        constexpr std::uint32_t W0 = 0x9E3779B9;
+        constexpr std::uint32_t W1 = 0xBB67AE85;
+
+        std::array<std::uint32_t, 4> c = {static_cast<std::uint32_t>(block),
+                                          static_cast<std::uint32_t>(block >> 32),
+                                          static_cast<std::uint32_t>(stream),
+                                          static_cast<std::uint32_t>(stream >> 32)};
+        auto k0 = static_cast<std::uint32_t>(key);
+        auto k1 = static_cast<std::uint32_t>(key >> 32);
+
+        for(int round = 0; round < 10; ++round)
+        {
+            const auto p0 = static_cast<std::uint64_t>(M0) * c[0];
+            const auto p1 = static_cast<std::uint64_t>(M1) * c[2];
+            c[0]          = static_cast<std::uint32_t>(p1 >> 32) ^ c[1] ^ k0;
+            c[1]          = static_cast<std::uint32_t>(p1);
+            c[2]          = static_cast<std::uint32_t>(p0 >> 32) ^ c[3] ^ k1;
+            c[3]          = static_cast<std::uint32_t>(p0);
+            k0 += W0;
+            k1 += W1;
+        }
+        return c;
+    }
+};
+
+namespace details {
+
+constexpr std::size_t block_size = std::size_t{1} << 16;
+
+/// Largest value of the 1- or 2-byte floating point type T below `x`. Steps the sign-magnitude
+/// encoding one unit towards minus infinity, which holds for the half, bfloat16 and fp8 formats.
+template <typename T>
+inline T prev_representable(T x)
+{
+    using BitType = std::conditional_t<sizeof(T) == 1, uint8_t, uint16_t>;
+    static_assert(sizeof(T) == sizeof(BitType));
+    constexpr auto sign = static_cast<BitType>(BitType{1} << (sizeof(T) * 8 - 1));
+
+    BitType bits;
+    std::memcpy(&bits, &x, sizeof(T));
+    if((bits & static_cast<BitType>(~sign)) == 0) // +0 and -0 go to the smallest negative value
+        bits = sign | 1;
+    else if((bits & sign) != 0)
+        ++bits;
+    else
+        --bits;
+    std::memcpy(&x, &bits, sizeof(T));
+    return x;
+}
+
+template <typename T>
+inline T from_bits_A_to_B(std::uint32_t bits, T A, T B)
+{
+    if constexpr(std::is_floating_point_v<T>) // native fp
+    {
+        // 24 bits keep float results strictly below 1, the rest is enough for a test pattern.
+        const auto u = static_cast<T>(bits >> 8) * static_cast<T>(1.0 / (1U << 24));
+        return A + u * (B - A);
+    }
+    else if constexpr(std::is_integral_v<T>)
+    {
+        return static_cast<T>((bits >> 4) % static_cast<std::uint32_t>(B - A)) + A;
+    }
+    else // half/bfloat/etc
+    {
+        // Rounding to the narrow type may reach B, keep the range half-open.
+        const auto value =
+            static_cast<T>(from_bits_A_to_B(bits, static_cast<float>(A), static_cast<float>(B)));
+        return static_cast<float>(value) < static_cast<float>(B) ? value : prev_representable(B);
+    }
+}
+
+} // namespace details
+
+/// Runs `f(first, last)` for the blocks of [0, n) in parallel on `threads` threads, even when that
+/// is more than the number of cores. Before each block the thread-local generator behind
+/// gen_canonical() and friends is reseeded from Philox, so whatever `f` draws from it depends only
+/// on the default seed, `stream` and the block, not on `threads`. The generator of the calling
+/// thread is left as it was.
+template <typename F>
+inline void par_for_blocks(std::size_t n,
+                           std::uint64_t stream,
+                           F f,
+                           std::size_t threads = std::thread::hardware_concurrency())
+{
+    const auto gen    = philox{details::get_default_seed(), stream};
+    const auto blocks = (n + details::block_size - 1) / details::block_size;
+    const auto saved  = details::get_prng();
+
+    miopen::par_for_impl(blocks, std::min(threads, blocks), [&](std::size_t block) {
+        details::get_prng().seed(gen(block)[0]);
+        const auto first = block * details::block_size;
+        f(first, std::min(n, first + details::block_size));
+    });
+
+    details::get_prng() = saved;
+}
+
+/// Fills `data` with uniform values in [A, B) in parallel. Every 4 consecutive elements share one
+/// Philox call, so the result depends only on the default seed and `stream`, regardless of
+/// `threads`.
+template <typename T>
+inline void fill_A_to_B(T* data,
+                        std::size_t n,
+                        T A,
+                        T B,
+                        std::uint64_t stream,
+                        std::size_t threads = std::thread::hardware_concurrency())
+{
+    assert(B > A);
+    const auto gen = philox{details::get_default_seed(), stream};
+
+    par_for_blocks(
+        n,
+        stream,
+        [&](std::size_t first, std::size_t last) {
+            for(auto i = first; i < last; i += 4)
+            {
+                const auto bits  = gen(i / 4);
+                const auto count = std::min<std::size_t>(4, last - i);
+                for(std::size_t j = 0; j < count; ++j)
+                    data[i + j] = details::from_bits_A_to_B(bits[j], A, B);
+            }
+        },
+        threads);
+}
 } // namespace prng
 #endif // GUARD_RANDOM_GEN_
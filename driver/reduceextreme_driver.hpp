@@ -30,6 +30,7 @@
 #include "driver.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 #include "random.hpp"
 #include <algorithm>
 #include <cfloat>
@@ -59,11 +60,8 @@ int32_t mloReduceExtremeForwardRunHost(miopenTensorDescriptor_t xDesc,
                                        int32_t dim)
 {
     auto x_dims = miopen::deref(xDesc).GetLengths();
-    std::vector<std::size_t> indice_dims;
-    if(yhost)
-        indice_dims = miopen::deref(yDesc).GetLengths();
-    else
-        indice_dims = miopen::deref(indiceDesc).GetLengths();
+    const auto& indice_dims =
+        yhost ? miopen::deref(yDesc).GetLengths() : miopen::deref(indiceDesc).GetLengths();
 
     int32_t reduce_size = static_cast<int32_t>(x_dims[dim]);
     auto indice_numel =
@@ -291,8 +289,7 @@ int ReduceExtremeDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
 template <typename Tgpu, typename Tref>
 int ReduceExtremeDriver<Tgpu, Tref>::RunForwardGPU()
 {
-    float kernel_total_time = 0;
-    float kernel_first_time = 0;
+    TimingStats kernel_timing;
 
     Timer t;
     START_TIME
@@ -327,9 +324,7 @@ int ReduceExtremeDriver<Tgpu, Tref>::RunForwardGPU()
 
         float time = 0;
         miopenGetKernelTime(GetHandle(), &time);
-        kernel_total_time += time;
-        if(i == 0)
-            kernel_first_time = time;
+        kernel_timing.Add(time);
     }
 
     if(inflags.GetValueInt("time") == 1)
@@ -340,8 +335,7 @@ int ReduceExtremeDriver<Tgpu, Tref>::RunForwardGPU()
             std::cout << "Wall-clock Time Forward ReduceExtreme Elapsed: " << t.gettime_ms() / iter
                       << " ms" << std::endl;
 
-        float kernel_average_time =
-            iter > 1 ? (kernel_total_time - kernel_first_time) / (iter - 1) : kernel_first_time;
+        const auto kernel_average_time = kernel_timing.Summarize().mean;
         std::cout << "GPU Kernel Time Forward ReduceExtreme Elapsed: " << kernel_average_time
                   << " ms" << std::endl;
     }
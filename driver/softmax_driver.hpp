@@ -32,8 +32,10 @@
 #include "random.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 #include "util_driver.hpp"
 
+#include <../test/verification_cache.hpp>
 #include <../test/verify.hpp>
 
 #include <miopen/miopen.h>
@@ -44,6 +46,7 @@
 #include <cstdlib>
 #include <memory>
 #include <numeric>
+#include <sstream>
 #include <vector>
 
 template <typename Tgpu, typename Tref>
@@ -167,6 +170,11 @@ int SoftmaxDriver<Tgpu, Tref>::AddCmdLineArgs()
         "mode", 'm', "1", "instance mode (0), channel mode (1) (Default=1)", "int");
     inflags.AddInputFlag("iter", 'i', "10", "Number of Iterations (Default=10)", "int");
     inflags.AddInputFlag("verify", 'V', "1", "Verify Each Layer (Default=1)", "int");
+    inflags.AddInputFlag("verification_cache",
+                         'C',
+                         "",
+                         "Use specified directory to cache verification data. Off by default.",
+                         "string");
     inflags.AddInputFlag("time", 't', "0", "Time Each Layer (Default=0)", "int");
     inflags.AddInputFlag(
         "wall", 'w', "0", "Wall-clock Time Each Layer, Requires time == 1 (Default=0)", "int");
@@ -248,9 +256,8 @@ int SoftmaxDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
 template <typename Tgpu, typename Tref>
 int SoftmaxDriver<Tgpu, Tref>::RunForwardGPU()
 {
-    float kernel_total_time = 0.0;
-    float kernel_first_time = 0.0;
-    float wall_first_time   = 0.0;
+    TimingStats kernel_timing;
+    float wall_first_time = 0.0;
 
     Timer t;
     START_TIME
@@ -269,10 +276,9 @@ int SoftmaxDriver<Tgpu, Tref>::RunForwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
-        kernel_total_time += time;
+        kernel_timing.Add(time);
         if(i == 0)
         {
-            kernel_first_time = time;
             STOP_TIME
             wall_first_time = t.gettime_ms();
             START_TIME
@@ -283,12 +289,11 @@ int SoftmaxDriver<Tgpu, Tref>::RunForwardGPU()
     {
         STOP_TIME
         int iter           = inflags.GetValueInt("iter");
-        auto gpu_time      = kernel_first_time;
+        auto gpu_time      = kernel_timing.Summarize().mean;
         auto wall_time     = wall_first_time;
         auto aux_wall_time = 0.0f;
         if(iter > 1)
         {
-            gpu_time      = (kernel_total_time - kernel_first_time) / (iter - 1);
             wall_time     = t.gettime_ms() / (iter - 1);
             aux_wall_time = wall_first_time - wall_time;
         }
@@ -317,9 +322,8 @@ int SoftmaxDriver<Tgpu, Tref>::RunForwardCPU()
 template <typename Tgpu, typename Tref>
 int SoftmaxDriver<Tgpu, Tref>::RunBackwardGPU()
 {
-    float kernel_total_time = 0.0;
-    float kernel_first_time = 0.0;
-    float wall_first_time   = 0.0;
+    TimingStats kernel_timing;
+    float wall_first_time = 0.0;
 
     Timer t;
     START_TIME
@@ -340,10 +344,9 @@ int SoftmaxDriver<Tgpu, Tref>::RunBackwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
-        kernel_total_time += time;
+        kernel_timing.Add(time);
         if(i == 0)
         {
-            kernel_first_time = time;
             STOP_TIME
             wall_first_time = t.gettime_ms();
             START_TIME
@@ -354,12 +357,11 @@ int SoftmaxDriver<Tgpu, Tref>::RunBackwardGPU()
     {
         STOP_TIME
         int iter           = inflags.GetValueInt("iter");
-        auto gpu_time      = kernel_first_time;
+        auto gpu_time      = kernel_timing.Summarize().mean;
         auto wall_time     = wall_first_time;
         auto aux_wall_time = 0.0f;
         if(iter > 1)
         {
-            gpu_time      = (kernel_total_time - kernel_first_time) / (iter - 1);
             wall_time     = t.gettime_ms() / (iter - 1);
             aux_wall_time = wall_first_time - wall_time;
         }
@@ -382,8 +384,20 @@ int SoftmaxDriver<Tgpu, Tref>::RunBackwardGPU()
 template <typename Tgpu, typename Tref>
 int SoftmaxDriver<Tgpu, Tref>::VerifyForward()
 {
-    mloSoftmaxForwardRunHost<Tgpu, Tref>(
-        inputTensor, outputTensor, in.data(), outhost.data(), alpha, beta, algo, mode);
+    // Backward reference consumes the GPU output, so only forward results are cacheable.
+    std::ostringstream problem;
+    miopen::LogRange(problem, GetTensorLengths(inputTensor), "x");
+    problem << "_" << alpha << "_" << beta << "_" << algo << "_" << mode << "_GPU"
+            << miopen::type_name<Tgpu>();
+
+    verification_cache::LoadOrCompute(
+        verification_cache::Store{inflags.GetValueStr("verification_cache")},
+        verification_cache::Key::Make<Tref>("softmax_fwd", problem.str()).AddInput(in),
+        outhost,
+        [&]() {
+            mloSoftmaxForwardRunHost<Tgpu, Tref>(
+                inputTensor, outputTensor, in.data(), outhost.data(), alpha, beta, algo, mode);
+        });
 
     auto error           = miopen::rms_range(outhost, out);
     const Tref tolerance = data_type == miopenHalf ? 5e-2 : 1e-3; // 1e-6;
@@ -32,6 +32,7 @@
 #include "random.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 #include "util_driver.hpp"
 
 #include <miopen/float_equal.hpp>
@@ -253,12 +254,11 @@ int TensorOpDriver<Tgpu, Tref>::RunForwardGPU()
     float fbeta       = static_cast<float>(beta);
     float ftensor_val = static_cast<float>(tensor_val);
 
-    int iters       = inflags.GetValueInt("iter");
-    double fulltime = 0;
-    float avgtime   = 0.0f;
-    float min_time  = 100000000.0f;
+    int iters = inflags.GetValueInt("iter");
 
     Timer t;
+    TimingStats wall_timing;
+    TimingStats kernel_timing;
 
     for(int i = 0; i < iters; ++i)
     {
@@ -285,33 +285,30 @@ int TensorOpDriver<Tgpu, Tref>::RunForwardGPU()
 
         STOP_TIME
         if(WALL_CLOCK)
-        {
-            if(iters > 1)
-                fulltime += t.gettime_ms();
-            else if(iters == 1)
-                fulltime = t.gettime_ms();
-        }
+            wall_timing.Add(t.gettime_ms());
         if(inflags.GetValueInt("time") == 1)
         {
             float time = 0.0;
             miopenGetKernelTime(GetHandle(), &time);
-            min_time = (time < min_time) ? time : min_time;
-            if(iters > 1)
-                avgtime += time;
+            kernel_timing.Add(time);
         }
     }
 
     if(WALL_CLOCK)
-        printf("Wall-clock Time Tensor Ops Elapsed: %f ms, for %d iterations.\n",
-               (iters == 1) ? t.gettime_ms() : (fulltime / float(iters - 1)),
-               (iters > 1) ? iters - 1 : 1);
+    {
+        const auto wall = wall_timing.Summarize();
+        printf("Wall-clock Time Tensor Ops Elapsed: %f ms, for %zu iterations.\n",
+               wall.mean,
+               wall.samples);
+    }
     if(inflags.GetValueInt("time") == 1)
     {
-        printf("GPU Kernel Min Time Tensor Op Elapsed: %f ms\n", min_time);
+        const auto kernel = kernel_timing.Summarize();
+        printf("GPU Kernel Min Time Tensor Op Elapsed: %f ms\n", kernel.min);
         if(iters > 1)
-            printf("GPU Kernel Avg Time Tensor Op Elapsed: %f ms, for %d iterations.\n",
-                   avgtime / (iters - 1),
-                   iters - 1);
+            printf("GPU Kernel Avg Time Tensor Op Elapsed: %f ms, for %zu iterations.\n",
+                   kernel.mean,
+                   kernel.samples);
         int in_n, in_c, in_h, in_w;
         std::tie(in_n, in_c, in_h, in_w) = miopen::tien<4>(miopen::deref(aTensor).GetLengths());
         size_t dataSz =
@@ -321,8 +318,8 @@ int TensorOpDriver<Tgpu, Tref>::RunForwardGPU()
         printf("stats: tensor op, %zu, %zu, %f, %f\n",
                3 * dataSz,
                dataSz,
-               4 * dataSz / min_time / 1e6,
-               avgtime / (iters - 1));
+               4 * dataSz / kernel.min / 1e6,
+               kernel.mean);
     }
     if(!is_set && !is_scale)
         c_dev->FromGPU(GetStream(), c.data());
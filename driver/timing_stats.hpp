@@ -0,0 +1,234 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_DRIVER_TIMING_STATS_HPP
+#define GUARD_MIOPEN_DRIVER_TIMING_STATS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <numeric>
+#include <ostream>
+#include <string>
+#include <vector>
+
+struct TimingOptions
+{
+    int min_iterations = 1;
+    /// Warm up until the times stabilize, then run until the confidence interval target is met.
+    bool adaptive      = false;
+    int max_iterations = 1000;
+    /// Target half-width of the 95% confidence interval of the mean, in percents of the mean.
+    double ci_percent = 1.0;
+};
+
+struct TimingSummary
+{
+    std::size_t iterations = 0;
+    std::size_t warmup     = 0;
+    std::size_t samples    = 0;
+    std::size_t outliers   = 0;
+    double min             = 0.0;
+    double median          = 0.0;
+    double p90             = 0.0;
+    double p99             = 0.0;
+    double mean            = 0.0;
+    double stddev          = 0.0;
+    double ci95            = 0.0;
+    /// Mean of the samples within Tukey's fences.
+    double trimmed_mean = 0.0;
+};
+
+/// Collects per-iteration times and decides how many iterations to run.
+///
+/// Without adaptive timing, the first iteration is the warm-up one, like in the
+/// averages the drivers print. Adaptive timing keeps warming up until the last
+/// `window` times vary by less than `stable_cv`, and then keeps iterating until
+/// the 95% confidence interval of the mean is narrow enough.
+///
+/// Every driver records its per-iteration times here. Only the convolution driver owns the
+/// '--adaptive_iter' family of flags; the others run their fixed '--iter' loops.
+class TimingStats
+{
+public:
+    static constexpr std::size_t window      = 5;
+    static constexpr std::size_t max_warmup  = 50;
+    static constexpr double stable_cv        = 0.05;
+    static constexpr std::size_t min_samples = 5;
+
+    void Reset(const TimingOptions& options_)
+    {
+        options = options_;
+        times.clear();
+        warmup     = 0;
+        iterations = 0;
+        warming_up = true;
+    }
+
+    void Add(double time)
+    {
+        times.push_back(time);
+        if(!warming_up)
+            return;
+        if(!options.adaptive)
+        {
+            warmup     = 1;
+            warming_up = false;
+        }
+        else if(times.size() >= window && Cv(times.end() - window, times.end()) < stable_cv)
+        {
+            warmup     = times.size() - window;
+            warming_up = false;
+        }
+        else if(times.size() >= max_warmup)
+        {
+            warmup     = times.size();
+            warming_up = false;
+        }
+    }
+
+    /// Tells whether one more iteration is needed after `done` iterations.
+    bool Continue(int done)
+    {
+        iterations = done;
+        if(done < options.min_iterations)
+            return true;
+        if(!options.adaptive || times.empty() || done >= options.max_iterations)
+            return false;
+        if(warming_up || Samples() < min_samples)
+            return true;
+        const auto summary = Summarize();
+        return summary.ci95 > summary.mean * options.ci_percent / 100.0;
+    }
+
+    int Iterations() const { return iterations; }
+
+    TimingSummary Summarize() const
+    {
+        TimingSummary summary;
+        summary.iterations = iterations;
+        if(times.empty())
+            return summary;
+
+        // When all the iterations were warm-up ones, report them rather than nothing.
+        summary.warmup = times.size() > warmup ? warmup : 0;
+        auto sorted = std::vector<double>(times.begin() + summary.warmup, times.end());
+        std::sort(sorted.begin(), sorted.end());
+        const auto n = sorted.size();
+
+        summary.samples = n;
+        summary.min     = sorted.front();
+        summary.median  = Percentile(sorted, 50);
+        summary.p90     = Percentile(sorted, 90);
+        summary.p99     = Percentile(sorted, 99);
+        summary.mean    = std::accumulate(sorted.begin(), sorted.end(), 0.0) / n;
+        summary.stddev  = Stddev(sorted.begin(), sorted.end(), summary.mean);
+        summary.ci95    = 1.96 * summary.stddev / std::sqrt(static_cast<double>(n));
+
+        const auto q1    = Percentile(sorted, 25);
+        const auto q3    = Percentile(sorted, 75);
+        const auto fence = 1.5 * (q3 - q1);
+        double sum       = 0.0;
+        std::size_t kept = 0;
+        for(const auto time : sorted)
+        {
+            if(time < q1 - fence || time > q3 + fence)
+                continue;
+            sum += time;
+            ++kept;
+        }
+        summary.outliers     = n - kept;
+        summary.trimmed_mean = kept == 0 ? summary.mean : sum / kept;
+        return summary;
+    }
+
+private:
+    std::size_t Samples() const { return times.size() > warmup ? times.size() - warmup : 0; }
+
+    /// Nearest-rank percentile of sorted values.
+    static double Percentile(const std::vector<double>& sorted, double percentile)
+    {
+        const auto rank = static_cast<std::size_t>(std::ceil(percentile / 100.0 * sorted.size()));
+        return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+    }
+
+    template <class It>
+    static double Stddev(It begin, It end, double mean)
+    {
+        const auto n = std::distance(begin, end);
+        if(n < 2)
+            return 0.0;
+        double sum = 0.0;
+        for(auto it = begin; it != end; ++it)
+            sum += (*it - mean) * (*it - mean);
+        return std::sqrt(sum / (n - 1));
+    }
+
+    template <class It>
+    static double Cv(It begin, It end)
+    {
+        const auto mean = std::accumulate(begin, end, 0.0) / std::distance(begin, end);
+        return mean == 0.0 ? 0.0 : Stddev(begin, end, mean) / mean;
+    }
+
+    TimingOptions options;
+    std::vector<double> times;
+    std::size_t warmup = 0;
+    int iterations     = 0;
+    bool warming_up    = true;
+};
+
+inline void PrintTimingSummary(std::ostream& os, const std::string& name, const TimingSummary& s)
+{
+    const auto flags     = os.flags();
+    const auto precision = os.precision();
+    os << std::fixed << std::setprecision(6) << "GPU Kernel Time " << name
+       << " Statistics: iterations " << s.iterations << " (warm-up " << s.warmup
+       << "), min " << s.min << " ms, median " << s.median << " ms, p90 " << s.p90
+       << " ms, p99 " << s.p99 << " ms, mean " << s.mean << " ms, stddev " << s.stddev
+       << " ms, 95% CI +-" << s.ci95 << " ms, outliers " << s.outliers << std::endl;
+    os.flags(flags);
+    os.precision(precision);
+}
+
+/// One line of JSON, prefixed with "timing: " so that it can be picked from the driver output.
+inline void PrintTimingJson(std::ostream& os, const std::string& name, const TimingSummary& s)
+{
+    const auto flags     = os.flags();
+    const auto precision = os.precision();
+    os << std::setprecision(9) << "timing: {\"name\": \"" << name
+       << "\", \"iterations\": " << s.iterations << ", \"warmup\": " << s.warmup
+       << ", \"samples\": " << s.samples << ", \"min_ms\": " << s.min
+       << ", \"median_ms\": " << s.median << ", \"p90_ms\": " << s.p90
+       << ", \"p99_ms\": " << s.p99 << ", \"mean_ms\": " << s.mean
+       << ", \"stddev_ms\": " << s.stddev << ", \"ci95_ms\": " << s.ci95
+       << ", \"outliers\": " << s.outliers << ", \"trimmed_mean_ms\": " << s.trimmed_mean << "}"
+       << std::endl;
+    os.flags(flags);
+    os.precision(precision);
+}
+
+#endif // GUARD_MIOPEN_DRIVER_TIMING_STATS_HPP
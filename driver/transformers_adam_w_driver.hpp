@@ -31,6 +31,7 @@
 #include "random.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
+#include "timing_stats.hpp"
 
 #include "../test/verify.hpp"
 
@@ -321,8 +322,7 @@ int TransformersAdamWDriver<Tgpu, Tref, Tgrad>::AllocateBuffersAndCopy()
 template <typename Tgpu, typename Tref, typename Tgrad>
 int TransformersAdamWDriver<Tgpu, Tref, Tgrad>::RunForwardGPU()
 {
-    float kernel_total_time = 0;
-    float kernel_first_time = 0;
+    TimingStats kernel_timing;
 
     void* grad_scale_ptr = is_amp ? scale_dev->GetMem() : nullptr;
     void* found_inf_ptr  = is_amp ? found_inf_dev->GetMem() : nullptr;
@@ -369,9 +369,7 @@ int TransformersAdamWDriver<Tgpu, Tref, Tgrad>::RunForwardGPU()
 
         float time = 0.0;
         miopenGetKernelTime(GetHandle(), &time);
-        kernel_total_time += time;
-        if(i == 0)
-            kernel_first_time = time;
+        kernel_timing.Add(time);
     }
 
     if(inflags.GetValueInt("time") == 1)
@@ -380,8 +378,7 @@ int TransformersAdamWDriver<Tgpu, Tref, Tgrad>::RunForwardGPU()
         if(WALL_CLOCK)
             printf("Wall-clock Time Forward Adam Elapsed: %f ms\n", t.gettime_ms() / iter);
 
-        float kernel_average_time =
-            iter > 1 ? (kernel_total_time - kernel_first_time) / (iter - 1) : kernel_first_time;
+        const auto kernel_average_time = kernel_timing.Summarize().mean;
         printf("GPU Kernel Time Forward Adam Elapsed: %f ms\n", kernel_average_time);
     }
 
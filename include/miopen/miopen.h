@@ -266,6 +266,21 @@ MIOPEN_EXPORT miopenStatus_t miopenGetKernelTime(miopenHandle_t handle, float* t
  * @return           miopenStatus_t
  */
 MIOPEN_EXPORT miopenStatus_t miopenEnableProfiling(miopenHandle_t handle, bool enable);
+
+#ifdef MIOPEN_BETA_API
+/*! @brief Starts the one-time initialization of the library in the background
+ *
+ * The library builds its solver registry, loads the system databases and the TunaNet model
+ * lazily, which makes the first convolution call of a process slow. This function starts that
+ * work on background threads, so that it overlaps with the setup done by the application.
+ * miopenDestroy waits for the background work to finish. Setting the MIOPEN_WARM_START
+ * environment variable makes miopenCreate and miopenCreateWithStream call this function.
+ *
+ * @param handle     MIOpen handle (input)
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenWarmStart(miopenHandle_t handle);
+#endif
 /** @} */
 // CLOSEOUT HANDLE DOXYGEN GROUP
 
@@ -6062,6 +6077,52 @@ MIOPEN_EXPORT miopenStatus_t miopenGetSolverIdConvAlgorithm(uint64_t solverId,
 
 #ifdef MIOPEN_BETA_API
 
+/*! @brief The miopenBoundSolution object describes a solution with fixed tensor descriptors.
+ */
+MIOPEN_DECLARE_OBJECT(miopenBoundSolution);
+
+/*! @brief Binds a solution to a fixed set of tensor arguments.
+ *
+ * Descriptors are resolved and validated once, so that miopenRunBoundSolution only needs buffer
+ * pointers. Buffers provided here are ignored. The solution may be destroyed after binding.
+ *
+ * @param boundSolution Pointer to a location where to write the bound solution
+ * @param solution      Solution to bind
+ * @param nInputs       Amount of tensor arguments
+ * @param tensors       Tensor arguments. Descriptors may be null to use the ones of the problem.
+ * @return              miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenBindSolution(miopenBoundSolution_t* boundSolution,
+                                                miopenSolution_t solution,
+                                                size_t nInputs,
+                                                const miopenTensorArgument_t* tensors);
+
+/*! @brief Runs a bound solution.
+ *
+ * Runs update the buffer pointers stored in the bound solution, so a bound solution must not be
+ * run from several threads at once. It runs on the handle of its first run; other handles are
+ * rejected with miopenStatusBadParm. Bind the solution once per thread or handle instead.
+ *
+ * @param handle        MIOpen handle
+ * @param boundSolution Bound solution to run
+ * @param buffers       Buffers in the order of the tensor arguments used in miopenBindSolution
+ * @param workspace     Pointer to device buffer used as workspace. May be null when not required.
+ * @param workspaceSize Size of the workspace buffer
+ * @return              miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenRunBoundSolution(miopenHandle_t handle,
+                                                    miopenBoundSolution_t boundSolution,
+                                                    void* const* buffers,
+                                                    void* workspace,
+                                                    size_t workspaceSize);
+
+/*! @brief Destroys a bound solution object.
+ *
+ * @param boundSolution Bound solution to destroy
+ * @return              miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenDestroyBoundSolution(miopenBoundSolution_t boundSolution);
+
 /*! @brief Initializes a problem object describing an activation operation.
  * @note As of now there is no way to actually get any solution for this kind of problems.
  *
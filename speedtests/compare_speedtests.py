@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+###############################################################################
+#
+# MIT License
+#
+# Copyright (c) 2024 Advanced Micro Devices, Inc.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+#################################################################################
+"""Compares speedtest results in the Google Benchmark JSON format against a baseline"""
+import os
+import sys
+import json
+import shutil
+import argparse
+
+TIME_UNITS = {'ns': 1.0, 'us': 1e3, 'ms': 1e6, 's': 1e9}
+
+
+def parse_args():
+  """Function to parse cmd line arguments"""
+  parser = argparse.ArgumentParser()
+  parser.add_argument('baseline', type=str, help='Baseline results JSON')
+  parser.add_argument('current', type=str, help='Current results JSON')
+  parser.add_argument('--threshold',
+                      dest='threshold',
+                      type=float,
+                      default=10.0,
+                      help='Slowdown in percent which counts as a regression')
+  parser.add_argument('--update',
+                      dest='update',
+                      action='store_true',
+                      help='Replace the baseline with the current results')
+  return parser.parse_args()
+
+
+def load_results(path):
+  """Returns benchmark name -> time in nanoseconds, None if not recorded"""
+  with open(path, encoding='utf-8') as file:
+    data = json.load(file)
+  results = {}
+  for bench in data.get('benchmarks', []):
+    time = bench.get('real_time')
+    unit = TIME_UNITS[bench.get('time_unit', 'ns')]
+    results[bench['name']] = None if time is None else time * unit
+  return results
+
+
+def compare(baseline, current, threshold):
+  """Prints a comparison table and returns the names of regressed benchmarks"""
+  regressions = []
+  print(f"{'benchmark':<28}{'baseline ns':>14}{'current ns':>14}{'change':>10}")
+  for name, time in current.items():
+    base = baseline.get(name)
+    if base is None or base <= 0:
+      print(f"{name:<28}{'-':>14}{time:>14.1f}{'new':>10}")
+      continue
+    change = (time - base) / base * 100.0
+    mark = ''
+    if change > threshold:
+      mark = '  REGRESSION'
+      regressions.append(name)
+    print(f"{name:<28}{base:>14.1f}{time:>14.1f}{change:>+9.1f}%{mark}")
+  for name in baseline:
+    if name not in current:
+      print(f"{name:<28}{'missing from current results':>38}")
+  return regressions
+
+
+def main():
+  """Main function"""
+  args = parse_args()
+
+  if args.update:
+    shutil.copyfile(args.current, args.baseline)
+    print(f"Baseline {args.baseline} updated")
+    return 0
+
+  if not os.path.exists(args.baseline):
+    print(f"No baseline at {args.baseline}; record one on the reference machine "
+          f"with --update")
+    return 1
+
+  regressions = compare(load_results(args.baseline),
+                        load_results(args.current), args.threshold)
+  if regressions:
+    print(f"{len(regressions)} benchmark(s) slower than the baseline by more "
+          f"than {args.threshold}%: {', '.join(regressions)}")
+    return 1
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
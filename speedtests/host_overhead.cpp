@@ -0,0 +1,281 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/conv/solvers.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/db.hpp>
+#include <miopen/db_record.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/find_db.hpp>
+#include <miopen/find_solution.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/invoker_cache.hpp>
+#include <miopen/perf_field.hpp>
+#include <miopen/tensor.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <driver.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace miopen {
+namespace host_overhead {
+
+struct BenchmarkResult
+{
+    std::string name;
+    std::size_t iterations;
+    double ns_per_op;
+};
+
+/// Measures the host-side costs which dominate the latency of small operations on the
+/// nogpu build. Each benchmark runs for at least `min_time` seconds, growing the
+/// iteration count like Google Benchmark does, and reports nanoseconds per operation.
+/// With `--json <file>` the results are written in the Google Benchmark JSON format,
+/// which is what compare_speedtests.py reads.
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(mode_str, "mode");
+        add(min_time, "min_time");
+        add(json_path, "json");
+    }
+
+    void run()
+    {
+        const auto x    = TensorDescriptor{miopenHalf, {16, 64, 56, 56}};
+        const auto w    = TensorDescriptor{miopenHalf, {64, 64, 3, 3}};
+        const auto y    = TensorDescriptor{miopenHalf, {16, 64, 56, 56}};
+        const auto conv = ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}};
+
+        const auto problem = conv::ProblemDescription{x, w, y, conv, conv::Direction::Forward};
+        const auto network_config = problem.MakeNetworkConfig().ToString();
+
+        Measure("problem", [&]() {
+            const auto p = conv::ProblemDescription{x, w, y, conv, conv::Direction::Forward};
+            return p.GetInChannels();
+        });
+
+        Measure("network_config", [&]() { return problem.MakeNetworkConfig().ToString().size(); });
+
+        {
+            // A handful of neighbouring configs so that lookups do not hit a one-item map.
+            auto cache          = InvokerCache{};
+            const auto invoker  = Invoker{[](const Handle&, const AnyInvokeParams&) {}};
+            const auto solver   = std::string{"ConvDirectNaiveConvFwd"};
+            const auto hit_key  = InvokerCache::Key{network_config, solver};
+            const auto miss_key = InvokerCache::Key{network_config, "ConvDirectNaiveConvBwd"};
+            for(auto n = 1; n <= 64; n++)
+            {
+                const auto other = TensorDescriptor{
+                    miopenHalf, std::vector<std::size_t>{static_cast<std::size_t>(n), 64, 56, 56}};
+                const auto p =
+                    conv::ProblemDescription{other, w, other, conv, conv::Direction::Forward};
+                cache.Register({p.MakeNetworkConfig().ToString(), solver}, invoker);
+            }
+            cache.SetAsFound1_0(network_config, "miopenConvolutionFwdAlgoDirect", solver);
+
+            Measure("invoker_cache_hit", [&]() { return cache[hit_key] ? 1 : 0; });
+            Measure("invoker_cache_miss", [&]() { return cache[miss_key] ? 1 : 0; });
+            Measure("invoker_cache_find_1_0", [&]() {
+                return cache.GetFound1_0(network_config, "miopenConvolutionFwdAlgoDirect") ? 1
+                                                                                           : 0;
+            });
+        }
+
+        {
+            auto record = DbRecord{DbKinds::FindDb, problem};
+            Measure("db_record_serialize", [&]() {
+                return record.SetValues("miopenConvolutionFwdAlgoDirect",
+                                        FindDbData{0.5f, 1024, "ConvDirectNaiveConvFwd"})
+                           ? 1
+                           : 0;
+            });
+            Measure("db_record_parse", [&]() {
+                auto data = FindDbData{};
+                return record.GetValues("miopenConvolutionFwdAlgoDirect", data) ? data.workspace
+                                                                                  : 0;
+            });
+        }
+
+        {
+            const auto handle = Handle{};
+            const TmpDir tmp{"host_overhead"};
+            const auto db_path = tmp / "host_overhead.fdb.txt";
+            {
+                auto record = DbRecord{DbKinds::FindDb, problem};
+                record.SetValues("miopenConvolutionFwdAlgoDirect",
+                                 FindDbData{0.5f, 1024, "ConvDirectNaiveConvFwd"});
+                PlainTextDb{DbKinds::FindDb, db_path}.StoreRecord(record);
+            }
+
+            const auto cached_override = debug::testing_find_db_path_override();
+            debug::testing_find_db_path_override() = db_path;
+            Measure("find_db_fetch", [&]() {
+                const FindDbRecord record{handle, problem};
+                return record.empty() ? 0 : 1;
+            });
+            debug::testing_find_db_path_override() = cached_override;
+
+            // The direct solvers scanned by mlo_dir_conv.cpp.
+            auto solvers = solver::SolverContainer<solver::conv::ConvAsm3x3U,
+                                                   solver::conv::ConvAsm1x1U,
+                                                   solver::conv::ConvAsm1x1UV2,
+                                                   solver::conv::ConvAsm5x10u2v2f1,
+                                                   solver::conv::ConvAsm7x7c3h224w224k64u2v2p3q3f1,
+                                                   solver::conv::ConvAsm5x10u2v2b1,
+                                                   solver::conv::ConvOclDirectFwd11x11,
+                                                   solver::conv::ConvOclDirectFwdGen,
+                                                   solver::conv::ConvOclDirectFwd1x1,
+                                                   solver::conv::ConvOclDirectFwd,
+                                                   solver::conv::ConvDirectNaiveConvFwd,
+                                                   solver::conv::ConvDirectNaiveConvBwd,
+                                                   solver::conv::ConvDirectNaiveConvWrw>{};
+            const auto ctx = ExecutionContext{&handle};
+            Measure("applicability", [&]() {
+                std::size_t applicable = 0;
+                solvers.Foreach([&](auto s) {
+                    if(s.IsApplicable(ctx, problem))
+                        ++applicable;
+                });
+                return applicable;
+            });
+        }
+
+        if(results.empty())
+        {
+            std::cerr << "Unknown mode." << std::endl;
+            std::exit(-1); // NOLINT (concurrency-mt-unsafe)
+        }
+
+        if(!json_path.empty())
+            WriteJson();
+    }
+
+    void show_help()
+    {
+        test_driver::show_help();
+        std::cout << "Permitted modes: all, problem, network_config, invoker_cache_hit, "
+                     "invoker_cache_miss, invoker_cache_find_1_0, db_record_serialize, "
+                     "db_record_parse, find_db_fetch, applicability"
+                  << std::endl;
+    }
+
+private:
+    std::string mode_str  = "all";
+    double min_time       = 0.5;
+    std::string json_path = "";
+    std::vector<BenchmarkResult> results;
+
+    template <class TType>
+    void SaveDeadCode(const TType& value) const
+    {
+        static const std::string dead_code_saver;
+
+        if(dead_code_saver.data() == nullptr)
+        {
+            std::cout << value << std::endl;
+            std::terminate();
+        }
+    }
+
+    template <class TBody>
+    void Measure(const std::string& name, const TBody& body)
+    {
+        if(mode_str != "all" && mode_str != name)
+            return;
+
+        using Seconds = std::chrono::duration<double>;
+
+        std::size_t sum        = 0;
+        std::size_t iterations = 1;
+        auto elapsed           = Seconds{};
+
+        for(;;)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for(std::size_t i = 0; i < iterations; i++)
+                sum += body();
+            elapsed = std::chrono::steady_clock::now() - start;
+
+            if(elapsed.count() >= min_time || iterations >= max_iterations)
+                break;
+
+            // Aim slightly past the target and never grow by more than 10x per step.
+            const auto scale = elapsed.count() > 0 ? 1.4 * min_time / elapsed.count() : 10.0;
+            const auto next = static_cast<std::size_t>(iterations * std::clamp(scale, 2.0, 10.0));
+            iterations      = std::min(next, max_iterations);
+        }
+
+        const auto ns_per_op = elapsed.count() * 1e9 / iterations;
+        std::cout << std::left << std::setw(28) << name << std::right << std::setw(12)
+                  << std::fixed << std::setprecision(1) << ns_per_op << " ns" << std::setw(14)
+                  << iterations << " iterations" << std::defaultfloat << std::endl;
+        results.push_back({name, iterations, ns_per_op});
+
+        SaveDeadCode(sum); // required in release builds
+    }
+
+    void WriteJson() const
+    {
+        std::ofstream out(json_path);
+        if(!out)
+        {
+            std::cerr << "Unable to open " << json_path << std::endl;
+            std::exit(-1); // NOLINT (concurrency-mt-unsafe)
+        }
+
+        out << "{\n  \"context\": {\"executable\": \"" << program_name
+            << "\", \"min_time\": " << min_time << "},\n  \"benchmarks\": [";
+        for(auto i = 0u; i < results.size(); i++)
+        {
+            const auto& r = results[i];
+            out << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << r.name
+                << "\", \"iterations\": " << r.iterations << ", \"real_time\": " << std::fixed
+                << std::setprecision(2) << r.ns_per_op << std::defaultfloat
+                << ", \"time_unit\": \"ns\"}";
+        }
+        out << "\n  ]\n}\n";
+    }
+
+    static constexpr std::size_t max_iterations = std::size_t{1} << 30;
+};
+} // namespace host_overhead
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::host_overhead::SpeedTestDriver>(argc, argv);
+    return 0;
+}
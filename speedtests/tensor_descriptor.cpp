@@ -0,0 +1,183 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/problem.hpp>
+#include <miopen/solution.hpp>
+#include <miopen/solver_id.hpp>
+#include <miopen/tensor.hpp>
+
+#include <driver.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <array>
+#include <string>
+
+namespace miopen {
+namespace tensor_descriptor {
+
+enum class Modes
+{
+    Copy,
+    Problem,
+    RunSolution,
+    Unknown,
+};
+
+/// Measures the host cost of the paths which copy tensor descriptors around: plain copies,
+/// convolution problem construction and the argument handling done by miopenRunSolution.
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(iterations, "iterations");
+        add(mode_str, "mode");
+    }
+
+    void run()
+    {
+        const auto x    = TensorDescriptor{miopenHalf, {16, 64, 56, 56}};
+        const auto w    = TensorDescriptor{miopenHalf, {64, 64, 3, 3}};
+        const auto y    = TensorDescriptor{miopenHalf, {16, 64, 56, 56}};
+        const auto conv = ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}};
+
+        switch(ParseMode(mode_str))
+        {
+        case Modes::Copy:
+            TestCore([&]() {
+                auto copy = x;
+                return copy.GetLengths()[1];
+            });
+            break;
+        case Modes::Problem:
+            TestCore([&]() {
+                const auto problem =
+                    conv::ProblemDescription{x, w, y, conv, conv::Direction::Forward};
+                return problem.GetInChannels();
+            });
+            break;
+        case Modes::RunSolution: {
+            // The invoker does nothing, so only the host part of the call is measured.
+            auto problem = Problem{};
+            problem.SetDirection(miopenProblemDirectionForward);
+            problem.SetOperatorDescriptor(conv);
+            problem.RegisterTensorDescriptor(miopenTensorConvolutionX, x);
+            problem.RegisterTensorDescriptor(miopenTensorConvolutionW, w);
+            problem.RegisterTensorDescriptor(miopenTensorConvolutionY, y);
+
+            auto solution = Solution{solver::Id{"ConvDirectNaiveConvFwd"}, 0.0f, 0};
+            solution.SetProblem({problem});
+            solution.SetInvoker(Invoker{[](const Handle&, const AnyInvokeParams&) {}});
+
+            auto handle = Handle{};
+            auto x_desc = x;
+            auto w_desc = w;
+            auto y_desc = y;
+            // Descriptors are passed like applications do, overriding the ones of the problem.
+            auto descriptors = std::array<miopenTensorDescriptor_t, 3>{&x_desc, &w_desc, &y_desc};
+            const auto tensors = std::array<miopenTensorArgument_t, 3>{
+                {{miopenTensorConvolutionX, &descriptors[0], nullptr},
+                 {miopenTensorConvolutionW, &descriptors[1], nullptr},
+                 {miopenTensorConvolutionY, &descriptors[2], nullptr}}};
+            TestCore([&]() {
+                return miopenRunSolution(
+                    &handle, &solution, tensors.size(), tensors.data(), nullptr, 0);
+            });
+            break;
+        }
+        case Modes::Unknown:
+            std::cerr << "Unknown mode." << std::endl;
+            std::exit(-1); // NOLINT (concurrency-mt-unsafe)
+        }
+    }
+
+    void show_help()
+    {
+        test_driver::show_help();
+        std::cout << "Permitted modes: copy, problem, run_solution" << std::endl;
+    }
+
+private:
+    int iterations       = 10;
+    std::string mode_str = "copy";
+
+    static Modes ParseMode(const std::string& str)
+    {
+        if(str == "copy")
+            return Modes::Copy;
+        if(str == "problem")
+            return Modes::Problem;
+        if(str == "run_solution")
+            return Modes::RunSolution;
+        return Modes::Unknown;
+    }
+
+    template <class TType>
+    void SaveDeadCode(const TType& value) const
+    {
+        static const std::string dead_code_saver;
+
+        if(dead_code_saver.data() == nullptr)
+        {
+            std::cout << value << std::endl;
+            std::terminate();
+        }
+    }
+
+    template <class TBody>
+    void TestCore(const TBody& body) const
+    {
+        std::size_t sum = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for(auto i = 0; i < iterations; i++)
+        {
+            for(auto j = 0; j < 1024 * 1024; j++)
+                sum += body();
+        }
+
+        const auto time = std::chrono::duration_cast<std::chrono::microseconds>(
+                              std::chrono::steady_clock::now() - start)
+                              .count() *
+                          .001 * .001;
+
+        std::cout << "Test time: " << time << " seconds" << std::endl;
+
+        SaveDeadCode(sum); // required in release builds
+    }
+};
+} // namespace tensor_descriptor
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::tensor_descriptor::SpeedTestDriver>(argc, argv);
+    return 0;
+}
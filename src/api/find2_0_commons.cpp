@@ -427,6 +427,41 @@ miopenStatus_t miopenDestroySolution(miopenSolution_t solution)
     return miopen::try_([&] { miopen_destroy_object(solution); });
 }
 
+miopenStatus_t miopenBindSolution(miopenBoundSolution_t* boundSolution,
+                                  miopenSolution_t solution,
+                                  size_t nInputs,
+                                  const miopenTensorArgument_t* tensors)
+{
+    const auto tensors_vector = std::vector<miopenTensorArgument_t>{tensors, tensors + nInputs};
+    MIOPEN_LOG_FUNCTION(boundSolution, solution, nInputs, tensors_vector);
+
+    return miopen::try_([&] {
+        const auto& solution_deref = miopen::deref(solution);
+        auto& bound_ptr            = miopen::deref(boundSolution);
+        bound_ptr                  = new miopen::BoundSolution(solution_deref, tensors_vector);
+    });
+}
+
+miopenStatus_t miopenRunBoundSolution(miopenHandle_t handle,
+                                      miopenBoundSolution_t boundSolution,
+                                      void* const* buffers,
+                                      void* workspace,
+                                      size_t workspaceSize)
+{
+    MIOPEN_LOG_FUNCTION(handle, boundSolution, buffers, workspace, workspaceSize);
+
+    return miopen::try_([&] {
+        miopen::deref(boundSolution)
+            .Run(miopen::deref(handle), buffers, DataCast(workspace), workspaceSize);
+    });
+}
+
+miopenStatus_t miopenDestroyBoundSolution(miopenBoundSolution_t boundSolution)
+{
+    MIOPEN_LOG_FUNCTION(boundSolution);
+    return miopen::try_([&] { miopen_destroy_object(boundSolution); });
+}
+
 miopenStatus_t miopenLoadSolution(miopenSolution_t* solution, const char* data, size_t size)
 {
     MIOPEN_LOG_FUNCTION(solution, data, size);
@@ -860,9 +860,10 @@ public:
         // For OCL and ASM sources, we do insert contents of include
         // files directly into the source text during library build phase by means
         // of the addkernels tool. We don't do that for HIP sources, and, therefore
-        // have to export include files prior compilation.
+        // have to export include files prior compilation. Only the headers the source
+        // actually includes are exported, which spares the compiler from loading the rest.
         // Note that we do not need any "subdirs" in the include "pathnames" so far.
-        const auto inc_names = miopen::GetKernelIncList();
+        const auto inc_names = miopen::GetKernelIncClosure(src_text);
         include_names.reserve(inc_names.size());
         for(const auto& inc_name : inc_names)
         {
@@ -28,6 +28,9 @@
 #if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK || MIOPEN_ENABLE_AI_KERNEL_TUNING
 #include <fdeep/fdeep.hpp>
 #include <miopen/filesystem.hpp>
+#include <miopen/startup.hpp>
+
+#include <tuple>
 
 namespace miopen {
 namespace ai {
@@ -212,7 +215,8 @@ public:
             MIOPEN_LOG_I2("TunaNet Inapplicable: Group count not 1");
             return false;
         }
-        if(problem.GetInLayout() != "NCHW" && problem.GetInLayout() != "NCDHW")
+        const auto layout = problem.GetInLayoutCode();
+        if(layout != tensor_layout::NCHW && layout != tensor_layout::NCDHW)
         {
             MIOPEN_LOG_I2("TunaNet Inapplicable: Layout not supported");
             return false;
@@ -317,7 +321,7 @@ public:
             MIOPEN_LOG_I2("TunaNet Inapplicable: Problem not 2D");
             return false;
         }
-        if(problem.GetInLayout() != "NCHW")
+        if(problem.GetInLayoutCode() != tensor_layout::NCHW)
         {
             MIOPEN_LOG_I2("TunaNet Inapplicable: Layout not supported");
             return false;
@@ -410,7 +414,8 @@ public:
             MIOPEN_LOG_I2("TunaNet Inapplicable: Problem not 2D");
             return false;
         }
-        if(problem.GetInLayout() != "NCHW" && problem.GetInLayout() != "NHWC")
+        const auto layout = problem.GetInLayoutCode();
+        if(layout != tensor_layout::NCHW && layout != tensor_layout::NHWC)
         {
             MIOPEN_LOG_I2("TunaNet Inapplicable: Layout not supported");
             return false;
@@ -501,11 +506,23 @@ std::unique_ptr<Model> GetModel(const std::string& device)
     return std::make_unique<Gfx908Model>(); // default model if GPU-specific model is not available
 }
 
+/// The model of the first device asked for is kept for the lifetime of the process.
+static const std::unique_ptr<Model>& GetCachedModel(const std::string& device)
+{
+    const static std::unique_ptr<Model> model = [&]() {
+        const startup::ScopedStep step{startup::Step::AiModel, "TunaNet " + device};
+        return GetModel(device);
+    }();
+    return model;
+}
+
+void LoadModel(const std::string& device) { std::ignore = GetCachedModel(device); }
+
 std::vector<uint64_t> PredictSolver(const conv::ProblemDescription& problem,
                                     const ExecutionContext& ctx,
                                     const std::string& device)
 {
-    const static std::unique_ptr<Model> model = GetModel(device);
+    const auto& model = GetCachedModel(device);
     if(!model || !model->IsProblemSupported(problem, ctx))
         return {};
 
@@ -675,6 +692,7 @@ std::shared_ptr<Model> GetModel(const std::string& arch, const std::string& solv
     auto it = models.find(solver);
     if(it == models.end())
     {
+        const startup::ScopedStep step{startup::Step::AiModel, "KernelTuningNet " + solver};
         std::shared_ptr<Model> model = std::make_shared<Model>(arch, solver);
         models[solver]               = model;
         return model;
@@ -128,9 +128,9 @@ void ProblemDescription::HeuristicUpdateLayouts()
         if(in.IsPossibleLayout4D5D(layout) && out.IsPossibleLayout4D5D(layout) &&
            weights.IsPossibleLayout4D5D(layout))
         {
-            in_layout      = layout;
-            weights_layout = layout;
-            out_layout     = layout;
+            in_layout      = TensorLayoutCode{layout};
+            weights_layout = in_layout;
+            out_layout     = in_layout;
             return;
         }
     }
@@ -148,16 +148,15 @@ void ProblemDescription::MakeNetworkConfig(std::string& conf_key) const
     ss << 'x' << GetOutChannels();
     ss << 'x' << PrintDHW('x', GetSpatialDims(), GetOutDepth(), GetOutHeight(), GetOutWidth());
     ss << 'x' << GetInBatchSize();
-    if((GetInLayout() == "NCHW" && GetWeightsLayout() == "NCHW" && GetOutLayout() == "NCHW") ||
-       (GetInLayout() == "NCDHW" && GetWeightsLayout() == "NCDHW" && GetOutLayout() == "NCDHW"))
+    if(IsLayout(tensor_layout::NCHW) || IsLayout(tensor_layout::NCDHW))
     {
-        ss << 'x' << GetInLayout();
+        ss << 'x' << in_layout;
     }
     else
     {
-        ss << 'x' << GetInLayout();
-        ss << 'x' << GetWeightsLayout();
-        ss << 'x' << GetOutLayout();
+        ss << 'x' << in_layout;
+        ss << 'x' << weights_layout;
+        ss << 'x' << out_layout;
     }
     ss << 'x' << EncodeDataTypesForKey(GetInDataType(), GetWeightsDataType(), GetOutDataType());
 
@@ -203,14 +202,13 @@ void ProblemDescription::Serialize(std::ostream& stream) const
     stream << sep << PrintDHW('x', GetSpatialDims(), GetKernelStrideD(), GetKernelStrideH(), GetKernelStrideW());
     stream << sep << PrintDHW('x', GetSpatialDims(), GetDilationD(), GetDilationH(), GetDilationW());
     stream << sep << GetBias();
-    if ((GetInLayout() == "NCHW" && GetWeightsLayout() == "NCHW" && GetOutLayout() == "NCHW")
-        || (GetInLayout() == "NCDHW" && GetWeightsLayout() == "NCDHW" && GetOutLayout() == "NCDHW"))
+    if (IsLayout(tensor_layout::NCHW) || IsLayout(tensor_layout::NCDHW))
     {
-        stream << sep << GetInLayout();
+        stream << sep << in_layout;
     } else {
-        stream << sep << GetInLayout();
-        stream << sep << GetWeightsLayout();
-        stream << sep << GetOutLayout();
+        stream << sep << in_layout;
+        stream << sep << weights_layout;
+        stream << sep << out_layout;
     }
     stream << sep << EncodeDataTypesForKey(GetInDataType(), GetWeightsDataType(), GetOutDataType());
     stream << sep << GetDirectionStr();
@@ -241,11 +239,11 @@ bool ProblemDescription::IsLayoutDefault() const
 {
     if(GetSpatialDims() == 2)
     {
-        return (in_layout == "NCHW") && (out_layout == "NCHW") && (weights_layout == "NCHW");
+        return IsLayout(tensor_layout::NCHW);
     }
     else
     {
-        return (in_layout == "NCDHW") && (out_layout == "NCDHW") && (weights_layout == "NCDHW");
+        return IsLayout(tensor_layout::NCDHW);
     }
 }
 
@@ -253,11 +251,11 @@ bool ProblemDescription::IsLayoutNHWC() const
 {
     if(GetSpatialDims() == 2)
     {
-        return (in_layout == "NHWC") && (out_layout == "NHWC") && (weights_layout == "NHWC");
+        return IsLayout(tensor_layout::NHWC);
     }
     else
     {
-        return (in_layout == "NDHWC") && (out_layout == "NDHWC") && (weights_layout == "NDHWC");
+        return IsLayout(tensor_layout::NDHWC);
     }
 }
 
@@ -268,12 +266,13 @@ bool ProblemDescription::IsLayoutNCHWc() const
 
 bool ProblemDescription::IsNCHWc_NCHWc() const
 {
-    return GetInLayout() == "NCHWc" && GetWeightsLayout() == "NCHWc" && GetOutLayout() == "NCHWc";
+    return IsLayout(tensor_layout::NCHWc);
 }
 
 bool ProblemDescription::IsNCHWc_CHWNc() const
 {
-    return GetInLayout() == "NCHWc" && GetWeightsLayout() == "CHWNc" && GetOutLayout() == "NCHWc";
+    return in_layout == tensor_layout::NCHWc && weights_layout == tensor_layout::CHWNc &&
+           out_layout == tensor_layout::NCHWc;
 }
 
 void ProblemDescription::SetupFloats(ExecutionContext& ctx) const
@@ -289,16 +288,19 @@ void ProblemDescription::SetupFloats(ExecutionContext& ctx) const
                  << "x" << GetDataTypeName(GetOutDataType()));
 }
 
-std::string ProblemDescription::ComputeLayout(const TensorDescriptor& td) const
+TensorLayoutCode ProblemDescription::ComputeLayout(const TensorDescriptor& td) const
 {
-    return td.GetLayout_str();
+    return td.GetLayoutCode();
 }
 
-std::string ProblemDescription::ComputeInLayout() const { return ComputeLayout(in); }
+TensorLayoutCode ProblemDescription::ComputeInLayout() const { return ComputeLayout(in); }
 
-std::string ProblemDescription::ComputeOutLayout() const { return ComputeLayout(out); }
+TensorLayoutCode ProblemDescription::ComputeOutLayout() const { return ComputeLayout(out); }
 
-std::string ProblemDescription::ComputeWeightsLayout() const { return ComputeLayout(weights); }
+TensorLayoutCode ProblemDescription::ComputeWeightsLayout() const
+{
+    return ComputeLayout(weights);
+}
 
 } // namespace conv
 } // namespace miopen
@@ -0,0 +1,306 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/conv/selection_report.hpp>
+
+#include <miopen/any_solver.hpp>
+#include <miopen/conv/heuristics/ai_heuristics.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/conv/solver_finders.hpp>
+#include <miopen/conv_algo_name.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/db.hpp>
+#include <miopen/db_record.hpp>
+#include <miopen/env.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/find_controls.hpp>
+#include <miopen/find_db.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/mlo_internal.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_ENABLE_AI_IMMED_MODE_FALLBACK)
+
+namespace miopen {
+namespace conv {
+
+namespace {
+
+/// Keeps the VALUES of a perf-db record as is, to tell a tuned config from a missing one.
+struct RawValues
+{
+    std::string values;
+
+    bool Deserialize(const std::string& str)
+    {
+        values = str;
+        return true;
+    }
+};
+
+void FillApplicable(const ExecutionContext& ctx,
+                    const ProblemDescription& problem,
+                    const solver::AnySolver& solver,
+                    const boost::optional<DbRecord>& perf_record,
+                    PerformanceDb& perf_db,
+                    SolverSelectionEntry& entry)
+{
+    entry.dynamic   = solver.IsDynamic();
+    entry.tunable   = solver.IsTunable();
+    entry.workspace = solver.MayNeedWorkspace() ? solver.GetWorkspaceSize(ctx, problem) : 0;
+    entry.wti       = solver.GetWti(ctx, problem);
+
+    if(!entry.tunable)
+        return;
+
+    auto raw          = RawValues{};
+    entry.perf_db_hit = perf_record && perf_record->GetValues(solver.GetSolverDbId(), raw);
+    entry.perf_config = solver.GetPerfCfgParams(ctx, problem, perf_db);
+}
+
+void Evaluate(const ExecutionContext& ctx,
+              const ProblemDescription& problem,
+              const boost::optional<std::vector<solver::Id>>& find_only,
+              const boost::optional<DbRecord>& perf_record,
+              PerformanceDb& perf_db,
+              SolverSelectionEntry& entry)
+{
+    const auto algo = entry.id.GetAlgo();
+    const auto& s   = entry.id.GetSolver();
+
+    if(s.IsEmpty())
+    {
+        entry.reason = "not a convolution solver";
+        return;
+    }
+    if(IsAlgorithmDisabled(algo))
+    {
+        entry.reason = "algorithm disabled";
+        return;
+    }
+    if(find_only && std::find(find_only->begin(), find_only->end(), entry.id) == find_only->end())
+    {
+        entry.reason = "excluded by MIOPEN_DEBUG_FIND_ONLY_SOLVER";
+        return;
+    }
+
+    try
+    {
+        entry.applicable = s.IsApplicable(ctx, problem);
+        if(!entry.applicable)
+        {
+            entry.reason = "not applicable";
+            return;
+        }
+        entry.reason = "applicable";
+        FillApplicable(ctx, problem, s, perf_record, perf_db, entry);
+    }
+    catch(const Exception& ex)
+    {
+        entry.reason = std::string{"failed: "} + ex.what();
+    }
+}
+
+} // namespace
+
+SelectionReport ExplainSelection(const ExecutionContext& ctx, const ProblemDescription& problem)
+{
+    auto report           = SelectionReport{};
+    report.network_config = problem.MakeNetworkConfig().ToString();
+    report.direction      = problem.GetDirectionStr();
+
+    const auto& ids = solver::GetSolversByPrimitive(solver::Primitive::Convolution);
+    report.solvers.reserve(ids.size());
+
+    const auto find_only = GetEnvFindOnlySolver();
+    auto perf_db         = GetDb(ctx);
+    const auto perf_rec  = perf_db.FindRecord(problem);
+
+    for(const auto& id : ids)
+    {
+        auto entry      = SolverSelectionEntry{};
+        entry.id        = id;
+        entry.name      = id.ToString();
+        entry.algorithm = ConvolutionAlgoToString(id.GetAlgo());
+        Evaluate(ctx, problem, find_only, perf_rec, perf_db, entry);
+        report.solvers.push_back(std::move(entry));
+    }
+
+    const auto find = [&](const solver::Id& id) {
+        return std::find_if(report.solvers.begin(), report.solvers.end(), [&](const auto& e) {
+            return e.id == id;
+        });
+    };
+
+    {
+        const FindDbRecord fdb_record{ctx.GetStream(), problem};
+        report.find_db_hit = !fdb_record.empty();
+        if(report.find_db_hit)
+        {
+            for(const auto& pair : fdb_record)
+            {
+                const auto entry = find(solver::Id{pair.first});
+                if(entry != report.solvers.end())
+                    entry->find_db_time = pair.second.time;
+            }
+        }
+    }
+
+#if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
+    if(!env::disabled(MIOPEN_DEBUG_ENABLE_AI_IMMED_MODE_FALLBACK))
+    {
+        try
+        {
+            const auto predicted =
+                ai::immed_mode::PredictSolver(problem, ctx, ctx.GetStream().GetDeviceName());
+            report.ai_heuristic_used = !predicted.empty();
+            auto ai_rank             = 0;
+            for(const auto value : predicted)
+            {
+                const auto entry = find(solver::Id{value});
+                if(entry != report.solvers.end())
+                    entry->ai_rank = ++ai_rank;
+            }
+        }
+        catch(const Exception& ex)
+        {
+            MIOPEN_LOG_I2("AI heuristic failed: " << ex.what());
+        }
+    }
+#endif
+
+    // The ranking is the one immediate mode returns, so it reflects both the find-db and the
+    // fallback heuristics exactly.
+    auto fallback      = false;
+    const auto ranking = problem.GetConv().GetSolutions(ctx, problem, ids.size(), &fallback);
+    report.fallback    = fallback;
+    auto rank          = 0;
+    for(const auto& solution : ranking)
+    {
+        const auto entry = find(solver::Id{solution.solution_id});
+        if(entry == report.solvers.end())
+            continue;
+        entry->rank         = ++rank;
+        entry->ranking_time = solution.time;
+    }
+
+    return report;
+}
+
+std::string SelectionReport::ToJson() const
+{
+    auto json = nlohmann::json{
+        {"network_config", network_config},
+        {"direction", direction},
+        {"find_db_hit", find_db_hit},
+        {"fallback", fallback},
+        {"ai_heuristic_used", ai_heuristic_used},
+        {"solvers", nlohmann::json::array()},
+    };
+
+    for(const auto& s : solvers)
+    {
+        json["solvers"].push_back({
+            {"id", s.id.Value()},
+            {"name", s.name},
+            {"algorithm", s.algorithm},
+            {"applicable", s.applicable},
+            {"reason", s.reason},
+            {"dynamic", s.dynamic},
+            {"tunable", s.tunable},
+            {"perf_db_hit", s.perf_db_hit},
+            {"perf_config", s.perf_config},
+            {"ai_rank", s.ai_rank},
+            {"wti", s.wti},
+            {"workspace", s.workspace},
+            {"find_db_time", s.find_db_time},
+            {"rank", s.rank},
+            {"ranking_time", s.ranking_time},
+        });
+    }
+
+    return json.dump(2);
+}
+
+std::ostream& operator<<(std::ostream& os, const SelectionReport& report)
+{
+    os << "Solver selection for " << report.network_config << " (" << report.direction
+       << "), find-db: " << (report.find_db_hit ? "hit" : "miss")
+       << ", fallback: " << (report.fallback ? "yes" : "no")
+       << ", AI heuristic: " << (report.ai_heuristic_used ? "yes" : "no") << std::endl;
+
+    // Ranked solvers go first, then the other applicable ones, then the rest.
+    auto order = std::vector<const SolverSelectionEntry*>{};
+    order.reserve(report.solvers.size());
+    for(const auto& s : report.solvers)
+        order.push_back(&s);
+    std::stable_sort(order.begin(), order.end(), [](auto lhs, auto rhs) {
+        const auto key = [](const SolverSelectionEntry* s) {
+            return s->rank > 0 ? s->rank : (s->applicable ? 100000 : 200000);
+        };
+        return key(lhs) < key(rhs);
+    });
+
+    os << std::left << std::setw(6) << "rank" << std::setw(6) << "id" << std::setw(48) << "solver"
+       << std::setw(14) << "time" << std::setw(14) << "find-db ms" << std::setw(8) << "wti"
+       << std::setw(6) << "ai" << std::setw(12) << "workspace" << std::setw(10) << "perf-db"
+       << "verdict" << std::endl;
+
+    for(const auto* s : order)
+    {
+        os << std::setw(6) << (s->rank > 0 ? std::to_string(s->rank) : "-") //
+           << std::setw(6) << s->id.Value()                                  //
+           << std::setw(48) << s->name;
+        if(s->rank > 0)
+            os << std::setw(14) << s->ranking_time;
+        else
+            os << std::setw(14) << "-";
+        if(s->find_db_time >= 0.0f)
+            os << std::setw(14) << s->find_db_time;
+        else
+            os << std::setw(14) << "-";
+        if(s->applicable && s->wti >= 0.0f)
+            os << std::setw(8) << s->wti;
+        else
+            os << std::setw(8) << "-";
+        os << std::setw(6) << (s->ai_rank > 0 ? std::to_string(s->ai_rank) : "-")
+           << std::setw(12) << (s->applicable ? std::to_string(s->workspace) : "-")
+           << std::setw(10) << (s->tunable ? (s->perf_db_hit ? "tuned" : "default") : "-")
+           << s->reason;
+        if(s->perf_db_hit)
+            os << " [" << s->perf_config << "]";
+        os << std::endl;
+    }
+    return os << std::right;
+}
+
+} // namespace conv
+} // namespace miopen
@@ -209,9 +209,9 @@ std::string ConvArgsForMIOpenDriver(const miopen::TensorDescriptor& xDesc,
            << " -v " << convDesc.GetConvStrides()[1]   //
            << " -l " << convDesc.GetConvDilations()[0] //
            << " -j " << convDesc.GetConvDilations()[1];
-        std::string x_layout = xDesc.GetLayout_str();
-        std::string w_layout = wDesc.GetLayout_str();
-        std::string y_layout = yDesc.GetLayout_str();
+        std::string x_layout{xDesc.GetLayout_str()};
+        std::string w_layout{wDesc.GetLayout_str()};
+        std::string y_layout{yDesc.GetLayout_str()};
         if(x_layout != "NCHW")
         {
             ss << " --in_layout " << x_layout;
@@ -249,9 +249,9 @@ std::string ConvArgsForMIOpenDriver(const miopen::TensorDescriptor& xDesc,
            << " -l " << convDesc.GetConvDilations()[1]            //
            << " -j " << convDesc.GetConvDilations()[2]            //
            << " --spatial_dim 3";
-        std::string x_layout = xDesc.GetLayout_str();
-        std::string w_layout = wDesc.GetLayout_str();
-        std::string y_layout = yDesc.GetLayout_str();
+        std::string x_layout{xDesc.GetLayout_str()};
+        std::string w_layout{wDesc.GetLayout_str()};
+        std::string y_layout{yDesc.GetLayout_str()};
         if(x_layout != "NCDHW")
         {
             ss << " --in_layout " << x_layout;
@@ -34,6 +34,7 @@
 #endif
 #include <miopen/filesystem.hpp>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace miopen {
@@ -227,6 +228,25 @@ fs::path FindDbRecord_t<TDb>::GetUserPath(const Handle& handle, const std::strin
 #endif
 }
 
+template <class TDb>
+void FindDbRecord_t<TDb>::Prefetch(const Handle& handle, const std::string& path_suffix)
+{
+    // Only the system part of the immediate mode find-db is shared between records.
+    if constexpr(std::is_same<TDb, FindDb>::value)
+    {
+        if(!debug::testing_find_db_enabled || env::enabled(MIOPEN_DEBUG_DISABLE_FIND_DB) ||
+           debug::testing_find_db_path_override())
+            return;
+        std::ignore = DbTimer<TDb>{
+            DbKinds::FindDb, GetInstalledPath(handle, path_suffix), GetUserPath(handle, path_suffix)};
+    }
+    else
+    {
+        std::ignore = handle;
+        std::ignore = path_suffix;
+    }
+}
+
 template <class TDb>
 bool FindDbRecord_t<TDb>::Validate(const Handle& handle, const NetworkConfig& config) const
 {
@@ -33,6 +33,7 @@
 #include <miopen/visit_float.hpp>
 #include <miopen/stringutils.hpp>
 #include <miopen/solver_id.hpp>
+#include <miopen/stats.hpp>
 #include <miopen/fusion/solvers.hpp>
 #include <miopen/fusion/fusion_invoke_params.hpp>
 #include <miopen/fusion/utils.hpp>
@@ -41,17 +42,23 @@
 #include <miopen/conv/solver_finders.hpp>
 #include <miopen/driver_arguments.hpp>
 #include <miopen/config.hpp>
+#include <miopen/env.hpp>
 
 #include <ostream>
 #include <ios>
 #include <algorithm>
+#include <list>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <half/half.hpp>
 
 #define MIOPEN_CHECK(x)          \
     if(x != miopenStatusSuccess) \
         return x;
 
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_DISABLE_FUSION_PLAN_CACHE)
+
 namespace miopen {
 
 miopenStatus_t ConvBiasActivFusion(const Handle& handle,
@@ -567,8 +574,7 @@ miopenStatus_t ConvForwardOpDescriptor::SetArgs(OperatorArgs& args,
 {
     float falpha = alpha != nullptr ? *reinterpret_cast<const float*>(alpha) : 1.0f;
     float fbeta  = beta != nullptr ? *reinterpret_cast<const float*>(beta) : 0.0f;
-    auto op_args = std::make_unique<fusion::ConvolutionOpInvokeParam>(falpha, fbeta, w);
-    args.SetArg(GetIdx(), std::move(op_args));
+    args.EmplaceArg<fusion::ConvolutionOpInvokeParam>(GetIdx(), falpha, fbeta, w);
     return miopenStatusSuccess;
 }
 
@@ -581,9 +587,7 @@ miopenStatus_t ActivFwdFusionOpDescriptor::SetArgs(OperatorArgs& args,
                                                    double activBeta,
                                                    double activGamma)
 {
-    auto op_args =
-        std::make_unique<fusion::ActivationOpInvokeParam>(activAlpha, activBeta, activGamma);
-    args.SetArg(GetIdx(), std::move(op_args));
+    args.EmplaceArg<fusion::ActivationOpInvokeParam>(GetIdx(), activAlpha, activBeta, activGamma);
     return miopenStatusSuccess;
 }
 
@@ -603,9 +607,8 @@ miopenStatus_t ActivBwdFusionOpDescriptor::SetArgs(OperatorArgs& args,
                                                    double activBeta,
                                                    double activGamma)
 {
-    auto op_args = std::make_unique<fusion::ActivationBwdOpInvokeParam>(
-        y, x, activAlpha, activBeta, activGamma);
-    args.SetArg(GetIdx(), std::move(op_args));
+    args.EmplaceArg<fusion::ActivationBwdOpInvokeParam>(
+        GetIdx(), y, x, activAlpha, activBeta, activGamma);
     return miopenStatusSuccess;
 }
 
@@ -626,9 +629,8 @@ miopenStatus_t BatchNormInferenceFusionOpDescriptor::SetArgs(OperatorArgs& args,
                                                              ConstData_t estimatedVariance,
                                                              double epsilon) const
 {
-    auto op_args = std::make_unique<fusion::BatchNormInferenceOpInvokeParam>(
-        bnScale, bnBias, estimatedMean, estimatedVariance, epsilon);
-    args.SetArg(GetIdx(), std::move(op_args));
+    args.EmplaceArg<fusion::BatchNormInferenceOpInvokeParam>(
+        GetIdx(), bnScale, bnBias, estimatedMean, estimatedVariance, epsilon);
     return miopenStatusSuccess;
 }
 
@@ -658,15 +660,15 @@ miopenStatus_t BatchNormFwdTrainFusionOpDescriptor::SetArgs(OperatorArgs& args,
                      "Save batch statistics was turned on at op creation time "
                      "but runningMean or runningVariance is set to nullptr");
     }
-    auto op_args = std::make_unique<fusion::BatchNormFwdTrainingOpInvokeParam>(runningMean,
-                                                                               runningVariance,
-                                                                               savedMean,
-                                                                               savedInvVariance,
-                                                                               bnScale,
-                                                                               bnBias,
-                                                                               expAvgFactor,
-                                                                               epsilon);
-    args.SetArg(GetIdx(), std::move(op_args));
+    args.EmplaceArg<fusion::BatchNormFwdTrainingOpInvokeParam>(GetIdx(),
+                                                               runningMean,
+                                                               runningVariance,
+                                                               savedMean,
+                                                               savedInvVariance,
+                                                               bnScale,
+                                                               bnBias,
+                                                               expAvgFactor,
+                                                               epsilon);
     return miopenStatusSuccess;
 }
 
@@ -691,9 +693,14 @@ miopenStatus_t BatchNormBwdTrainFusionOpDescriptor::SetArgs(OperatorArgs& args,
                                                             ConstData_t savedMean,
                                                             ConstData_t savedInvVariance) const
 {
-    auto op_args = std::make_unique<fusion::BatchNormBwdTrainingOpInvokeParam>(
-        x, bnScale, bnBias, resBnScaleDiff, resBnBiasDiff, savedMean, savedInvVariance);
-    args.SetArg(GetIdx(), std::move(op_args));
+    args.EmplaceArg<fusion::BatchNormBwdTrainingOpInvokeParam>(GetIdx(),
+                                                               x,
+                                                               bnScale,
+                                                               bnBias,
+                                                               resBnScaleDiff,
+                                                               resBnBiasDiff,
+                                                               savedMean,
+                                                               savedInvVariance);
     return miopenStatusSuccess;
 }
 miopenStatus_t
@@ -717,8 +724,7 @@ miopenStatus_t BiasFusionOpDescriptor::SetArgs(OperatorArgs& args,
                                                const void* /*beta*/,
                                                ConstData_t bdata)
 {
-    auto op_args = std::make_unique<fusion::BiasOpInvokeParam>(bdata);
-    args.SetArg(GetIdx(), std::move(op_args));
+    args.EmplaceArg<fusion::BiasOpInvokeParam>(GetIdx(), bdata);
     return miopenStatusSuccess;
 }
 
@@ -731,8 +737,7 @@ miopenStatus_t TensorScaleAddOpDescriptor::GetOutputDesc(TensorDescriptor& outpu
 miopenStatus_t
 TensorScaleAddOpDescriptor::SetArgs(OperatorArgs& args, float alpha, ConstData_t tensor_ptr)
 {
-    auto op_args = std::make_unique<fusion::TensorScaleAddOpInvokeParam>(alpha, tensor_ptr);
-    args.SetArg(GetIdx(), std::move(op_args));
+    args.EmplaceArg<fusion::TensorScaleAddOpInvokeParam>(GetIdx(), alpha, tensor_ptr);
     return miopenStatusSuccess;
 }
 
@@ -883,6 +888,85 @@ FindFusion(const ExecutionContext& ctx,
 
 namespace {
 
+/// Compiled fusion plans shared by all handles of the process. Frameworks create a plan per
+/// layer instance, and most of them repeat a few structures, so the first plan of a structure
+/// pays for find and kernel compilation and the rest reuse its invokers. Invokers run on the
+/// handle they are given, but their kernels are loaded on one device, so entries are per device.
+/// The least recently used entry is evicted when the cache is full.
+class FusionPlanCache
+{
+public:
+    struct Entry
+    {
+        std::vector<Invoker> invokers;
+        std::vector<std::string> solvers; // parallel to invokers
+    };
+
+    static FusionPlanCache& Instance()
+    {
+        static FusionPlanCache cache;
+        return cache;
+    }
+
+    std::optional<Entry> Find(const std::string& key)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto it = index.find(key);
+        if(it == index.end())
+            return std::nullopt;
+        entries.splice(entries.begin(), entries, it->second);
+        return it->second->second;
+    }
+
+    void Insert(const std::string& key, Entry entry)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(const auto it = index.find(key); it != index.end())
+        {
+            entries.erase(it->second);
+            index.erase(it);
+        }
+        else if(entries.size() >= max_entries)
+        {
+            index.erase(entries.back().first);
+            entries.pop_back();
+        }
+        entries.emplace_front(key, std::move(entry));
+        index.emplace(key, entries.begin());
+    }
+
+private:
+    static constexpr std::size_t max_entries = 1024;
+
+    std::mutex mutex;
+    std::list<std::pair<std::string, Entry>> entries; // most recently used first
+    std::unordered_map<std::string, std::list<std::pair<std::string, Entry>>::iterator> index;
+};
+
+/// The network config serializes the ops of the plan together with their descriptors.
+/// Returns an empty key if plans of this handle can't be shared.
+std::string MakeFusionPlanCacheKey(const Handle& handle,
+                                   const NetworkConfig& network_config,
+                                   const std::optional<miopenConvFwdAlgorithm_t>& conv_fwd_algo)
+{
+#if MIOPEN_BACKEND_HIP
+    if(env::enabled(MIOPEN_DEBUG_DISABLE_FUSION_PLAN_CACHE))
+        return {};
+
+    std::ostringstream ss;
+    ss << handle.GetDeviceId() << '-' << handle.GetDbBasename() << '-'
+       << (conv_fwd_algo ? static_cast<int>(*conv_fwd_algo) : -1) << '-'
+       << network_config.ToString();
+    return ss.str();
+#else
+    // OpenCL kernels belong to the context of the handle which built them
+    std::ignore = handle;
+    std::ignore = network_config;
+    std::ignore = conv_fwd_algo;
+    return {};
+#endif
+}
+
 // Copy from convolutionocl.cpp
 struct SolutionTimeComparator
 {
@@ -977,6 +1061,7 @@ miopenStatus_t FusionPlanDescriptor::Compile(const Handle& handle)
 
     const auto& fusion_problem = FusionDescription{this};
     std::vector<Solution> find_results;
+    std::vector<std::string> solvers; // of invokers
 
     const auto network_config = fusion_problem.MakeNetworkConfig();
     auto invoker = handle.GetInvoker(network_config, std::nullopt, AlgorithmName{"fusion"});
@@ -987,6 +1072,22 @@ miopenStatus_t FusionPlanDescriptor::Compile(const Handle& handle)
         return miopenStatusSuccess;
     }
 
+    const auto cache_key = MakeFusionPlanCacheKey(handle, network_config, conv_fwd_algo);
+    if(!cache_key.empty())
+    {
+        if(auto entry = FusionPlanCache::Instance().Find(cache_key))
+        {
+            MIOPEN_LOG_I2("Reusing compiled fusion plan: " << network_config.ToString());
+            stats::Increment(stats::Counter::FusionPlanCacheHit);
+            for(std::size_t i = 0; i < entry->invokers.size(); ++i)
+                handle.RegisterInvoker(entry->invokers[i], network_config, entry->solvers[i]);
+            handle.SetAsFound1_0(network_config, AlgorithmName{"fusion"}, entry->solvers.front());
+            invokers = std::move(entry->invokers);
+            return miopenStatusSuccess;
+        }
+        stats::Increment(stats::Counter::FusionPlanCacheMiss);
+    }
+
     {
         FindMode findMode(solver::Primitive::Fusion);
         auto sol = boost::optional<miopenConvSolution_t>{};
@@ -1083,6 +1184,7 @@ miopenStatus_t FusionPlanDescriptor::Compile(const Handle& handle)
 
         handle.RegisterInvoker(*invoker, network_config, id.ToString());
         invokers.push_back(std::move(*invoker));
+        solvers.push_back(id.ToString());
         MIOPEN_LOG_I2(miopen::ConvolutionAlgoToString(algorithm));
     }
 
@@ -1094,6 +1196,10 @@ miopenStatus_t FusionPlanDescriptor::Compile(const Handle& handle)
 
     handle.SetAsFound1_0(
         network_config, AlgorithmName{"fusion"}, find_results.front().GetSolver().ToString());
+
+    if(!cache_key.empty())
+        FusionPlanCache::Instance().Insert(cache_key, {invokers, solvers});
+
     return miopenStatusSuccess;
 }
 
@@ -1130,6 +1236,7 @@ miopenStatus_t FusionPlanDescriptor::Execute(const Handle& handle,
         MIOPEN_THROW(miopenStatusBadParm, "The Fusion Plan was not compiled successfully");
     }
 
+    // Parameters are per call, so that one compiled plan can be executed from several threads
     const auto plan_params =
         fusion::FusionInvokeParams{op_args, inputDesc, input, outputDesc, output, false};
     invokers[0](handle, plan_params);
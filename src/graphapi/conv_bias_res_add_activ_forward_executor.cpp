@@ -47,8 +47,9 @@ std::vector<int> Convert(const std::vector<int64_t>& values)
 
     return converted;
 }
+} // namespace
 
-ConvolutionDescriptor Convert(const Convolution& conv, int groupCount)
+ConvolutionDescriptor makeConvolutionDescriptor(const Convolution& conv, int groupCount)
 {
     return {conv.getSpatialDims(),
             conv.getMode(),
@@ -59,7 +60,6 @@ ConvolutionDescriptor Convert(const Convolution& conv, int groupCount)
             Convert(conv.getPostPaddings()),
             groupCount};
 }
-} // namespace
 
 ConvBiasResAddActivForwardExecutor::ConvBiasResAddActivForwardExecutor(const nlohmann::json& json)
     : GraphPatternExecutor(),
@@ -78,7 +78,7 @@ ConvBiasResAddActivForwardExecutor::ConvBiasResAddActivForwardExecutor(const nlo
 
 void ConvBiasResAddActivForwardExecutor::execute(miopenHandle_t handle, const VariantPack& vpk)
 {
-    auto convDesc = Convert(mConvolution, mGroupCount);
+    auto convDesc = makeConvolutionDescriptor(mConvolution, mGroupCount);
 
     ActivationDescriptor activDesc{miopenActivationRELU, mActivationAlpha, 1.0, 1.0};
 
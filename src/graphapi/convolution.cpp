@@ -464,6 +464,25 @@ void BackendConvolutionDescriptor::getPostPaddings(miopenBackendAttributeType_t
     }
 }
 
+bool OperationConvolution::hashAttributes(internal::NodeKey& seed) const
+{
+    internal::hashCombine(seed, mConvolution->getCompType());
+    internal::hashCombine(seed, mConvolution->getMode());
+    internal::hashCombine(seed, mConvolution->getSpatialDims());
+    for(const auto* values : {&mConvolution->getDilations(),
+                              &mConvolution->getFilterStrides(),
+                              &mConvolution->getPrePaddings(),
+                              &mConvolution->getPostPaddings()})
+    {
+        internal::hashCombine(seed, values->size());
+        for(auto value : *values)
+            internal::hashCombine(seed, value);
+    }
+    internal::hashCombine(seed, mAlpha);
+    internal::hashCombine(seed, mBeta);
+    return true;
+}
+
 void BackendOperationConvolutionDescriptor::setConvolution(
     miopenBackendAttributeType_t attributeType, int64_t elementCount, void* arrayOfElements)
 {
@@ -28,12 +28,15 @@
 #include <miopen/graphapi/conv_bias_res_add_activ_forward_executor.hpp>
 #include <miopen/graphapi/engine.hpp>
 #include <miopen/graphapi/opgraph.hpp>
+#include <miopen/graphapi/pointwise_chain.hpp>
+#include <miopen/handle.hpp>
 #include <miopen/utility/base64.hpp>
 #include <miopen/utility/scope.hpp>
 #include <nlohmann/json.hpp>
 
 #include <algorithm>
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -43,6 +46,96 @@ namespace graphapi {
 
 GraphPatternExecutor::~GraphPatternExecutor() = default;
 
+GraphPatternExecutor::Binding::~Binding() = default;
+
+namespace {
+
+/// Runs the solution through a BoundSolution, so executions call the invoker directly
+/// instead of going through miopenRunSolution. Variant pack positions are resolved into
+/// a slot table once and reused while the variant pack keeps the same tensor ids.
+class GraphExecutorFind20Binding : public GraphPatternExecutor::Binding
+{
+    std::unique_ptr<BoundSolution> mBoundSolution;
+    // graph tensor id of every argument of mBoundSolution
+    std::vector<int64_t> mArgumentTensorIds;
+    // variant pack tensor ids mSlots has been resolved for
+    std::vector<int64_t> mSlotTensorIds;
+    // variant pack position of every argument of mBoundSolution
+    std::vector<std::size_t> mSlots;
+    std::vector<void*> mBuffers;
+    std::mutex mMutex;
+
+    void resolveSlots(const VariantPack& vpk)
+    {
+        const auto& tensorIds = vpk.getTensorIds();
+
+        for(auto tensorId : tensorIds)
+        {
+            MIOPEN_THROW_IF(std::find(mArgumentTensorIds.cbegin(),
+                                      mArgumentTensorIds.cend(),
+                                      tensorId) == mArgumentTensorIds.cend(),
+                            "couldn't find a variant pack tensor id in the map");
+        }
+
+        mSlots.clear();
+        for(auto tensorId : mArgumentTensorIds)
+        {
+            auto it = std::find(tensorIds.cbegin(), tensorIds.cend(), tensorId);
+            MIOPEN_THROW_IF(it == tensorIds.cend(), "a solution tensor is missing in VariantPack");
+            mSlots.push_back(it - tensorIds.cbegin());
+        }
+
+        mSlotTensorIds = tensorIds;
+    }
+
+public:
+    GraphExecutorFind20Binding(const Solution& solution, const TensorInfoMap& tensorInfoMap)
+    {
+        std::vector<miopenTensorArgument_t> arguments;
+        arguments.reserve(tensorInfoMap.size());
+        mArgumentTensorIds.reserve(tensorInfoMap.size());
+
+        for(const auto& [tensorId, tensorInfo] : tensorInfoMap)
+        {
+            miopenTensorArgument_t targ{};
+            targ.id         = tensorInfo.mEnumId;
+            targ.descriptor = nullptr;
+            targ.buffer     = nullptr;
+
+            arguments.push_back(targ);
+            mArgumentTensorIds.push_back(tensorId);
+        }
+
+        mBoundSolution = std::make_unique<BoundSolution>(solution, arguments);
+        mBuffers.resize(arguments.size());
+    }
+
+    void execute(miopenHandle_t handle, const VariantPack& vpk) override
+    {
+        assert(vpk.getTensorIds().size() == vpk.getDataPtrs().size());
+
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if(mSlots.size() != mArgumentTensorIds.size() || vpk.getTensorIds() != mSlotTensorIds)
+            resolveSlots(vpk);
+
+        const auto& dataPtrs = vpk.getDataPtrs();
+        for(std::size_t i = 0; i < mSlots.size(); ++i)
+        {
+            mBuffers[i] = dataPtrs[mSlots[i]];
+            assert(mBuffers[i]);
+        }
+
+        mBoundSolution->Run(deref(handle),
+                            mBuffers.data(),
+                            DataCast(vpk.getWorkspace()),
+                            mBoundSolution->GetSolution().GetWorkspaceSize());
+        MIOPEN_LOG_I2("Graph API Find 2.0 Solution Ran");
+    }
+};
+
+} // namespace
+
 size_t GraphExecutorFind20::getWorkspaceSize() const { return mSolution.GetWorkspaceSize(); }
 
 nlohmann::json GraphExecutorFind20::getJson()
@@ -151,6 +244,11 @@ void GraphExecutorFind20::execute(miopenHandle_t handle, const VariantPack& vpk)
     }
 }
 
+std::unique_ptr<GraphPatternExecutor::Binding> GraphExecutorFind20::bind()
+{
+    return std::make_unique<GraphExecutorFind20Binding>(mSolution, *mTensorInfoMap);
+}
+
 void to_json(nlohmann::json& json, const Engine& engine)
 {
     MIOPEN_THROW_IF(!engine.mExecutor, "Cannot serialize an Engine without an Executor");
@@ -172,6 +270,8 @@ void from_json(const nlohmann::json& json, Engine& engine)
              std::make_shared<GraphExecutorFind20, const nlohmann::json&>},
             {ConvBiasResAddActivForwardExecutor::name,
              std::make_shared<ConvBiasResAddActivForwardExecutor, const nlohmann::json&>},
+            {PointwiseChainExecutor::name,
+             std::make_shared<PointwiseChainExecutor, const nlohmann::json&>},
         };
 
     auto jExecutor    = json.at(Engine::JsonFields::Executor);
@@ -26,10 +26,21 @@
 
 #include <miopen/graphapi/execution_plan.hpp>
 
+#include <algorithm>
+#include <mutex>
+
 namespace miopen {
 
 namespace graphapi {
 
+struct ExecutionPlan::AugmentedVariantPack
+{
+    std::mutex mMutex;
+    // caller tensors first, then the virtual tensors of the memory plan
+    VariantPack mVariantPack;
+    std::size_t mNumCallerTensors = 0;
+};
+
 std::string ExecutionPlan::getJsonRepresentation() const
 {
     std::string result;
@@ -39,6 +50,68 @@ std::string ExecutionPlan::getJsonRepresentation() const
     return result;
 }
 
+void ExecutionPlan::prepare()
+{
+    const auto& engine   = mEngineCfg.getEngine();
+    const auto& executor = engine.getExecutor();
+    if(executor)
+        mBinding = executor->bind();
+    else
+        mBinding = nullptr;
+
+    // Deserialized plans have no graph and keep the plan they were saved with
+    if(executor && engine.getOpGraph() != nullptr)
+    {
+        const auto ids = executor->getVirtualTensorIds();
+        mMemoryPlan    = ids.empty() ? MemoryPlan{}
+                                     : planMemory(getBufferLifetimes(*engine.getOpGraph(), ids));
+    }
+
+    if(mMemoryPlan.empty())
+    {
+        mAugmentedVariantPack = nullptr;
+        return;
+    }
+
+    mAugmentedVariantPack = std::make_shared<AugmentedVariantPack>();
+    auto& augmented       = mAugmentedVariantPack->mVariantPack;
+    for(const auto& [id, offset] : mMemoryPlan.mOffsets)
+        augmented.mTensorIds.push_back(id);
+    augmented.mDataPointers.resize(augmented.mTensorIds.size());
+}
+
+void ExecutionPlan::executeAugmented(miopenHandle_t handle, const VariantPack& variantPack)
+{
+    auto* arena = static_cast<char*>(variantPack.getWorkspace());
+    MIOPEN_THROW_IF(arena == nullptr, "Execution plan needs a workspace for virtual tensors");
+
+    const auto& ids             = variantPack.getTensorIds();
+    const auto& ptrs            = variantPack.getDataPtrs();
+    const auto numCallerTensors = ids.size();
+    MIOPEN_THROW_IF(ptrs.size() != numCallerTensors,
+                    "VariantPack has different numbers of tensor ids and data pointers");
+
+    std::lock_guard<std::mutex> lock(mAugmentedVariantPack->mMutex);
+    auto& augmented = mAugmentedVariantPack->mVariantPack;
+
+    if(numCallerTensors != mAugmentedVariantPack->mNumCallerTensors ||
+       !std::equal(ids.cbegin(), ids.cend(), augmented.mTensorIds.cbegin()))
+    {
+        augmented.mTensorIds.assign(ids.cbegin(), ids.cend());
+        for(const auto& [id, offset] : mMemoryPlan.mOffsets)
+            augmented.mTensorIds.push_back(id);
+        augmented.mDataPointers.resize(augmented.mTensorIds.size());
+        mAugmentedVariantPack->mNumCallerTensors = numCallerTensors;
+    }
+
+    auto ptrIt = std::copy(ptrs.cbegin(), ptrs.cend(), augmented.mDataPointers.begin());
+    for(const auto& placement : mMemoryPlan.mOffsets)
+        *ptrIt++ = arena + placement.second;
+    augmented.mWorkspace = arena + mMemoryPlan.mArenaSize;
+
+    executeImpl(handle, augmented);
+}
+
 ExecutionPlanBuilder& ExecutionPlanBuilder::setHandle(miopenHandle_t handle) &
 {
     mExecutionPlan.mHandle = checkPtr(handle);
@@ -83,6 +156,7 @@ ExecutionPlan ExecutionPlanBuilder::build() &
 {
     if((mExecutionPlan.mHandle != nullptr && mEngineCfgSet) || mJsonRepresentationSet)
     {
+        mExecutionPlan.prepare();
         return mExecutionPlan;
     }
     else
@@ -95,6 +169,7 @@ ExecutionPlan ExecutionPlanBuilder::build() &&
 {
     if((mExecutionPlan.mHandle != nullptr && mEngineCfgSet) || mJsonRepresentationSet)
     {
+        mExecutionPlan.prepare();
         return std::move(mExecutionPlan);
     }
     else
@@ -25,12 +25,15 @@
  *
  *******************************************************************************/
 
+#include <miopen/env.hpp>
 #include <miopen/errors.hpp>
+#include <miopen/handle.hpp>
 #include <miopen/miopen.h>
 #include <miopen/graphapi/engine.hpp>
 #include <miopen/graphapi/matmul.hpp>
 #include <miopen/graphapi/opgraph.hpp>
 #include <miopen/graphapi/pointwise.hpp>
+#include <miopen/graphapi/pointwise_chain.hpp>
 #include <miopen/graphapi/reduction.hpp>
 #include <miopen/graphapi/reshape.hpp>
 #include <miopen/graphapi/rng.hpp>
@@ -38,13 +41,97 @@
 #include <miopen/graphapi/variant_pack.hpp>
 #include <miopen/graphapi/convolution.hpp>
 #include <miopen/graphapi/conv_bias_res_add_activ_forward_executor.hpp>
+#include <miopen/stats.hpp>
 #include <miopen/utility/scope.hpp>
 
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_GRAPHAPI_DISABLE_ENGINE_CACHE)
+
 namespace miopen {
 namespace graphapi {
 
 GraphPatternMatcher::~GraphPatternMatcher() = default;
 
+namespace {
+
+/// Group count implied by the channel counts of the convolution input and weights.
+int getConvolutionGroupCount(const OperationConvolutionForward& conv, const std::string& pattern)
+{
+    std::size_t in_c  = conv.getX()->GetLengths()[1];
+    std::size_t wei_c = conv.getW()->GetLengths()[1];
+
+    if(wei_c == std::size_t{0})
+    {
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "invalid weight tensor provided for graph matching " + pattern + " pattern");
+    }
+    else if(in_c % wei_c != std::size_t{0})
+    {
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "invalid group count from input and weight tensor for graph matching " +
+                         pattern + " pattern");
+    }
+
+    return static_cast<int>(in_c / wei_c);
+}
+
+using Find20ExecutorWrapper =
+    std::function<std::shared_ptr<GraphPatternExecutor>(std::shared_ptr<GraphExecutorFind20>)>;
+
+/// Sets the tensors of `tensorMap` on the Find 2.0 `problem`, finds its solutions and returns
+/// one engine per solution. `wrap`, when set, places each Find 2.0 executor into another one.
+std::vector<Engine> makeFind20Engines(OpGraph* graphPtr,
+                                      miopenProblem_t problem,
+                                      const std::shared_ptr<TensorInfoMap>& tensorMap,
+                                      const std::string& what,
+                                      const Find20ExecutorWrapper& wrap = {})
+{
+    for(auto& [k, v] : *tensorMap)
+    {
+        auto s = miopenSetProblemTensorDescriptor(problem, v.mEnumId, v.mGraphTensor);
+        MIOPEN_THROW_IF(s != miopenStatusSuccess,
+                        "failed while setting tensor descriptor for " + what);
+    }
+
+    std::vector<miopenSolution_t> solutions(10);
+    size_t numFound = 0;
+    auto s          = miopenFindSolutions(
+        graphPtr->getHandle(), problem, nullptr, solutions.data(), &numFound, solutions.size());
+    MIOPEN_THROW_IF(s != miopenStatusSuccess, "failed while finding solutions for " + what);
+
+    solutions.resize(numFound);
+
+    // Ensure miopenDestroySolution() will be called even if an exception occurs
+    scope_exit finallyForSolutions([&]() {
+        for(miopenSolution_t sol : solutions)
+        {
+            miopenDestroySolution(sol);
+        }
+    });
+
+    std::vector<Engine> engines;
+    engines.reserve(numFound);
+
+    size_t i = 0;
+    for(miopenSolution_t sol : solutions)
+    {
+        auto find20 = std::make_shared<GraphExecutorFind20>(std::move(deref(sol)), tensorMap);
+        std::shared_ptr<GraphPatternExecutor> exec = wrap ? wrap(std::move(find20)) : find20;
+
+        engines.emplace_back(
+            EngineBuilder().setGraph(graphPtr).setExecutor(exec).setGlobalIndex(i).build());
+        ++i;
+    }
+
+    return engines;
+}
+
+} // namespace
+
 class ConvBiasResAddActive_Fwd_Pattern : public GraphPatternMatcher
 {
     struct OperationPointwiseWithOneVirtualInput
@@ -145,23 +232,7 @@ public:
         auto* conv = dynamic_cast<OperationConvolutionForward*>(
             graph.findOutNeighByName(graph.getSourceNode(), "OP_CONVOLUTION_FORWARD"));
 
-        std::size_t in_c  = conv->getX()->GetLengths()[1];
-        std::size_t wei_c = conv->getW()->GetLengths()[1];
-
-        if(wei_c == std::size_t{0})
-        {
-            MIOPEN_THROW(
-                miopenStatusBadParm,
-                "invalid weight tensor provided for graph matching ConvBiasResAddActive pattern");
-        }
-        else if(in_c % wei_c != std::size_t{0})
-        {
-            MIOPEN_THROW(miopenStatusBadParm,
-                         "invalid group count from input and weight tensor for graph matching "
-                         "ConvBiasResAddActive pattern");
-        }
-
-        int groupCount = in_c / wei_c;
+        int groupCount = getConvolutionGroupCount(*conv, "ConvBiasResAddActive");
 
         auto* add1 =
             dynamic_cast<OperationPointwise*>(graph.findOutNeighByName(conv, "OP_POINTWISE:ADD"));
@@ -436,44 +507,7 @@ public:
         // Ensure miopenDestroyProblem() will be called even if an exception occurs
         scope_exit finallyForProblem([=]() { miopenDestroyProblem(mha_prob); });
 
-        for(auto& [k, v] : *tensor_map)
-        {
-            s = miopenSetProblemTensorDescriptor(mha_prob, v.mEnumId, v.mGraphTensor);
-            MIOPEN_THROW_IF(s != miopenStatusSuccess,
-                            "failed while setting tensor descriptor for mha fwd");
-        }
-
-        std::vector<miopenSolution_t> solutions(10);
-        size_t num_found = 0;
-        s                = miopenFindSolutions(
-            graph.getHandle(), mha_prob, nullptr, solutions.data(), &num_found, solutions.size());
-        MIOPEN_THROW_IF(s != miopenStatusSuccess, "failed while finding solutions for mha fwd");
-
-        solutions.resize(num_found);
-
-        // Ensure miopenDestroySolution() will be called even if an exception occurs
-        scope_exit finallyForSolutions([&]() {
-            for(miopenSolution_t sol : solutions)
-            {
-                miopenDestroySolution(sol);
-            }
-        });
-
-        std::vector<Engine> engines;
-        engines.reserve(num_found);
-
-        size_t i = 0;
-        for(miopenSolution_t sol : solutions)
-        {
-            std::shared_ptr<GraphPatternExecutor> exec =
-                std::make_shared<GraphExecutorFind20>(std::move(deref(sol)), tensor_map);
-
-            engines.emplace_back(
-                EngineBuilder().setGraph(graph_ptr).setExecutor(exec).setGlobalIndex(i).build());
-            ++i;
-        }
-
-        return engines;
+        return makeFind20Engines(graph_ptr, mha_prob, tensor_map, "mha fwd");
     }
 };
 
@@ -992,59 +1026,212 @@ public:
         // Ensure miopenDestroyProblem() will be called even if an exception occurs
         scope_exit finallyForProblem([=]() { miopenDestroyProblem(mhaProblem); });
 
-        for(auto& [k, v] : *tensorMap)
+        return makeFind20Engines(graphPtr, mhaProblem, tensorMap, "mha bwd");
+    }
+};
+
+namespace {
+
+/// Engines found for previously built graphs, keyed by the graph fingerprint and the device.
+/// Executors do not refer to the graph they were found for, so engines of an identical graph
+/// are reused by pointing them to the new graph. The least recently used entry is evicted
+/// when the cache is full.
+class EngineCache
+{
+public:
+    static constexpr std::size_t MaxSize = 1024;
+
+    struct Key
+    {
+        GraphFingerprint fingerprint;
+        std::string device;
+
+        std::size_t hash() const
         {
-            s = miopenSetProblemTensorDescriptor(mhaProblem, v.mEnumId, v.mGraphTensor);
-            MIOPEN_THROW_IF(s != miopenStatusSuccess,
-                            "failed while setting tensor descriptor for mha bwd");
+            auto seed = fingerprint.hash;
+            internal::hashCombine(seed, device);
+            return seed;
         }
+        friend bool operator==(const Key& l, const Key& r)
+        {
+            return l.fingerprint == r.fingerprint && l.device == r.device;
+        }
+    };
 
-        std::vector<miopenSolution_t> solutions(10);
-        size_t numFound = 0;
-        s               = miopenFindSolutions(
-            graph.getHandle(), mhaProblem, nullptr, solutions.data(), &numFound, solutions.size());
-        MIOPEN_THROW_IF(s != miopenStatusSuccess, "failed while finding solutions for mha bwd");
-
-        solutions.resize(numFound);
+    std::optional<std::vector<Engine>> find(const Key& key, OpGraph* graph)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto it = mIndex.find(key.hash());
+        // the whole key is compared, equal hashes of different graphs are a miss
+        if(it == mIndex.end() || !(it->second->first == key))
+        {
+            stats::Increment(stats::Counter::GraphEngineCacheMiss);
+            return std::nullopt;
+        }
+        stats::Increment(stats::Counter::GraphEngineCacheHit);
+        mEntries.splice(mEntries.begin(), mEntries, it->second);
 
-        // Ensure miopenDestroySolution() will be called even if an exception occurs
-        scope_exit finallyForSolutions([&]() {
-            for(miopenSolution_t sol : solutions)
+        const auto& cached_engines = it->second->second;
+        std::vector<Engine> engines;
+        engines.reserve(cached_engines.size());
+        for(const auto& cached : cached_engines)
+        {
+            EngineBuilder builder;
+            builder.setGraph(graph)
+                .setExecutor(cached.getExecutor())
+                .setGlobalIndex(cached.getGlobalIndex());
+            if(cached.getSmCount() > 0)
             {
-                miopenDestroySolution(sol);
+                builder.setSmCount(cached.getSmCount());
             }
-        });
-
-        std::vector<Engine> engines;
-        engines.reserve(numFound);
-
-        size_t i = 0;
-        std::transform(solutions.cbegin(),
-                       solutions.cend(),
-                       std::back_inserter(engines),
-                       [&i, tensorMap, graphPtr](miopenSolution_t sol) -> Engine {
-                           return EngineBuilder()
-                               .setGraph(graphPtr)
-                               .setExecutor(std::make_shared<GraphExecutorFind20>(
-                                   std::move(deref(sol)), tensorMap))
-                               .setGlobalIndex(i++)
-                               .build();
-                       });
-
+            engines.emplace_back(builder.build());
+        }
         return engines;
     }
+
+    void insert(Key key, const std::vector<Engine>& engines)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        const auto hash = key.hash();
+        if(auto it = mIndex.find(hash); it != mIndex.end())
+        {
+            mEntries.erase(it->second);
+            mIndex.erase(it);
+        }
+        else if(mEntries.size() >= MaxSize)
+        {
+            mIndex.erase(mEntries.back().first.hash());
+            mEntries.pop_back();
+        }
+        mEntries.emplace_front(std::move(key), engines);
+        mIndex.emplace(hash, mEntries.begin());
+    }
+
+private:
+    using Entries = std::list<std::pair<Key, std::vector<Engine>>>; // most recently used first
+
+    std::mutex mMutex;
+    Entries mEntries;
+    std::unordered_map<std::size_t, Entries::iterator> mIndex;
 };
 
-std::vector<Engine> findEngines(OpGraph* graph)
+EngineCache& getEngineCache()
 {
-    assert(graph);
+    static EngineCache cache;
+    return cache;
+}
+
+std::optional<EngineCache::Key> getEngineCacheKey(const OpGraph& graph)
+{
+    if(env::enabled(MIOPEN_DEBUG_GRAPHAPI_DISABLE_ENGINE_CACHE) || graph.getHandle() == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    auto fingerprint = graph.getFingerprint();
+    if(!fingerprint)
+    {
+        return std::nullopt;
+    }
+    return EngineCache::Key{*std::move(fingerprint), deref(graph.getHandle()).GetDbBasename()};
+}
+
+/// Generic fallback fusing any chain of elementwise ops, optionally fed by a convolution,
+/// into one generated kernel.
+class PointwiseChain_Pattern : public GraphPatternMatcher
+{
+    static std::vector<Engine> getConvolutionEngines(OpGraph* graph_ptr,
+                                                     const PointwiseChain& chain)
+    {
+        auto* conv = dynamic_cast<OperationConvolutionForward*>(chain.mAnchor);
+        assert(conv);
+
+        auto conv_desc = makeConvolutionDescriptor(
+            *conv->getConvolution(), getConvolutionGroupCount(*conv, "pointwise chain"));
+
+        miopenProblem_t conv_prob;
+        auto s = miopenCreateConvProblem(&conv_prob, &conv_desc, miopenProblemDirectionForward);
+        MIOPEN_THROW_IF(s != miopenStatusSuccess,
+                        "failed while creating problem for pointwise chain convolution");
+
+        // Ensure miopenDestroyProblem() will be called even if an exception occurs
+        scope_exit finallyForProblem([=]() { miopenDestroyProblem(conv_prob); });
+
+        auto tensor_map = std::make_shared<TensorInfoMap>();
+        tensor_map->try_emplace(conv->getX()->getId(),
+                                TensorInfo(miopenTensorConvolutionX, conv->getX()));
+        tensor_map->try_emplace(conv->getW()->getId(),
+                                TensorInfo(miopenTensorConvolutionW, conv->getW()));
+        tensor_map->try_emplace(conv->getY()->getId(),
+                                TensorInfo(miopenTensorConvolutionY, conv->getY()));
+
+        return makeFind20Engines(graph_ptr,
+                                 conv_prob,
+                                 tensor_map,
+                                 "pointwise chain convolution",
+                                 [&](std::shared_ptr<GraphExecutorFind20> anchor) {
+                                     return std::make_shared<PointwiseChainExecutor>(chain,
+                                                                                     anchor);
+                                 });
+    }
+
+public:
+    static std::unique_ptr<GraphPatternMatcher> Make()
+    {
+        return std::make_unique<PointwiseChain_Pattern>();
+    }
+
+    std::string_view name() const final
+    {
+        static const std::string_view n{"pointwise_chain"};
+        return n;
+    }
+
+    // Matmul and reduction anchors are recognized by the analysis, but have no Find 2.0
+    // problem to produce the anchor output yet.
+    bool matches(const OpGraph* graph_ptr) const final
+    {
+        assert(graph_ptr);
+        const auto chain = analyzePointwiseChain(*graph_ptr);
+        return chain && (chain->mAnchorKind == PointwiseChainAnchor::None ||
+                         chain->mAnchorKind == PointwiseChainAnchor::Convolution);
+    }
+
+    std::vector<Engine> getEngines(OpGraph* graph_ptr) const override
+    {
+        assert(graph_ptr);
+        assert(matches(graph_ptr));
+
+        const auto chain = analyzePointwiseChain(*graph_ptr);
+
+        if(chain->mAnchorKind == PointwiseChainAnchor::Convolution)
+            return getConvolutionEngines(graph_ptr, *chain);
+
+        std::shared_ptr<GraphPatternExecutor> exec =
+            std::make_shared<PointwiseChainExecutor>(*chain);
+        return {EngineBuilder().setGraph(graph_ptr).setExecutor(exec).setGlobalIndex(0).build()};
+    }
+};
 
-    std::vector<std::unique_ptr<GraphPatternMatcher>> patterns;
-    patterns.emplace_back(MHA_Fwd_F8_Pattern::Make());
-    patterns.emplace_back(MHA_Bwd_F8_Pattern::Make());
-    patterns.emplace_back(ConvBiasResAddActive_Fwd_Pattern::Make());
+/// Matchers are stateless and compare the signature computed when the graph was built, so
+/// the graph is analyzed once no matter how many patterns are tried.
+const std::vector<std::unique_ptr<GraphPatternMatcher>>& getPatterns()
+{
+    static const auto patterns = [] {
+        std::vector<std::unique_ptr<GraphPatternMatcher>> ret;
+        ret.emplace_back(MHA_Fwd_F8_Pattern::Make());
+        ret.emplace_back(MHA_Bwd_F8_Pattern::Make());
+        ret.emplace_back(ConvBiasResAddActive_Fwd_Pattern::Make());
+        // Generic fallback, must stay after the specialized patterns
+        ret.emplace_back(PointwiseChain_Pattern::Make());
+        return ret;
+    }();
+    return patterns;
+}
 
-    for(const auto& p : patterns)
+std::vector<Engine> matchEngines(OpGraph* graph)
+{
+    for(const auto& p : getPatterns())
     {
         if(p->matches(graph))
         {
@@ -1056,5 +1243,30 @@ std::vector<Engine> findEngines(OpGraph* graph)
     return {};
 }
 
+} // namespace
+
+std::vector<Engine> findEngines(OpGraph* graph)
+{
+    assert(graph);
+
+    auto key = getEngineCacheKey(*graph);
+    if(key)
+    {
+        if(auto engines = getEngineCache().find(*key, graph))
+        {
+            MIOPEN_LOG_I2("Reusing " << engines->size() << " engines of an identical graph");
+            return *std::move(engines);
+        }
+    }
+
+    auto engines = matchEngines(graph);
+
+    if(key)
+    {
+        getEngineCache().insert(*std::move(key), engines);
+    }
+    return engines;
+}
+
 } // end namespace graphapi
 } // end namespace miopen
@@ -104,6 +104,16 @@ void BackendMatmulDescriptor::getAttribute(miopenBackendAttributeName_t attribut
     }
 }
 
+bool OperationMatmul::hashAttributes(internal::NodeKey& seed) const
+{
+    internal::hashCombine(seed, mMatmul->getComputeType());
+    internal::hashCombine(seed, mBatchCount);
+    internal::hashTensor(seed, mGemmMOverride);
+    internal::hashTensor(seed, mGemmNOverride);
+    internal::hashTensor(seed, mGemmKOverride);
+    return true;
+}
+
 OperationMatmulBuilder& OperationMatmulBuilder::setA(Tensor* A)
 {
     mOperationMatmul.mA = checkPtr(A);
@@ -0,0 +1,154 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/errors.hpp>
+#include <miopen/graphapi/memory_plan.hpp>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace miopen {
+
+namespace graphapi {
+
+namespace {
+
+std::size_t alignUp(std::size_t size) noexcept
+{
+    return (size + MemoryPlan::Alignment - 1) / MemoryPlan::Alignment * MemoryPlan::Alignment;
+}
+
+} // namespace
+
+void to_json(nlohmann::json& json, const MemoryPlan& plan)
+{
+    json = nlohmann::json{
+        {"offsets", plan.mOffsets},
+        {"arena_size", plan.mArenaSize},
+    };
+}
+
+void from_json(const nlohmann::json& json, MemoryPlan& plan)
+{
+    json.at("offsets").get_to(plan.mOffsets);
+    json.at("arena_size").get_to(plan.mArenaSize);
+}
+
+std::vector<BufferLifetime> getBufferLifetimes(const OpGraph& graph,
+                                               const std::vector<int64_t>& tensorIds)
+{
+    const auto order = topologicalSort(graph);
+
+    std::unordered_map<const OpNode*, std::size_t> steps;
+    for(std::size_t i = 0; i < order.size(); ++i)
+        steps.emplace(order[i], i);
+
+    std::unordered_map<int64_t, BufferLifetime> lifetimes;
+    for(auto id : tensorIds)
+        lifetimes.emplace(id, BufferLifetime{id});
+
+    for(const OpNode* node : order)
+    {
+        const auto first = steps.at(node);
+        for(const auto& [dst, tensor] : graph.getOutEdges(node))
+        {
+            auto it = lifetimes.find(tensor->getId());
+            if(it == lifetimes.end())
+                continue;
+
+            MIOPEN_THROW_IF(!tensor->isVirtual(), "Only virtual tensors are planned in memory");
+
+            // the sink consumes graph outputs after the last node
+            const auto last = dst == graph.getSinkNode() ? order.size() : steps.at(dst);
+            auto& lifetime  = it->second;
+            lifetime.mSize  = tensor->GetNumBytes();
+            lifetime.mFirst = first;
+            lifetime.mLast  = std::max({lifetime.mLast, first, last});
+        }
+    }
+
+    std::vector<BufferLifetime> result;
+    result.reserve(tensorIds.size());
+    for(auto id : tensorIds)
+    {
+        const auto& lifetime = lifetimes.at(id);
+        MIOPEN_THROW_IF(lifetime.mSize == 0, "No virtual tensor with such id in the graph");
+        result.push_back(lifetime);
+    }
+    return result;
+}
+
+MemoryPlan planMemory(std::vector<BufferLifetime> buffers)
+{
+    std::sort(buffers.begin(), buffers.end(), [](const auto& a, const auto& b) {
+        return a.mSize != b.mSize ? a.mSize > b.mSize : a.mFirst < b.mFirst;
+    });
+
+    struct Placement
+    {
+        std::size_t mOffset;
+        std::size_t mEnd;
+        const BufferLifetime* mBuffer;
+    };
+
+    MemoryPlan plan;
+    std::vector<Placement> placed;
+    placed.reserve(buffers.size());
+
+    for(const auto& buffer : buffers)
+    {
+        // placements live at the same time, by offset
+        std::vector<const Placement*> overlapping;
+        for(const auto& p : placed)
+        {
+            if(p.mBuffer->mFirst <= buffer.mLast && buffer.mFirst <= p.mBuffer->mLast)
+                overlapping.push_back(&p);
+        }
+        std::sort(overlapping.begin(), overlapping.end(), [](auto* a, auto* b) {
+            return a->mOffset < b->mOffset;
+        });
+
+        const auto size    = alignUp(buffer.mSize);
+        std::size_t offset = 0;
+        for(const auto* p : overlapping)
+        {
+            if(offset + size <= p->mOffset)
+                break;
+            offset = std::max(offset, p->mEnd);
+        }
+
+        placed.push_back({offset, offset + size, &buffer});
+        plan.mOffsets.emplace_back(buffer.mId, offset);
+        plan.mArenaSize = std::max(plan.mArenaSize, offset + size);
+    }
+
+    return plan;
+}
+
+} // namespace graphapi
+
+} // namespace miopen
@@ -28,14 +28,278 @@
 #include <miopen/graphapi/opgraph.hpp>
 #include <miopen/graphapi/engine.hpp>
 
+#include <algorithm>
 #include <deque>
+#include <limits>
+#include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace miopen {
 namespace graphapi {
 
 OpNode::~OpNode() = default;
 
+bool OpNode::hashAttributes([[maybe_unused]] internal::NodeKey& seed) const { return false; }
+
+namespace internal {
+
+void hashTensor(NodeKey& seed, const Tensor* tensor)
+{
+    if(tensor == nullptr)
+    {
+        hashCombine(seed, int64_t{0});
+        return;
+    }
+
+    hashCombine(seed, tensor->getId());
+    hashCombine(seed, tensor->isVirtual());
+    hashCombine(seed, tensor->GetType());
+    hashCombine(seed, tensor->GetCastType().has_value());
+    if(tensor->GetCastType())
+        hashCombine(seed, *tensor->GetCastType());
+    hashCombine(seed, tensor->GetNumDims());
+    for(auto len : tensor->GetLengths())
+        hashCombine(seed, len);
+    for(auto stride : tensor->GetStrides())
+        hashCombine(seed, stride);
+}
+
+} // end namespace internal
+
+namespace {
+
+/// The ops of the graph followed by its source and sink nodes.
+std::vector<const OpNode*> allNodes(const OpGraph& graph)
+{
+    std::vector<const OpNode*> nodes(graph.getNodes().cbegin(), graph.getNodes().cend());
+    nodes.emplace_back(graph.getSourceNode());
+    nodes.emplace_back(graph.getSinkNode());
+    return nodes;
+}
+
+std::unordered_map<const OpNode*, std::size_t> indexNodes(const std::vector<const OpNode*>& nodes)
+{
+    std::unordered_map<const OpNode*, std::size_t> index;
+    for(std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        index.emplace(nodes[i], i);
+    }
+    return index;
+}
+
+/// Weisfeiler-Lehman refinement over op names: every node starts with the hash of its name and
+/// is relabeled from the sorted labels of its in and out neighbors until the partition of the
+/// nodes into classes stops getting finer. Returns the labels of allNodes(graph).
+std::vector<std::size_t> weisfeilerLehmanLabels(const OpGraph& graph)
+{
+    const auto nodes = allNodes(graph);
+    const auto index = indexNodes(nodes);
+
+    std::vector<std::size_t> labels(nodes.size());
+    std::transform(nodes.cbegin(), nodes.cend(), labels.begin(), [](const OpNode* n) {
+        return std::hash<std::string>{}(n->signName());
+    });
+
+    const auto count_classes = [](const std::vector<std::size_t>& v) {
+        return std::unordered_set<std::size_t>(v.cbegin(), v.cend()).size();
+    };
+
+    std::vector<std::size_t> next(nodes.size());
+    std::vector<std::size_t> neighbors;
+    std::size_t num_classes = count_classes(labels);
+
+    const auto hash_neighbors = [&](std::size_t& seed, const std::vector<Edge>& edges) {
+        neighbors.clear();
+        for(const auto& [n, tens_ptr] : edges)
+        {
+            std::ignore = tens_ptr;
+            neighbors.emplace_back(labels[index.at(n)]);
+        }
+        std::sort(neighbors.begin(), neighbors.end());
+        internal::hashCombine(seed, neighbors.size());
+        for(auto label : neighbors)
+        {
+            internal::hashCombine(seed, label);
+        }
+    };
+
+    for(std::size_t round = 0; round < nodes.size(); ++round)
+    {
+        for(std::size_t i = 0; i < nodes.size(); ++i)
+        {
+            std::size_t seed = labels[i];
+            hash_neighbors(seed, graph.getInEdges(nodes[i]));
+            hash_neighbors(seed, graph.getOutEdges(nodes[i]));
+            next[i] = seed;
+        }
+        labels.swap(next);
+
+        const auto refined_classes = count_classes(labels);
+        if(refined_classes == num_classes)
+        {
+            break;
+        }
+        num_classes = refined_classes;
+    }
+
+    return labels;
+}
+
+/// The sorted final labels do not depend on the order of the nodes.
+std::size_t weisfeilerLehmanHash(const OpGraph& graph)
+{
+    auto labels = weisfeilerLehmanLabels(graph);
+    std::sort(labels.begin(), labels.end());
+    std::size_t result = 0;
+    internal::hashCombine(result, labels.size());
+    for(auto label : labels)
+    {
+        internal::hashCombine(result, label);
+    }
+    return result;
+}
+
+/// Number of edges from every node to every node of allNodes(graph), row-major.
+std::vector<std::size_t> adjacencyMatrix(const OpGraph& graph,
+                                         const std::vector<const OpNode*>& nodes)
+{
+    const auto index = indexNodes(nodes);
+    std::vector<std::size_t> adjacency(nodes.size() * nodes.size());
+    for(std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        for(const auto& [dst, tens_ptr] : graph.getOutEdges(nodes[i]))
+        {
+            std::ignore = tens_ptr;
+            ++adjacency[i * nodes.size() + index.at(dst)];
+        }
+    }
+    return adjacency;
+}
+
+/// Exact test: searches for a mapping of the nodes of left onto the nodes of right which keeps
+/// op names and edge multiplicities. Only nodes with equal Weisfeiler-Lehman labels are tried
+/// as images of each other, which leaves little to backtrack on the graphs of the patterns.
+bool findIsomorphism(const OpGraph& left, const OpGraph& right)
+{
+    const auto l_nodes     = allNodes(left);
+    const auto r_nodes     = allNodes(right);
+    const auto l_labels    = weisfeilerLehmanLabels(left);
+    const auto r_labels    = weisfeilerLehmanLabels(right);
+    const auto l_adjacency = adjacencyMatrix(left, l_nodes);
+    const auto r_adjacency = adjacencyMatrix(right, r_nodes);
+
+    const auto size     = l_nodes.size();
+    constexpr auto none = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> mapping(size, none);
+    std::vector<bool> used(size, false);
+
+    const auto fits = [&](std::size_t l, std::size_t r) {
+        if(used[r] || l_labels[l] != r_labels[r] ||
+           l_nodes[l]->signName() != r_nodes[r]->signName())
+        {
+            return false;
+        }
+        // the source and the sink are the last two nodes of both graphs
+        if((l >= size - 2 || r >= size - 2) && l != r)
+        {
+            return false;
+        }
+        if(l_adjacency[l * size + l] != r_adjacency[r * size + r])
+        {
+            return false;
+        }
+        for(std::size_t k = 0; k < size; ++k)
+        {
+            if(mapping[k] == none)
+                continue;
+            if(l_adjacency[l * size + k] != r_adjacency[r * size + mapping[k]] ||
+               l_adjacency[k * size + l] != r_adjacency[mapping[k] * size + r])
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    const auto search = [&](std::size_t l, const auto& self) -> bool {
+        if(l == size)
+        {
+            return true;
+        }
+        for(std::size_t r = 0; r < size; ++r)
+        {
+            if(!fits(l, r))
+                continue;
+            mapping[l] = r;
+            used[r]    = true;
+            if(self(l + 1, self))
+            {
+                return true;
+            }
+            mapping[l] = none;
+            used[r]    = false;
+        }
+        return false;
+    };
+
+    return search(0, search);
+}
+
+GraphSignature makeSignature(const OpGraph& graph)
+{
+    GraphSignature sig;
+    sig.mNumEdges     = graph.numEdges();
+    sig.mNodeNames    = graph.getNodeNames();
+    sig.mInOutDegrees = graph.getInOutDegrees();
+    std::sort(sig.mNodeNames.begin(), sig.mNodeNames.end());
+    std::sort(sig.mInOutDegrees.begin(), sig.mInOutDegrees.end());
+
+    sig.mStructuralHash = weisfeilerLehmanHash(graph);
+    return sig;
+}
+
+} // namespace
+
+std::vector<OpNode*> topologicalSort(const OpGraph& graph)
+{
+    // Kahn's algorithm: a node is ready once all nodes producing its inputs are ordered
+    std::unordered_map<const OpNode*, std::size_t> in_degrees;
+    std::vector<OpNode*> ready;
+    std::vector<OpNode*> order;
+    order.reserve(graph.numNodes());
+
+    for(OpNode* n : graph.getNodes())
+    {
+        const auto in_degree = graph.getInEdges(n).size();
+        in_degrees.emplace(n, in_degree);
+        if(in_degree == 0)
+            ready.emplace_back(n);
+    }
+
+    const auto release = [&](const OpNode* n) {
+        for(const auto& [dst, tens_ptr] : graph.getOutEdges(n))
+        {
+            std::ignore = tens_ptr;
+            auto it     = in_degrees.find(dst);
+            if(it != in_degrees.end() && --it->second == 0)
+                ready.emplace_back(dst);
+        }
+    };
+
+    release(graph.getSourceNode());
+    while(!ready.empty())
+    {
+        OpNode* n = ready.back();
+        ready.pop_back();
+        order.emplace_back(n);
+        release(n);
+    }
+
+    MIOPEN_THROW_IF(order.size() != graph.numNodes(), "OpGraph contains a cycle");
+    return order;
+}
+
 OpGraph OpGraphBuilder::build() &&
 {
     if(mNodes.empty())
@@ -99,16 +363,17 @@ OpGraph OpGraphBuilder::build() &&
         }
     }
 
+    std::ignore = topologicalSort(graph); // rejects cycles
+    graph.mSignature = makeSignature(graph);
+
     return graph;
 }
 
 void OpGraph::initEngines()
 {
     // cache the engines in the graph.
-    // NOTE(amber): this may be expensive and there may be benefit in delaying
-    // findEngines to when the user calls it instead of calling it at graph build
-    // time, but cudnn graph API has semantics that suggest that graph knows its
-    // engines or engine count at least.
+    // NOTE: findEngines may be expensive, so it runs when the engines or the engine count
+    // are first queried instead of at graph build time.
     //
     /// \todo findEngines takes pointer to the graph and uses it to construct
     // engines. This pointer  may become invalid when the graph object is moved. Fix
@@ -117,10 +382,18 @@ void OpGraph::initEngines()
     mEngines = findEngines(this);
 }
 
+const std::vector<Engine>& OpGraph::getEngines()
+{
+    if(!mEngines)
+    {
+        initEngines();
+    }
+    return *mEngines;
+}
+
 VecOfPaths OpGraph::getAllPaths() const
 {
-    /// \todo does not check for cycles. Use DFS to first check for cycles
-    /// at construction time perhaps. --amberhassaan May, 2024
+    // OpGraphBuilder::build() rejects graphs with cycles, so the loop below terminates
     VecOfPaths all_paths;
 
     std::deque<Path> paths_to_explore;
@@ -154,158 +427,100 @@ VecOfPaths OpGraph::getAllPaths() const
     return all_paths;
 }
 
-std::string pathToStr(const Path& path)
+std::optional<GraphFingerprint> OpGraph::getFingerprint() const
 {
-    std::ostringstream oss;
-    for(const OpNode* n : path)
-    {
-        oss << n->signName() << ",";
-    }
-    return oss.str();
-}
-
-namespace internal {
-
-using MapSizeToPathVec = std::unordered_map<size_t, VecOfPaths>;
-
-bool checkSameNodesByName(const OpGraph& left, const OpGraph& right)
-{
-    auto l_names = left.getNodeNames();
-    auto r_names = right.getNodeNames();
-    if(l_names.size() != r_names.size())
-    {
-        return false;
-    }
-
-    std::sort(l_names.begin(), l_names.end());
-    std::sort(r_names.begin(), r_names.end());
-
-    return l_names == r_names;
-}
-
-bool checkSameDegreeVecs(const OpGraph& left, const OpGraph& right)
-{
-    auto l_degs = left.getInOutDegrees();
-    auto r_degs = right.getInOutDegrees();
+    std::vector<internal::NodeKey> keys;
+    keys.reserve(mNodes.size());
 
-    std::sort(l_degs.begin(), l_degs.end());
-    std::sort(r_degs.begin(), r_degs.end());
-    return l_degs == r_degs;
-}
-
-auto groupBySize(VecOfPaths&& all_paths)
-{
-    MapSizeToPathVec paths_by_size;
-
-    for(auto& p : all_paths)
+    for(const OpNode* n : mNodes)
     {
-        auto [it, _ignore] = paths_by_size.emplace(p.size(), VecOfPaths{});
-        it->second.emplace_back(std::move(p));
-    }
-
-    return paths_by_size;
-}
-
-bool checkSamePathVecs(const VecOfPaths& left, const VecOfPaths& right)
-{
-    if(left.size() != right.size())
-    {
-        return false;
-    }
-
-    using VecOfStr = std::vector<std::string>;
-
-    auto pathvec_to_strvec = [](const VecOfPaths& pathvec) {
-        VecOfStr ret;
-        for(const Path& path : pathvec)
+        internal::NodeKey key;
+        key.hash   = std::hash<std::string>{}(n->signName());
+        key.values = n->signName();
+        key.values.push_back('\0');
+        if(!n->hashAttributes(key))
         {
-            ret.emplace_back(pathToStr(path));
+            return std::nullopt;
         }
-        return ret;
-    };
-
-    VecOfStr l_paths_as_str = pathvec_to_strvec(left);
-    VecOfStr r_paths_as_str = pathvec_to_strvec(right);
-
-    std::sort(l_paths_as_str.begin(), l_paths_as_str.end());
-    std::sort(r_paths_as_str.begin(), r_paths_as_str.end());
-
-    return l_paths_as_str == r_paths_as_str;
-}
-
-bool checkSamePaths(const OpGraph& left, const OpGraph& right)
-{
-
-    auto l_paths = left.getAllPaths();
-    auto r_paths = right.getAllPaths();
-
-    if(l_paths.size() != r_paths.size())
-    {
-        return false;
-    }
-
-    auto l_paths_by_sz = groupBySize(std::move(l_paths));
-    auto r_paths_by_sz = groupBySize(std::move(r_paths));
-
-    auto get_keys = [](const MapSizeToPathVec& paths_by_size) {
-        std::vector<size_t> keys{};
-        for(const auto& [k, v] : paths_by_size)
+        // tensors in op order, so that swapping inputs of an op changes the fingerprint
+        internal::hashCombine(key, n->getInTensors().size());
+        for(const Tensor* t : n->getInTensors())
         {
-            keys.emplace_back(k);
+            internal::hashTensor(key, t);
         }
-        return keys;
-    };
+        internal::hashCombine(key, n->getOutTensors().size());
+        for(const Tensor* t : n->getOutTensors())
+        {
+            internal::hashTensor(key, t);
+        }
+        keys.emplace_back(std::move(key));
+    }
 
-    auto l_keys = get_keys(l_paths_by_sz);
-    auto r_keys = get_keys(r_paths_by_sz);
+    // the producers and consumers of every tensor follow from the tensor ids in the keys
+    std::sort(keys.begin(), keys.end(), [](const auto& l, const auto& r) {
+        return std::tie(l.hash, l.values) < std::tie(r.hash, r.values);
+    });
 
-    if(l_keys != r_keys)
+    GraphFingerprint fingerprint;
+    internal::hashCombine(fingerprint.hash, keys.size());
+    fingerprint.nodes.reserve(keys.size());
+    for(auto& key : keys)
     {
-        return false;
+        internal::hashCombine(fingerprint.hash, key.hash);
+        fingerprint.nodes.emplace_back(std::move(key.values));
     }
+    return fingerprint;
+}
 
-    for(size_t k : l_keys)
+std::string pathToStr(const Path& path)
+{
+    std::ostringstream oss;
+    for(const OpNode* n : path)
     {
-        if(!checkSamePathVecs(l_paths_by_sz[k], r_paths_by_sz[k]))
-        {
-            return false;
-        }
+        oss << n->signName() << ",";
     }
-
-    return true;
+    return oss.str();
 }
 
-} // end namespace internal
-
 bool isIsomorphic(const OpGraph& left, const OpGraph& right)
 {
-    if(left.numNodes() != right.numNodes())
+    const auto& l_sig = left.getSignature();
+    const auto& r_sig = right.getSignature();
+
+    if(l_sig.mNodeNames.size() != r_sig.mNodeNames.size())
     {
         MIOPEN_LOG_I2("test failed due to num nodes being different");
         return false;
     }
 
-    if(left.numEdges() != right.numEdges())
+    if(l_sig.mNumEdges != r_sig.mNumEdges)
     {
         MIOPEN_LOG_I2("test failed due to num edges being different");
         return false;
     }
 
-    if(!internal::checkSameNodesByName(left, right))
+    if(l_sig.mNodeNames != r_sig.mNodeNames)
     {
         MIOPEN_LOG_I2("test failed due to node names being different");
         return false;
     }
 
-    if(!internal::checkSameDegreeVecs(left, right))
+    if(l_sig.mInOutDegrees != r_sig.mInOutDegrees)
     {
         MIOPEN_LOG_I2("test failed due to node degrees being different");
         return false;
     }
 
-    if(!internal::checkSamePaths(left, right))
+    // equal hashes don't prove the graphs are isomorphic, only different ones disprove it
+    if(l_sig.mStructuralHash != r_sig.mStructuralHash)
+    {
+        MIOPEN_LOG_I2("test failed due to graph hashes being different");
+        return false;
+    }
+
+    if(!findIsomorphism(left, right))
     {
-        MIOPEN_LOG_I2("test failed due to paths being different");
+        MIOPEN_LOG_I2("test failed due to no node mapping preserving the edges");
         return false;
     }
 
@@ -387,8 +602,7 @@ void BackendOperationGraphDescriptor::finalize()
     {
         MIOPEN_THROW(miopenStatusBadParm);
     }
-    mOpGraph = std::move(mBuilder).build();
-    mOpGraph.initEngines();
+    mOpGraph   = std::move(mBuilder).build();
     mFinalized = true;
 }
 
@@ -460,6 +460,27 @@ const std::string& OperationPointwise::signName() const
     }
 }
 
+bool OperationPointwise::hashAttributes(internal::NodeKey& seed) const
+{
+    const auto hash_fp = [&seed](auto value) {
+        std::visit([&seed](auto v) { internal::hashCombine(seed, static_cast<double>(v)); },
+                   value);
+    };
+
+    internal::hashCombine(seed, mPointwise->getMathPrecision());
+    internal::hashCombine(seed, mPointwise->getNanPropagation());
+    hash_fp(mPointwise->getReluLowerClip());
+    hash_fp(mPointwise->getReluUpperClip());
+    hash_fp(mPointwise->getReluLowerClipSlope());
+    hash_fp(mPointwise->getEluAlpha());
+    hash_fp(mPointwise->getSoftPlusBeta());
+    hash_fp(mPointwise->getSwishBeta());
+    internal::hashCombine(seed, mPointwise->getAxis());
+    hash_fp(mAlpha1);
+    hash_fp(mAlpha2);
+    return true;
+}
+
 std::vector<Tensor*> OperationPointwise::getInTensors() const
 {
     switch(mPointwise->getMode())
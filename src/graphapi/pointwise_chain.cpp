@@ -0,0 +1,693 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/errors.hpp>
+#include <miopen/graphapi/convolution.hpp>
+#include <miopen/graphapi/matmul.hpp>
+#include <miopen/graphapi/pointwise.hpp>
+#include <miopen/graphapi/pointwise_chain.hpp>
+#include <miopen/graphapi/reduction.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/kernel_build_params.hpp>
+#include <miopen/tensor_view_utils.hpp>
+#include <nlohmann/json.hpp>
+
+#include "../kernels/pointwise_chain_args.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <variant>
+
+namespace miopen {
+
+namespace graphapi {
+
+static_assert(PointwiseProgram::MaxInputs == PW_CHAIN_MAX_INPUTS);
+static_assert(PointwiseProgram::MaxOutputs == PW_CHAIN_MAX_OUTPUTS);
+static_assert(PointwiseProgram::MaxInstructions == PW_CHAIN_MAX_OPS);
+static_assert(std::size(PointwiseInstruction{}.mConstants) == PW_CHAIN_NUM_CONSTANTS);
+
+namespace {
+
+/// Name of the mode in MIOpenPointwiseChain.cpp, nullptr if the kernel doesn't implement it
+const char* getKernelModeName(miopenPointwiseMode_t mode)
+{
+    switch(mode)
+    {
+    case MIOPEN_POINTWISE_ADD: return "PW_MODE_ADD";
+    case MIOPEN_POINTWISE_ADD_SQUARE: return "PW_MODE_ADD_SQUARE";
+    case MIOPEN_POINTWISE_DIV: return "PW_MODE_DIV";
+    case MIOPEN_POINTWISE_MAX: return "PW_MODE_MAX";
+    case MIOPEN_POINTWISE_MIN: return "PW_MODE_MIN";
+    case MIOPEN_POINTWISE_MOD: return "PW_MODE_MOD";
+    case MIOPEN_POINTWISE_MUL: return "PW_MODE_MUL";
+    case MIOPEN_POINTWISE_POW: return "PW_MODE_POW";
+    case MIOPEN_POINTWISE_SUB: return "PW_MODE_SUB";
+    case MIOPEN_POINTWISE_ABS: return "PW_MODE_ABS";
+    case MIOPEN_POINTWISE_CEIL: return "PW_MODE_CEIL";
+    case MIOPEN_POINTWISE_COS: return "PW_MODE_COS";
+    case MIOPEN_POINTWISE_EXP: return "PW_MODE_EXP";
+    case MIOPEN_POINTWISE_FLOOR: return "PW_MODE_FLOOR";
+    case MIOPEN_POINTWISE_LOG: return "PW_MODE_LOG";
+    case MIOPEN_POINTWISE_NEG: return "PW_MODE_NEG";
+    case MIOPEN_POINTWISE_RSQRT: return "PW_MODE_RSQRT";
+    case MIOPEN_POINTWISE_SIN: return "PW_MODE_SIN";
+    case MIOPEN_POINTWISE_SQRT: return "PW_MODE_SQRT";
+    case MIOPEN_POINTWISE_TAN: return "PW_MODE_TAN";
+    case MIOPEN_POINTWISE_IDENTITY: return "PW_MODE_IDENTITY";
+    case MIOPEN_POINTWISE_RELU_FWD: return "PW_MODE_RELU_FWD";
+    case MIOPEN_POINTWISE_TANH_FWD: return "PW_MODE_TANH_FWD";
+    case MIOPEN_POINTWISE_SIGMOID_FWD: return "PW_MODE_SIGMOID_FWD";
+    case MIOPEN_POINTWISE_ELU_FWD: return "PW_MODE_ELU_FWD";
+    case MIOPEN_POINTWISE_GELU_FWD: return "PW_MODE_GELU_FWD";
+    case MIOPEN_POINTWISE_SOFTPLUS_FWD: return "PW_MODE_SOFTPLUS_FWD";
+    case MIOPEN_POINTWISE_SWISH_FWD: return "PW_MODE_SWISH_FWD";
+    case MIOPEN_POINTWISE_GELU_APPROX_TANH_FWD: return "PW_MODE_GELU_APPROX_TANH_FWD";
+    case MIOPEN_POINTWISE_RECIPROCAL: return "PW_MODE_RECIPROCAL";
+    default: return nullptr;
+    }
+}
+
+PointwiseChainAnchor getAnchorKind(const OpNode* node)
+{
+    if(dynamic_cast<const OperationConvolutionForward*>(node) != nullptr)
+        return PointwiseChainAnchor::Convolution;
+    if(dynamic_cast<const OperationMatmul*>(node) != nullptr)
+        return PointwiseChainAnchor::Matmul;
+    if(dynamic_cast<const OperationReduction*>(node) != nullptr)
+        return PointwiseChainAnchor::Reduction;
+    return PointwiseChainAnchor::None;
+}
+
+PointwiseInstruction makeInstruction(const OperationPointwise& op)
+{
+    const auto to_float = [](auto value) {
+        return std::visit([](auto v) { return static_cast<float>(v); }, value);
+    };
+    const auto* pointwise = op.getPointwise();
+
+    PointwiseInstruction instruction;
+    instruction.mMode         = pointwise->getMode();
+    instruction.mConstants[0] = to_float(op.getAlpha1());
+    instruction.mConstants[1] = to_float(op.getAlpha2());
+
+    switch(instruction.mMode)
+    {
+    case MIOPEN_POINTWISE_RELU_FWD:
+        instruction.mConstants[2] = to_float(pointwise->getReluLowerClip());
+        instruction.mConstants[3] = to_float(pointwise->getReluUpperClip());
+        instruction.mConstants[4] = to_float(pointwise->getReluLowerClipSlope());
+        break;
+    case MIOPEN_POINTWISE_ELU_FWD:
+        instruction.mConstants[2] = to_float(pointwise->getEluAlpha());
+        break;
+    case MIOPEN_POINTWISE_SOFTPLUS_FWD:
+        instruction.mConstants[2] = to_float(pointwise->getSoftPlusBeta());
+        break;
+    case MIOPEN_POINTWISE_SWISH_FWD:
+        instruction.mConstants[2] = to_float(pointwise->getSwishBeta());
+        break;
+    default: break;
+    }
+    return instruction;
+}
+
+bool canBroadcast(const TensorDims& lengths, const std::vector<std::size_t>& to)
+{
+    if(lengths.size() != to.size())
+        return false;
+    for(std::size_t i = 0; i < lengths.size(); ++i)
+    {
+        if(lengths[i] != to[i] && lengths[i] != 1)
+            return false;
+    }
+    return true;
+}
+
+tensor_view_t<5> makeChainView(const std::vector<std::size_t>& lengths)
+{
+    tensor_view_t<5> view{};
+    for(std::size_t i = 0; i < 5; ++i)
+    {
+        view.size[i] = i < lengths.size() ? lengths[i] : 1;
+    }
+    return view;
+}
+
+/// View of the tensor indexed by the element of the chain, broadcast dimensions get stride 0
+tensor_view_t<5> makeOperandView(const TensorDescriptor& tensor,
+                                 const std::vector<std::size_t>& lengths)
+{
+    const auto& tensor_lengths = tensor.GetLengths();
+    const auto& strides        = tensor.GetStrides();
+
+    tensor_view_t<5> view{};
+    for(std::size_t i = 0; i < 5; ++i)
+    {
+        if(i < lengths.size())
+        {
+            view.size[i]   = lengths[i];
+            view.stride[i] = tensor_lengths[i] == 1 ? 0 : strides[i];
+        }
+        else
+        {
+            view.size[i]   = 1;
+            view.stride[i] = 0;
+        }
+    }
+    return view;
+}
+
+template <typename TensorRef>
+pointwise_chain_args_t makeArgs(const PointwiseProgram& program,
+                                const std::vector<std::size_t>& lengths,
+                                const std::vector<TensorRef>& input_tensors,
+                                const std::vector<TensorRef>& output_tensors,
+                                const std::vector<const float*>& inputs,
+                                const std::vector<float*>& outputs)
+{
+    const auto deref_tensor = [](const auto& t) -> const TensorDescriptor& {
+        if constexpr(std::is_pointer_v<std::decay_t<decltype(t)>>)
+            return *t;
+        else
+            return t;
+    };
+
+    MIOPEN_THROW_IF(inputs.size() != program.mInputs.size() ||
+                        outputs.size() != program.mOutputs.size(),
+                    "Wrong number of buffers for the pointwise chain");
+
+    pointwise_chain_args_t args{};
+    for(std::size_t i = 0; i < inputs.size(); ++i)
+    {
+        args.inputs[i]   = inputs[i];
+        args.input_tv[i] = makeOperandView(deref_tensor(input_tensors[i]), lengths);
+    }
+    for(std::size_t i = 0; i < outputs.size(); ++i)
+    {
+        args.outputs[i]   = outputs[i];
+        args.output_tv[i] = makeOperandView(deref_tensor(output_tensors[i]), lengths);
+    }
+    for(std::size_t i = 0; i < program.mInstructions.size(); ++i)
+    {
+        std::copy(std::begin(program.mInstructions[i].mConstants),
+                  std::end(program.mInstructions[i].mConstants),
+                  args.constants + i * PW_CHAIN_NUM_CONSTANTS);
+    }
+    return args;
+}
+
+std::size_t getNumElements(const std::vector<std::size_t>& lengths)
+{
+    return std::accumulate(
+        lengths.begin(), lengths.end(), std::size_t{1}, std::multiplies<std::size_t>());
+}
+
+/// True if every op of the graph can be reached from the first one through tensors passed
+/// between ops, ignoring the edges to the source and sink nodes.
+bool isConnected(const OpGraph& graph)
+{
+    const auto& nodes = graph.getNodes();
+    if(nodes.empty())
+        return true;
+
+    std::unordered_set<const OpNode*> visited{nodes.front()};
+    std::vector<const OpNode*> pending{nodes.front()};
+    const auto visit = [&](const OpNode* node) {
+        if(node != graph.getSourceNode() && node != graph.getSinkNode() &&
+           visited.insert(node).second)
+            pending.push_back(node);
+    };
+
+    while(!pending.empty())
+    {
+        const OpNode* node = pending.back();
+        pending.pop_back();
+        for(const auto& [neighbor, tensor] : graph.getOutEdges(node))
+            visit(neighbor);
+        for(const auto& [neighbor, tensor] : graph.getInEdges(node))
+            visit(neighbor);
+    }
+
+    return visited.size() == nodes.size();
+}
+
+} // namespace
+
+bool isFusablePointwiseMode(miopenPointwiseMode_t mode)
+{
+    return getKernelModeName(mode) != nullptr;
+}
+
+float evaluatePointwise(const PointwiseInstruction& instruction, float x, float b)
+{
+    const auto* c = instruction.mConstants;
+    x *= c[0];
+    b *= c[1];
+
+    switch(instruction.mMode)
+    {
+    case MIOPEN_POINTWISE_ADD: return x + b;
+    case MIOPEN_POINTWISE_ADD_SQUARE: return x + b * b;
+    case MIOPEN_POINTWISE_DIV: return x / b;
+    case MIOPEN_POINTWISE_MAX: return std::fmax(x, b);
+    case MIOPEN_POINTWISE_MIN: return std::fmin(x, b);
+    case MIOPEN_POINTWISE_MOD: return std::fmod(x, b);
+    case MIOPEN_POINTWISE_MUL: return x * b;
+    case MIOPEN_POINTWISE_POW: return std::pow(x, b);
+    case MIOPEN_POINTWISE_SUB: return x - b;
+    case MIOPEN_POINTWISE_ABS: return std::fabs(x);
+    case MIOPEN_POINTWISE_CEIL: return std::ceil(x);
+    case MIOPEN_POINTWISE_COS: return std::cos(x);
+    case MIOPEN_POINTWISE_EXP: return std::exp(x);
+    case MIOPEN_POINTWISE_FLOOR: return std::floor(x);
+    case MIOPEN_POINTWISE_LOG: return std::log(x);
+    case MIOPEN_POINTWISE_NEG: return -x;
+    case MIOPEN_POINTWISE_RSQRT: return 1.0f / std::sqrt(x);
+    case MIOPEN_POINTWISE_SIN: return std::sin(x);
+    case MIOPEN_POINTWISE_SQRT: return std::sqrt(x);
+    case MIOPEN_POINTWISE_TAN: return std::tan(x);
+    case MIOPEN_POINTWISE_IDENTITY: return x;
+    case MIOPEN_POINTWISE_RELU_FWD: return x <= c[2] ? c[2] + c[4] * (x - c[2]) : std::fmin(x, c[3]);
+    case MIOPEN_POINTWISE_TANH_FWD: return std::tanh(x);
+    case MIOPEN_POINTWISE_SIGMOID_FWD: return 1.0f / (1.0f + std::exp(-x));
+    case MIOPEN_POINTWISE_ELU_FWD: return x > 0.0f ? x : c[2] * (std::exp(x) - 1.0f);
+    case MIOPEN_POINTWISE_GELU_FWD: return 0.5f * x * (1.0f + std::erf(x * 0.70710678f));
+    case MIOPEN_POINTWISE_SOFTPLUS_FWD: return std::log1p(std::exp(c[2] * x)) / c[2];
+    case MIOPEN_POINTWISE_SWISH_FWD: return x / (1.0f + std::exp(-c[2] * x));
+    case MIOPEN_POINTWISE_GELU_APPROX_TANH_FWD:
+        return 0.5f * x * (1.0f + std::tanh(0.79788456f * (x + 0.044715f * x * x * x)));
+    case MIOPEN_POINTWISE_RECIPROCAL: return 1.0f / x;
+    default: MIOPEN_THROW(miopenStatusNotImplemented);
+    }
+}
+
+std::string PointwiseProgram::getNetworkConfig() const
+{
+    std::ostringstream ss;
+    ss << "pwchain-i" << mInputs.size();
+    for(const auto& instruction : mInstructions)
+    {
+        ss << "-" << instruction.mMode << "x" << instruction.mSrc0 << "x" << instruction.mSrc1;
+    }
+    ss << "-o";
+    for(const auto& output : mOutputs)
+    {
+        ss << "x" << output.second;
+    }
+    return ss.str();
+}
+
+std::string PointwiseProgram::getBuildParams() const
+{
+    auto params = KernelBuildParameters{
+        {"PW_NUM_INPUTS", mInputs.size()},
+        {"PW_NUM_OUTPUTS", mOutputs.size()},
+        {"PW_NUM_OPS", mInstructions.size()},
+        {"PW_NUM_REGS", getNumRegisters()},
+    };
+
+    for(std::size_t i = 0; i < mInstructions.size(); ++i)
+    {
+        const auto& instruction = mInstructions[i];
+        const auto prefix       = "PW_OP" + std::to_string(i);
+        params.Define(prefix + "_MODE", getKernelModeName(instruction.mMode));
+        params.Define(prefix + "_SRC0", instruction.mSrc0);
+        params.Define(prefix + "_SRC1", instruction.mSrc1);
+    }
+    for(std::size_t j = 0; j < mOutputs.size(); ++j)
+    {
+        params.Define("PW_OUT" + std::to_string(j) + "_REG", mOutputs[j].second);
+    }
+
+    return params.GenerateFor(kbp::HIP{});
+}
+
+std::optional<PointwiseChain> analyzePointwiseChain(const OpGraph& graph)
+{
+    PointwiseChain chain;
+    std::vector<OperationPointwise*> pointwise_ops;
+
+    for(OpNode* node : graph.getNodes())
+    {
+        if(auto* op = dynamic_cast<OperationPointwise*>(node))
+        {
+            if(!isFusablePointwiseMode(op->getPointwise()->getMode()) ||
+               op->getPointwise()->getMathPrecision() != miopenFloat)
+                return std::nullopt;
+            pointwise_ops.push_back(op);
+        }
+        else if(chain.mAnchor == nullptr && getAnchorKind(node) != PointwiseChainAnchor::None)
+        {
+            chain.mAnchor     = node;
+            chain.mAnchorKind = getAnchorKind(node);
+        }
+        else
+        {
+            return std::nullopt;
+        }
+    }
+
+    if(pointwise_ops.empty() || pointwise_ops.size() > PointwiseProgram::MaxInstructions)
+        return std::nullopt;
+
+    if(!isConnected(graph))
+        return std::nullopt;
+
+    // the anchor reads graph inputs only and feeds the chain through one virtual tensor
+    Tensor* anchor_output = nullptr;
+    if(chain.mAnchor != nullptr)
+    {
+        for(const auto& [src, tensor] : graph.getInEdges(chain.mAnchor))
+        {
+            if(src != graph.getSourceNode())
+                return std::nullopt;
+            if(!internal::contains(chain.mAnchorInputs, tensor))
+                chain.mAnchorInputs.push_back(tensor);
+        }
+        for(const auto& [dst, tensor] : graph.getOutEdges(chain.mAnchor))
+        {
+            if(dst == graph.getSinkNode() || !tensor->isVirtual() ||
+               (anchor_output != nullptr && anchor_output != tensor))
+                return std::nullopt;
+            anchor_output = tensor;
+        }
+        if(anchor_output == nullptr || anchor_output->GetType() != miopenFloat)
+            return std::nullopt;
+    }
+
+    // order pointwise ops so that every op comes after the ops producing its inputs
+    std::vector<OperationPointwise*> order;
+    for(OpNode* node : topologicalSort(graph))
+    {
+        if(node != chain.mAnchor)
+            order.push_back(static_cast<OperationPointwise*>(node));
+    }
+
+    // outputs are the non-virtual tensors written by the chain
+    auto& program = chain.mProgram;
+    std::unordered_set<const Tensor*> produced;
+    for(auto* op : order)
+    {
+        Tensor* output = op->getOutTensors().front();
+        produced.insert(output);
+        if(!output->isVirtual())
+        {
+            chain.mOutputTensors.push_back(output);
+        }
+        else if(graph.hasEdgeToSink(op, output))
+        {
+            return std::nullopt;
+        }
+    }
+
+    if(chain.mOutputTensors.empty() || chain.mOutputTensors.size() > PointwiseProgram::MaxOutputs)
+        return std::nullopt;
+
+    const auto& lengths = chain.mOutputTensors.front()->GetLengths();
+    chain.mLengths.assign(lengths.begin(), lengths.end());
+    if(chain.mLengths.empty() || chain.mLengths.size() > PointwiseProgram::MaxDims)
+        return std::nullopt;
+
+    // registers of the inputs come first, the anchor output being the first of them
+    std::unordered_map<const Tensor*, int32_t> registers;
+    const auto add_input = [&](Tensor* tensor) {
+        registers.emplace(tensor, static_cast<int32_t>(program.mInputs.size()));
+        program.mInputs.push_back(tensor->getId());
+        chain.mInputTensors.push_back(tensor);
+    };
+
+    if(anchor_output != nullptr)
+    {
+        if(anchor_output->GetLengths() != chain.mLengths)
+            return std::nullopt;
+        add_input(anchor_output);
+    }
+
+    for(auto* op : order)
+    {
+        for(Tensor* input : op->getInTensors())
+        {
+            if(produced.count(input) != 0 || registers.count(input) != 0)
+                continue;
+            if(input->isVirtual() || input->GetType() != miopenFloat ||
+               !canBroadcast(input->GetLengths(), chain.mLengths))
+                return std::nullopt;
+            add_input(input);
+        }
+    }
+
+    if(program.mInputs.size() > PointwiseProgram::MaxInputs)
+        return std::nullopt;
+
+    const auto next_register = [&]() {
+        return static_cast<int32_t>(program.mInputs.size() + program.mInstructions.size());
+    };
+
+    // convolution alpha scales the anchor output before the chain reads it
+    if(auto* conv = dynamic_cast<OperationConvolution*>(chain.mAnchor);
+       conv != nullptr && conv->getAlpha() != 1.0)
+    {
+        if(order.size() == PointwiseProgram::MaxInstructions)
+            return std::nullopt;
+
+        PointwiseInstruction scale;
+        scale.mDst               = next_register();
+        scale.mSrc0              = registers.at(anchor_output);
+        scale.mSrc1              = scale.mSrc0;
+        scale.mConstants[0]      = static_cast<float>(conv->getAlpha());
+        registers[anchor_output] = scale.mDst;
+        program.mInstructions.push_back(scale);
+    }
+
+    for(auto* op : order)
+    {
+        const auto inputs = op->getInTensors();
+        Tensor* output    = op->getOutTensors().front();
+
+        if(output->GetType() != miopenFloat || output->GetLengths() != chain.mLengths)
+            return std::nullopt;
+
+        auto instruction  = makeInstruction(*op);
+        instruction.mDst  = next_register();
+        instruction.mSrc0 = registers.at(inputs.front());
+        instruction.mSrc1 = registers.at(inputs.back());
+        registers[output] = instruction.mDst;
+        program.mInstructions.push_back(instruction);
+    }
+
+    for(Tensor* output : chain.mOutputTensors)
+    {
+        program.mOutputs.emplace_back(output->getId(), registers.at(output));
+    }
+
+    return chain;
+}
+
+void evaluatePointwiseChain(const PointwiseChain& chain,
+                            const std::vector<const float*>& inputs,
+                            const std::vector<float*>& outputs)
+{
+    const auto& program = chain.mProgram;
+    auto args           = makeArgs(
+        program, chain.mLengths, chain.mInputTensors, chain.mOutputTensors, inputs, outputs);
+    const auto chain_tv = makeChainView(chain.mLengths);
+    const auto numel    = getNumElements(chain.mLengths);
+
+    std::vector<float> r(program.getNumRegisters());
+    for(std::size_t gid = 0; gid < numel; ++gid)
+    {
+        tensor_layout_t<5> layout(chain_tv, gid);
+
+        for(std::size_t i = 0; i < program.mInputs.size(); ++i)
+            r[i] = args.inputs[i][args.input_tv[i].get_tensor_view_idx(layout)];
+
+        for(const auto& instruction : program.mInstructions)
+            r[instruction.mDst] =
+                evaluatePointwise(instruction, r[instruction.mSrc0], r[instruction.mSrc1]);
+
+        for(std::size_t j = 0; j < program.mOutputs.size(); ++j)
+            args.outputs[j][args.output_tv[j].get_tensor_view_idx(layout)] =
+                r[program.mOutputs[j].second];
+    }
+}
+
+void to_json(nlohmann::json& json, const PointwiseInstruction& instruction)
+{
+    json = nlohmann::json{
+        {"mode", instruction.mMode},
+        {"dst", instruction.mDst},
+        {"src0", instruction.mSrc0},
+        {"src1", instruction.mSrc1},
+        {"constants", instruction.mConstants},
+    };
+}
+
+void from_json(const nlohmann::json& json, PointwiseInstruction& instruction)
+{
+    json.at("mode").get_to(instruction.mMode);
+    json.at("dst").get_to(instruction.mDst);
+    json.at("src0").get_to(instruction.mSrc0);
+    json.at("src1").get_to(instruction.mSrc1);
+    json.at("constants").get_to(instruction.mConstants);
+}
+
+void to_json(nlohmann::json& json, const PointwiseProgram& program)
+{
+    json = nlohmann::json{
+        {"inputs", program.mInputs},
+        {"instructions", program.mInstructions},
+        {"outputs", program.mOutputs},
+    };
+}
+
+void from_json(const nlohmann::json& json, PointwiseProgram& program)
+{
+    json.at("inputs").get_to(program.mInputs);
+    json.at("instructions").get_to(program.mInstructions);
+    json.at("outputs").get_to(program.mOutputs);
+}
+
+PointwiseChainExecutor::PointwiseChainExecutor(
+    const PointwiseChain& chain, const std::shared_ptr<GraphPatternExecutor>& anchor)
+    : GraphPatternExecutor(), mProgram(chain.mProgram), mLengths(chain.mLengths), mAnchor(anchor)
+{
+    for(const Tensor* tensor : chain.mInputTensors)
+        mInputTensors.push_back(*tensor);
+    for(const Tensor* tensor : chain.mOutputTensors)
+        mOutputTensors.push_back(*tensor);
+
+    if(mAnchor)
+    {
+        MIOPEN_THROW_IF(chain.mAnchor == nullptr, "Anchor executor given for a chain without anchor");
+        mAnchorOutputId = chain.mInputTensors.front()->getId();
+        for(const Tensor* tensor : chain.mAnchorInputs)
+            mAnchorInputIds.push_back(tensor->getId());
+    }
+}
+
+PointwiseChainExecutor::PointwiseChainExecutor(const nlohmann::json& json)
+    : GraphPatternExecutor(),
+      mProgram(json.at(JsonFields::Program)),
+      mLengths(json.at(JsonFields::Lengths).get<std::vector<std::size_t>>()),
+      mInputTensors(json.at(JsonFields::InputTensors).get<std::vector<Tensor>>()),
+      mOutputTensors(json.at(JsonFields::OutputTensors).get<std::vector<Tensor>>()),
+      mAnchorOutputId(json.at(JsonFields::AnchorOutputId)),
+      mAnchorInputIds(json.at(JsonFields::AnchorInputIds).get<std::vector<int64_t>>())
+{
+    const auto& anchor = json.at(JsonFields::Anchor);
+    if(!anchor.is_null())
+        mAnchor = std::make_shared<GraphExecutorFind20>(anchor);
+}
+
+size_t PointwiseChainExecutor::getWorkspaceSize() const
+{
+    return mAnchor ? mAnchor->getWorkspaceSize() : 0;
+}
+
+std::vector<int64_t> PointwiseChainExecutor::getVirtualTensorIds() const
+{
+    return mAnchor ? std::vector<int64_t>{mAnchorOutputId} : std::vector<int64_t>{};
+}
+
+void PointwiseChainExecutor::execute(miopenHandle_t handle, const VariantPack& vpk)
+{
+    const auto& h = deref(handle);
+
+    void* anchor_output = nullptr;
+    if(mAnchor)
+    {
+        anchor_output = vpk.getDataPointer(mAnchorOutputId);
+
+        std::vector<int64_t> ids = mAnchorInputIds;
+        std::vector<void*> ptrs;
+        for(auto id : mAnchorInputIds)
+            ptrs.push_back(vpk.getDataPointer(id));
+        ids.push_back(mAnchorOutputId);
+        ptrs.push_back(anchor_output);
+
+        mAnchor->execute(handle, VariantPack{std::move(ids), std::move(ptrs), vpk.getWorkspace()});
+    }
+
+    std::vector<const float*> inputs;
+    for(auto id : mProgram.mInputs)
+    {
+        const auto* ptr = (mAnchor && id == mAnchorOutputId) ? anchor_output
+                                                             : vpk.getDataPointer(id);
+        inputs.push_back(static_cast<const float*>(ptr));
+    }
+    std::vector<float*> outputs;
+    for(const auto& output : mProgram.mOutputs)
+        outputs.push_back(static_cast<float*>(vpk.getDataPointer(output.first)));
+
+    const auto args = makeArgs(mProgram, mLengths, mInputTensors, mOutputTensors, inputs, outputs);
+    const auto chain_tv = makeChainView(mLengths);
+    const uint64_t numel = getNumElements(mLengths);
+
+    const auto network_config = mProgram.getNetworkConfig();
+    auto&& kernels            = h.GetKernels(name, network_config);
+    if(!kernels.empty())
+    {
+        kernels.front()(args, chain_tv, numel);
+        return;
+    }
+
+    // grid-stride loop, so that the kernel is reused for any number of elements
+    constexpr std::size_t local_size = 256;
+    const std::vector<std::size_t> vld{local_size, 1, 1};
+    const std::vector<std::size_t> vgd{local_size * h.GetMaxComputeUnits() * 8, 1, 1};
+
+    h.AddKernel(name,
+                network_config,
+                "MIOpenPointwiseChain.cpp",
+                "PointwiseChain",
+                vld,
+                vgd,
+                mProgram.getBuildParams())(args, chain_tv, numel);
+}
+
+nlohmann::json PointwiseChainExecutor::getJson()
+{
+    return {
+        {GraphPatternExecutor::JsonFields::Name, name},
+        {JsonFields::Program, mProgram},
+        {JsonFields::Lengths, mLengths},
+        {JsonFields::InputTensors, mInputTensors},
+        {JsonFields::OutputTensors, mOutputTensors},
+        {JsonFields::Anchor, mAnchor ? mAnchor->getJson() : nlohmann::json{}},
+        {JsonFields::AnchorOutputId, mAnchorOutputId},
+        {JsonFields::AnchorInputIds, mAnchorInputIds},
+    };
+}
+
+} // namespace graphapi
+
+} // namespace miopen
@@ -176,6 +176,12 @@ const std::string& OperationReduction::signName() const
     }
 }
 
+bool OperationReduction::hashAttributes(internal::NodeKey& seed) const
+{
+    internal::hashCombine(seed, mReduction->getCompType());
+    return true;
+}
+
 std::vector<Tensor*> OperationReduction::getInTensors() const { return {mX}; }
 
 std::vector<Tensor*> OperationReduction::getOutTensors() const { return {mY}; }
@@ -39,6 +39,12 @@ const std::string& OperationReshape::signName() const
     return name;
 }
 
+bool OperationReshape::hashAttributes(internal::NodeKey& seed) const
+{
+    internal::hashCombine(seed, mOpKind);
+    return true;
+}
+
 std::vector<Tensor*> OperationReshape::getInTensors() const { return {mX}; }
 
 std::vector<Tensor*> OperationReshape::getOutTensors() const { return {mY}; }
@@ -200,6 +200,23 @@ const std::string& OperationRng::signName() const
     return name;
 }
 
+bool OperationRng::hashAttributes(internal::NodeKey& seed) const
+{
+    internal::hashCombine(seed, mRng->getDistribution());
+    internal::hashCombine(seed, mRng->getNormalMean());
+    internal::hashCombine(seed, mRng->getNormalStdev());
+    internal::hashCombine(seed, mRng->getUniformMin());
+    internal::hashCombine(seed, mRng->getUniformMax());
+    internal::hashCombine(seed, mRng->getBernoulliProb());
+    internal::hashCombine(seed, mSeed.index());
+    if(const auto* value = std::get_if<int64_t>(&mSeed))
+    {
+        internal::hashCombine(seed, *value);
+    }
+    internal::hashTensor(seed, mOffset);
+    return true;
+}
+
 std::vector<Tensor*> OperationRng::getInTensors() const
 {
     if(mSeed.index() == 0)
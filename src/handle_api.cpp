@@ -26,7 +26,12 @@
 #include <cstdio>
 #include <miopen/version.h>
 #include <miopen/errors.hpp>
+#include <miopen/env.hpp>
 #include <miopen/handle.hpp>
+#include <miopen/startup.hpp>
+
+/// Makes miopenCreate() and miopenCreateWithStream() call miopenWarmStart().
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_WARM_START)
 
 extern "C" const char* miopenGetErrorString(miopenStatus_t error)
 {
@@ -75,6 +80,8 @@ extern "C" miopenStatus_t miopenCreate(miopenHandle_t* handle)
     return miopen::try_([&] {
         auto& h = miopen::deref(handle);
         h       = new miopen::Handle();
+        if(miopen::env::enabled(MIOPEN_WARM_START))
+            miopen::startup::WarmStart(miopen::deref(h));
     });
 }
 
@@ -85,6 +92,8 @@ extern "C" miopenStatus_t miopenCreateWithStream(miopenHandle_t* handle,
     return miopen::try_([&] {
         auto& h = miopen::deref(handle);
         h       = new miopen::Handle(stream);
+        if(miopen::env::enabled(MIOPEN_WARM_START))
+            miopen::startup::WarmStart(miopen::deref(h));
     });
 }
 
@@ -109,7 +118,16 @@ extern "C" miopenStatus_t miopenSetAllocator(miopenHandle_t handle,
 
 extern "C" miopenStatus_t miopenDestroy(miopenHandle_t handle)
 {
-    return miopen::try_([&] { miopen_destroy_object(handle); });
+    return miopen::try_([&] {
+        // Warm start threads may still be using the handle.
+        miopen::startup::WaitForWarmStart();
+        miopen_destroy_object(handle);
+    });
+}
+
+extern "C" miopenStatus_t miopenWarmStart(miopenHandle_t handle)
+{
+    return miopen::try_([&] { miopen::startup::WarmStart(miopen::deref(handle)); });
 }
 
 extern "C" miopenStatus_t miopenGetKernelTime(miopenHandle_t handle, float* time)
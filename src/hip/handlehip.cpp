@@ -32,8 +32,10 @@
 #include <miopen/errors.hpp>
 #include <miopen/handle_lock.hpp>
 #include <miopen/invoker.hpp>
+#include <miopen/invoker_profiler.hpp>
 #include <miopen/kernel_cache.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/stats.hpp>
 #include <miopen/stringutils.hpp>
 #include <miopen/target_properties.hpp>
 #include <miopen/timer.hpp>
@@ -526,6 +528,7 @@ std::vector<Kernel> Handle::GetKernelsImpl(const std::string& algorithm,
 
 KernelInvoke Handle::Run(Kernel k, bool coop_launch) const
 {
+    const invoker_profiler::PhaseTimer timer{invoker_profiler::Phase::Lookup};
     this->impl->set_ctx();
     auto callback = (this->impl->enable_profiling || MIOPEN_GPU_SYNC)
                         ? this->impl->elapsed_time_handler()
@@ -580,6 +583,7 @@ Program Handle::LoadProgram(const fs::path& program_name,
     // specific code object
     if(hsaco.empty())
     {
+        stats::Increment(stats::Counter::KernelCacheMiss);
         CompileTimer ct;
         auto p =
             HIPOCProgram{program_name.string(), params, this->GetTargetProperties(), kernel_src};
@@ -639,6 +643,7 @@ Program Handle::LoadProgram(const fs::path& program_name,
     }
     else
     {
+        stats::Increment(stats::Counter::KernelCacheHit);
         auto p = HIPOCProgram{program_name, hsaco};
 #if MIOPEN_ENABLE_SQLITE_KERN_CACHE
         if(force_attach_binary)
@@ -789,6 +794,8 @@ const TargetProperties& Handle::GetTargetProperties() const
     return this->impl->target_properties;
 }
 
+int Handle::GetDeviceId() const { return this->impl->device; }
+
 std::ostream& Handle::Print(std::ostream& os) const
 {
     os << "stream: " << GetStream() << ", device_id: " << this->impl->device;
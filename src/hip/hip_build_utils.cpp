@@ -114,11 +114,11 @@ static fs::path HipBuildImpl(const TmpDir& tmp_dir,
                              const TargetProperties& target,
                              const bool testing_mode)
 {
-    // Write out the include files
+    // Write out the include files the source needs
     // Let's assume includes are overkill for feature tests & optimize'em out.
     if(!testing_mode)
     {
-        auto inc_list = GetKernelIncList();
+        const auto inc_list = GetKernelIncClosure(src);
         fs::create_directories(tmp_dir);
         for(const auto& inc_file : inc_list)
         {
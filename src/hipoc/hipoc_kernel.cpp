@@ -29,7 +29,9 @@
 #include <miopen/hipoc_kernel.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/handle_lock.hpp>
+#include <miopen/invoker_profiler.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/trace.hpp>
 
 #include <hip/hip_ext.h>
 #include <hip/hip_runtime.h>
@@ -85,6 +87,7 @@ static std::string DimToFormattedString(const size_t* dims, size_t count)
 
 void HIPOCKernelInvoke::run(void* args, std::size_t size) const
 {
+    MIOPEN_TRACE_SCOPE(Coarse, KernelLaunch, trace_name, 0);
     MIOPEN_LOG_I2("kernel_name = "
                   << GetName() << ", global_work_dim = " << DimToFormattedString(gdims.data(), 3)
                   << ", local_work_dim = " << DimToFormattedString(ldims.data(), 3));
@@ -112,6 +115,7 @@ void HIPOCKernelInvoke::run(void* args, std::size_t size) const
         MIOPEN_THROW("MIOPEN_DEVICE_ARCH used, escaping launching kernel");
     }
 
+    invoker_profiler::PhaseTimer launch_timer{invoker_profiler::Phase::Launch};
     MIOPEN_HANDLE_LOCK
 
     auto status = hipExtModuleLaunchKernel(fun,
@@ -127,11 +131,13 @@ void HIPOCKernelInvoke::run(void* args, std::size_t size) const
                                            reinterpret_cast<void**>(&config),
                                            start.get(),
                                            stop.get());
+    launch_timer.Stop();
     if(status != hipSuccess)
         MIOPEN_THROW_HIP_STATUS(status, "Failed to launch kernel");
 
     if(callback)
     {
+        const invoker_profiler::PhaseTimer wait_timer{invoker_profiler::Phase::Wait};
 #if 0
         auto start_time = std::chrono::system_clock::now();
         while(hipEventQuery(stop.get()) == hipErrorNotReady)
@@ -184,6 +190,7 @@ void HIPOCKernelInvoke::run_cooperative(void** kern_args) const
     unsigned grid_dim_y = gdims[1] / ldims[1];
     unsigned grid_dim_z = gdims[2] / ldims[2];
 
+    invoker_profiler::PhaseTimer launch_timer{invoker_profiler::Phase::Launch};
     MIOPEN_HANDLE_LOCK
 
     if(callback)
@@ -212,12 +219,14 @@ void HIPOCKernelInvoke::run_cooperative(void** kern_args) const
         if(status != hipSuccess)
             MIOPEN_THROW_HIP_STATUS(status, "hipEventRecord() failed");
     }
+    launch_timer.Stop();
 #else
 #error "Doesn't work without workaround"
 #endif // WORKAROUND_SWDEV_448157
 
     if(callback)
     {
+        const invoker_profiler::PhaseTimer wait_timer{invoker_profiler::Phase::Wait};
         hipEventSynchronize(stop.get());
         callback(start.get(), stop.get());
     }
@@ -227,6 +236,6 @@ HIPOCKernelInvoke HIPOCKernel::Invoke(hipStream_t stream,
                                       std::function<void(hipEvent_t, hipEvent_t)> callback,
                                       bool coop_launch) const
 {
-    return HIPOCKernelInvoke{stream, fun, ldims, gdims, name, callback, coop_launch};
+    return HIPOCKernelInvoke{stream, fun, ldims, gdims, name, trace_name, callback, coop_launch};
 }
 } // namespace miopen
@@ -33,9 +33,11 @@
 #include <miopen/kernel_warnings.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/mlir_build.hpp>
+#include <miopen/stats.hpp>
 #include <miopen/stringutils.hpp>
 #include <miopen/target_properties.hpp>
 #include <miopen/temp_file.hpp>
+#include <miopen/trace.hpp>
 #include <miopen/write_file.hpp>
 #include <miopen/env.hpp>
 #include <miopen/comgr.hpp>
@@ -299,6 +301,9 @@ void HIPOCProgramImpl::BuildCodeObjectInMemory(const std::string& params,
 
 void HIPOCProgramImpl::BuildCodeObject(std::string params, const std::string& kernel_src)
 {
+    MIOPEN_TRACE_SCOPE(Coarse, Compile, trace::Intern(program.string()), 0);
+    const stats::ScopedTimer timer{stats::Histogram::Compile};
+
     const auto src = [&]() -> std::string_view {
         if(program.extension() == ".mlir")
             return {}; // MLIR solutions do not use source code.
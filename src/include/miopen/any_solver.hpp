@@ -327,6 +327,10 @@ struct AnySolver
         bool IsApplicable(const ExecutionContext& ctx,
                           const miopen::conv::ProblemDescription& problem) const override
         {
+#if MIOPEN_MODE_NOGPU
+            if(conv::IsSupersededByHostSolver(value, problem))
+                return false;
+#endif
             return value.IsApplicable(ctx, problem);
         }
         bool IsTunable() const override { return TunableSolver::Is; }
@@ -29,6 +29,7 @@
 #include <miopen/problem_description_base.hpp>
 #include <miopen/activ.hpp>
 #include <miopen/tensor.hpp>
+#include <miopen/tensor_layout.hpp>
 #include <miopen/mlo_internal.hpp>
 
 #include <cassert>
@@ -204,30 +205,14 @@ struct MIOPEN_INTERNALS_EXPORT ProblemDescription : ProblemDescriptionBase,
 
     bool IsLayoutNHWC() const
     {
-        if(direction == Direction::Backward)
-        {
-            return xDesc.GetLengths().size() == 4
-                       ? ((in_layout == "NHWC") && (out_layout == "NHWC") && (din_layout == "NHWC"))
-                       : ((in_layout == "NDHWC") && (out_layout == "NDHWC") &&
-                          (din_layout == "NDHWC"));
-        }
-
-        return xDesc.GetLengths().size() == 4 ? ((in_layout == "NHWC") && (out_layout == "NHWC"))
-                                              : ((in_layout == "NDHWC") && (out_layout == "NDHWC"));
+        return IsLayout(xDesc.GetLengths().size() == 4 ? tensor_layout::NHWC
+                                                       : tensor_layout::NDHWC);
     }
 
     bool IsLayoutNCHW() const
     {
-        if(direction == Direction::Backward)
-        {
-            return xDesc.GetLengths().size() == 4
-                       ? ((in_layout == "NCHW") && (out_layout == "NCHW") && (din_layout == "NCHW"))
-                       : ((in_layout == "NCDHW") && (out_layout == "NCDHW") &&
-                          (din_layout == "NCDHW"));
-        }
-
-        return xDesc.GetLengths().size() == 4 ? ((in_layout == "NCHW") && (out_layout == "NCHW"))
-                                              : ((in_layout == "NCDHW") && (out_layout == "NCDHW"));
+        return IsLayout(xDesc.GetLengths().size() == 4 ? tensor_layout::NCHW
+                                                       : tensor_layout::NCDHW);
     }
 
     bool Is2D() const { return xDesc.GetLengths().size() == 4; }
@@ -264,7 +249,7 @@ struct MIOPEN_INTERNALS_EXPORT ProblemDescription : ProblemDescriptionBase,
     template <class Self>
     static void Visit(Self&& self, std::function<void(std::string, std::string)> f)
     {
-        f(self.ComputeInLayout(), "layout");
+        f(self.ComputeInLayout().ToString(), "layout");
         f(self.GetDirectionStr(), "direction");
         f(GetDataTypeName(self.xDesc.GetType()), "data_type");
         f(self.GetModeStr(), "mode");
@@ -310,19 +295,25 @@ private:
     bool resultsave         = false;
     bool resultrunning      = false;
     bool useSaved           = false;
-    std::string in_layout   = "NCHW";
-    std::string out_layout  = "NCHW";
-    std::string din_layout  = "NCHW";
-    std::size_t spatial_dim = 2;
+    TensorLayoutCode in_layout  = tensor_layout::NCHW;
+    TensorLayoutCode out_layout = tensor_layout::NCHW;
+    TensorLayoutCode din_layout = tensor_layout::NCHW;
+    std::size_t spatial_dim     = 2;
 
     NetworkConfig MakeForwardTrainingNetworkConfig() const;
     NetworkConfig MakeForwardInferenceNetworkConfig() const;
     NetworkConfig MakeBackwardNetworkConfig() const;
 
-    std::string ComputeLayout(const TensorDescriptor& td) const { return td.GetLayout_str(); }
-    std::string ComputeInLayout() const { return ComputeLayout(xDesc); }
-    std::string ComputeOutLayout() const { return ComputeLayout(yOrDyDesc); }
-    std::string ComputeDinLayout() const { return ComputeLayout(dxDesc); }
+    TensorLayoutCode ComputeInLayout() const { return xDesc.GetLayoutCode(); }
+    TensorLayoutCode ComputeOutLayout() const { return yOrDyDesc.GetLayoutCode(); }
+    TensorLayoutCode ComputeDinLayout() const { return dxDesc.GetLayoutCode(); }
+
+    /// True if all the data tensors of the direction have the given layout.
+    bool IsLayout(TensorLayoutCode layout) const
+    {
+        return in_layout == layout && out_layout == layout &&
+               (direction != Direction::Backward || din_layout == layout);
+    }
 
     size_t GetSpatialDims() const { return spatial_dim; }
 
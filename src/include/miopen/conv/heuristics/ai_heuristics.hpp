@@ -71,6 +71,8 @@ public:
     size_t EncodeLayout(const std::string& layout) const;
 };
 class Model;
+/// Constructs the TunaNet model used by PredictSolver() ahead of the first prediction.
+MIOPEN_INTERNALS_EXPORT void LoadModel(const std::string& device);
 MIOPEN_INTERNALS_EXPORT std::vector<uint64_t> PredictSolver(const conv::ProblemDescription& problem,
                                                             const ExecutionContext& ctx,
                                                             const std::string& device);
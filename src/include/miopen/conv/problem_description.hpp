@@ -33,6 +33,7 @@
 
 #include <miopen/problem_description_base.hpp>
 #include <miopen/convolution.hpp>
+#include <miopen/tensor_layout.hpp>
 
 #if MIOPEN_ENABLE_SQLITE
 #include <miopen/sqlite_db.hpp>
@@ -45,57 +46,57 @@ struct ExecutionContext;
 MIOPEN_INTERNALS_EXPORT std::string
 EncodeDataTypesForKey(miopenDataType_t in, miopenDataType_t weights, miopenDataType_t out);
 
-template <class TElement>
-constexpr auto GetDHW(unsigned spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr auto GetDHW(unsigned spatial_dims, const TData& data)
 {
     if(spatial_dims == 2)
         return std::make_tuple(0, data[0], data[1]);
     return std::make_tuple(data[0], data[1], data[2]);
 }
 
-template <class TElement>
-constexpr TElement GetD3(unsigned spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetD3(unsigned spatial_dims, const TData& data)
 {
     return std::get<0>(GetDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr TElement GetH3(unsigned spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetH3(unsigned spatial_dims, const TData& data)
 {
     return std::get<1>(GetDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr TElement GetW3(unsigned spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetW3(unsigned spatial_dims, const TData& data)
 {
     return std::get<2>(GetDHW(spatial_dims, data));
 }
-template <class TElement>
-constexpr auto GetCHWN(const std::vector<TElement>& data)
+template <class TData>
+constexpr auto GetCHWN(const TData& data)
 {
     return miopen::tien<4>(data, 1);
 }
 
-template <class TElement>
-constexpr TElement GetNofCHWN(const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetNofCHWN(const TData& data)
 {
     return std::get<3>(GetCHWN(data));
 }
 
-template <class TElement>
-constexpr TElement GetCofCHWN(const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetCofCHWN(const TData& data)
 {
     return std::get<0>(GetCHWN(data));
 }
 
-template <class TElement>
-constexpr TElement GetHofCHWN(const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetHofCHWN(const TData& data)
 {
     return std::get<1>(GetCHWN(data));
 }
 
-template <class TElement>
-constexpr TElement GetWofCHWN(const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetWofCHWN(const TData& data)
 {
     return std::get<2>(GetCHWN(data));
 }
@@ -166,7 +167,8 @@ struct MIOPEN_INTERNALS_EXPORT ProblemDescription : ProblemDescriptionBase
     std::size_t GetInStrideD() const { return GetD5(GetSpatialDims(), in.GetStrides()); }
     std::size_t GetInStrideH() const { return GetH5(GetSpatialDims(), in.GetStrides()); }
     std::size_t GetInStrideW() const { return GetW5(GetSpatialDims(), in.GetStrides()); }
-    std::string GetInLayout() const { return in_layout; }
+    std::string GetInLayout() const { return in_layout.ToString(); }
+    TensorLayoutCode GetInLayoutCode() const { return in_layout; }
     std::size_t GetInElementSize() const { return GetTypeSize(GetInDataType()); }
     std::size_t GetInSize() const { return in.GetNumBytes(); }
 
@@ -183,7 +185,8 @@ struct MIOPEN_INTERNALS_EXPORT ProblemDescription : ProblemDescriptionBase
     std::size_t GetOutStrideD() const { return GetD5(GetSpatialDims(), out.GetStrides()); }
     std::size_t GetOutStrideH() const { return GetH5(GetSpatialDims(), out.GetStrides()); }
     std::size_t GetOutStrideW() const { return GetW5(GetSpatialDims(), out.GetStrides()); }
-    std::string GetOutLayout() const { return out_layout; }
+    std::string GetOutLayout() const { return out_layout.ToString(); }
+    TensorLayoutCode GetOutLayoutCode() const { return out_layout; }
     std::size_t GetOutElementSize() const { return GetTypeSize(GetOutDataType()); }
     std::size_t GetOutSize() const { return out.GetNumBytes(); }
 
@@ -193,14 +196,14 @@ struct MIOPEN_INTERNALS_EXPORT ProblemDescription : ProblemDescriptionBase
     std::size_t GetWeightsDepth() const { return GetD5(GetSpatialDims(), weights.GetLengths()); }
     std::size_t GetWeightsHeight() const
     {
-        if(weights_layout == "CHWNc")
+        if(weights_layout == tensor_layout::CHWNc)
             return GetHofCHWN(weights.GetLengths());
         else
             return GetH5(GetSpatialDims(), weights.GetLengths());
     }
     std::size_t GetWeightsWidth() const
     {
-        if(weights_layout == "CHWNc")
+        if(weights_layout == tensor_layout::CHWNc)
             return GetWofCHWN(weights.GetLengths());
         else
             return GetW5(GetSpatialDims(), weights.GetLengths());
@@ -210,7 +213,8 @@ struct MIOPEN_INTERNALS_EXPORT ProblemDescription : ProblemDescriptionBase
     std::size_t GetWeightsStrideD() const { return GetD5(GetSpatialDims(), weights.GetStrides()); }
     std::size_t GetWeightsStrideH() const { return GetH5(GetSpatialDims(), weights.GetStrides()); }
     std::size_t GetWeightsStrideW() const { return GetW5(GetSpatialDims(), weights.GetStrides()); }
-    std::string GetWeightsLayout() const { return weights_layout; }
+    std::string GetWeightsLayout() const { return weights_layout.ToString(); }
+    TensorLayoutCode GetWeightsLayoutCode() const { return weights_layout; }
     std::size_t GetWeightsElementSize() const { return GetTypeSize(GetWeightsDataType()); }
     std::size_t GetWeightsSize() const { return weights.GetNumBytes(); }
 
@@ -311,6 +315,11 @@ struct MIOPEN_INTERNALS_EXPORT ProblemDescription : ProblemDescriptionBase
         MIOPEN_THROW("Direction must be known!");
     }
 
+    /// True if the input, weights and output tensors all have the given layout.
+    bool IsLayout(TensorLayoutCode layout) const
+    {
+        return in_layout == layout && weights_layout == layout && out_layout == layout;
+    }
     bool IsLayoutDefault() const;
     bool IsLayoutNHWC() const;
     bool IsLayoutNCHWc() const;
@@ -409,18 +418,18 @@ struct MIOPEN_INTERNALS_EXPORT ProblemDescription : ProblemDescriptionBase
     void SetupFloats(ExecutionContext& ctx) const;
 
 private:
-    std::string ComputeLayout(const TensorDescriptor& td) const;
-    std::string ComputeInLayout() const;
-    std::string ComputeOutLayout() const;
-    std::string ComputeWeightsLayout() const;
+    TensorLayoutCode ComputeLayout(const TensorDescriptor& td) const;
+    TensorLayoutCode ComputeInLayout() const;
+    TensorLayoutCode ComputeOutLayout() const;
+    TensorLayoutCode ComputeWeightsLayout() const;
 
     TensorDescriptor in;
     TensorDescriptor weights;
     TensorDescriptor out;
     ConvolutionDescriptor conv;
-    std::string in_layout;
-    std::string weights_layout;
-    std::string out_layout;
+    TensorLayoutCode in_layout;
+    TensorLayoutCode weights_layout;
+    TensorLayoutCode out_layout;
     Direction direction                   = Direction::Forward;
     int bias                              = 0;
     Scalar alpha                          = Scalar(1.0);
@@ -0,0 +1,94 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#pragma once
+
+#include <miopen/config.hpp>
+#include <miopen/miopen.h>
+#include <miopen/solver_id.hpp>
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+struct ExecutionContext;
+
+namespace conv {
+
+struct ProblemDescription;
+
+/// How one registered convolution solver fared during solver selection.
+struct SolverSelectionEntry
+{
+    solver::Id id;
+    std::string name;
+    std::string algorithm;
+    bool applicable = false;
+    /// Why the solver is applicable or not, e.g. "algorithm disabled" or "not applicable".
+    std::string reason;
+    bool dynamic = false;
+    bool tunable = false;
+    /// Whether the perf-db holds a tuned config. perf_config is the config which would be
+    /// used (the tuned one or the default one).
+    bool perf_db_hit = false;
+    std::string perf_config;
+    /// Position in the AI heuristic prediction, 1 is the best, 0 if not predicted.
+    int ai_rank = 0;
+    /// Negative if unknown.
+    float wti             = -1.0f;
+    std::size_t workspace = 0;
+    /// Time recorded in the find-db, in ms. Negative if there is no find-db entry.
+    float find_db_time = -1.0f;
+    /// Position in the final ranking, 1 is the best, 0 if not ranked.
+    int rank = 0;
+    /// Time the ranking is based on: the find-db time or a heuristic estimation.
+    float ranking_time = 0.0f;
+};
+
+/// Explains which solver immediate mode and Find pick for a problem and why.
+/// Unlike the log, it covers every registered solver in one structured record.
+struct MIOPEN_INTERNALS_EXPORT SelectionReport
+{
+    std::string network_config;
+    std::string direction;
+    bool find_db_hit = false;
+    /// True if there was no find-db entry and the ranking comes from the fallback heuristics.
+    bool fallback = false;
+    bool ai_heuristic_used = false;
+    std::vector<SolverSelectionEntry> solvers;
+
+    std::string ToJson() const;
+
+    friend std::ostream& operator<<(std::ostream& os, const SelectionReport& report);
+};
+
+MIOPEN_INTERNALS_EXPORT SelectionReport ExplainSelection(const ExecutionContext& ctx,
+                                                         const ProblemDescription& problem);
+
+} // namespace conv
+} // namespace miopen
@@ -33,6 +33,7 @@
 #include <istream>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 namespace miopen {
@@ -211,6 +212,12 @@ private:
         return ParseContents(ss);
     }
 
+    bool ParseContents(std::string_view contents)
+    {
+        auto ss = std::istringstream(std::string{contents});
+        return ParseContents(ss);
+    }
+
 public:
     DbRecord() : key(""){};
     /// T shall provide a db KEY by means of the "void Serialize(std::ostream&) const" member
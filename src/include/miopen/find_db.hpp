@@ -36,6 +36,8 @@
 #include <miopen/ramdb.hpp>
 #include <miopen/readonlyramdb.hpp>
 #include <miopen/solution.hpp>
+#include <miopen/stats.hpp>
+#include <miopen/trace.hpp>
 #include <miopen/conv/solver_finders.hpp>
 
 #include <boost/optional.hpp>
@@ -106,8 +108,21 @@ public:
         if(!db.is_initialized())
             return;
 
-        content = db->FindRecord(problem);
+        {
+            const stats::ScopedTimer timer{stats::Histogram::FindDbLookup};
+            content = db->FindRecord(problem);
+        }
         in_sync = content.is_initialized();
+        if(in_sync)
+        {
+            stats::Increment(stats::Counter::FindDbHit);
+            MIOPEN_TRACE_EVENT(Detail, FindDbHit, "FindDb", 0);
+        }
+        else
+        {
+            stats::Increment(stats::Counter::FindDbMiss);
+            MIOPEN_TRACE_EVENT(Detail, FindDbMiss, "FindDb", 0);
+        }
     }
 
     template <class TProblemDescription, class TTestDb = TDb>
@@ -128,8 +143,21 @@ public:
         if(!db.is_initialized())
             return;
 
-        content = db->FindRecord(problem);
+        {
+            const stats::ScopedTimer timer{stats::Histogram::FindDbLookup};
+            content = db->FindRecord(problem);
+        }
         in_sync = content.is_initialized();
+        if(in_sync)
+        {
+            stats::Increment(stats::Counter::FindDbHit);
+            MIOPEN_TRACE_EVENT(Detail, FindDbHit, "FindDb", 0);
+        }
+        else
+        {
+            stats::Increment(stats::Counter::FindDbMiss);
+            MIOPEN_TRACE_EVENT(Detail, FindDbMiss, "FindDb", 0);
+        }
     }
 
     ~FindDbRecord_t()
@@ -184,6 +212,9 @@ public:
         return result.solutions;
     }
 
+    /// Loads the installed find-db of the handle's device ahead of the first record lookup.
+    static void Prefetch(const Handle& handle, const std::string& path_suffix = "");
+
 private:
     fs::path path;
     fs::path installed_path;
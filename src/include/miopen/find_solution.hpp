@@ -38,6 +38,8 @@
 #include <miopen/search_options.hpp>
 #include <miopen/solver_id.hpp>
 #include <miopen/solver.hpp>
+#include <miopen/stats.hpp>
+#include <miopen/trace.hpp>
 
 #include <limits>
 #include <type_traits>
@@ -48,8 +50,24 @@ namespace miopen {
 
 struct AnyInvokeParams;
 
+namespace conv {
+struct ProblemDescription;
+} // namespace conv
+
 namespace solver {
 
+#if MIOPEN_MODE_NOGPU
+namespace conv {
+
+/// The nogpu backend never launches kernels, so a kernel solver would leave the output untouched.
+/// Returns true for kernel solvers of problems that a convolution host solver handles, these are
+/// not applicable then. MIOPEN_DEBUG_CONV_HOST_REFERENCE=0 restores kernel-only selection.
+MIOPEN_INTERNALS_EXPORT bool IsSupersededByHostSolver(const SolverBase& solver,
+                                                      const miopen::conv::ProblemDescription& problem);
+
+} // namespace conv
+#endif
+
 template <class Solver, class Context, class Problem, class Db>
 auto FindSolutionImpl(rank<1>,
                       const Solver& s,
@@ -88,6 +106,10 @@ auto FindSolutionImpl(rank<1>,
         {
             using PerformanceConfig = decltype(s.GetDefaultPerformanceConfig(context, problem));
             PerformanceConfig config{};
+            const auto load = [&](const std::string& solver_id) {
+                const stats::ScopedTimer timer{stats::Histogram::PerfDbLookup};
+                return db().Load(problem, solver_id, config);
+            };
             // The passes in string needs to have priority over the entry in the database
             if(!perf_cfg.empty())
             {
@@ -99,9 +121,11 @@ auto FindSolutionImpl(rank<1>,
                 MIOPEN_LOG_WE("Invalid config loaded from Perf Db: "
                               << s.SolverDbId() << ": " << config << ". Performance may degrade.");
             }
-            else if(db().Load(problem, s.SolverDbId(), config))
+            else if(load(s.SolverDbId()))
             {
                 MIOPEN_LOG_I2("Perf Db: record loaded: " << s.SolverDbId());
+                stats::Increment(stats::Counter::PerfDbHit);
+                MIOPEN_TRACE_EVENT(Detail, PerfDbHit, s.SolverDbId().c_str(), 0);
                 if(s.IsValidPerformanceConfig(context, problem, config))
                 {
                     return s.GetSolution(context, problem, config);
@@ -109,9 +133,10 @@ auto FindSolutionImpl(rank<1>,
                 MIOPEN_LOG_WE("Invalid config loaded from Perf Db: "
                               << s.SolverDbId() << ": " << config << ". Performance may degrade.");
             }
-            else if(!s.AltSolverDbId().empty() && db().Load(problem, s.AltSolverDbId(), config))
+            else if(!s.AltSolverDbId().empty() && load(s.AltSolverDbId()))
             {
                 MIOPEN_LOG_I("Perf Db: alternate record loaded: " << s.AltSolverDbId());
+                stats::Increment(stats::Counter::PerfDbHit);
                 if(s.IsValidPerformanceConfig(context, problem, config))
                 {
                     return s.GetSolution(context, problem, config);
@@ -123,6 +148,8 @@ auto FindSolutionImpl(rank<1>,
             else
             {
                 MIOPEN_LOG_I("Perf Db: record not found for: " << s.SolverDbId());
+                MIOPEN_TRACE_EVENT(Detail, PerfDbMiss, s.SolverDbId().c_str(), 0);
+                stats::Increment(stats::Counter::PerfDbMiss);
             }
         }
 
@@ -237,6 +264,20 @@ InvokerFactory GetInvokeFactory(Solver s,
     return GetInvokeFactoryImpl(rank<1>{}, s, context, problem, perf_cfg);
 }
 
+template <class Solver, class Context, class Problem>
+bool IsApplicableCounted(const Solver& solver, const Context& context, const Problem& problem)
+{
+    stats::Increment(stats::Counter::IsApplicable);
+#if MIOPEN_MODE_NOGPU
+    if constexpr(std::is_same_v<Problem, miopen::conv::ProblemDescription>)
+    {
+        if(conv::IsSupersededByHostSolver(solver, problem))
+            return false;
+    }
+#endif
+    return solver.IsApplicable(context, problem);
+}
+
 template <class... Solvers>
 struct SolverContainer
 {
@@ -298,12 +339,15 @@ struct SolverContainer
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (non-dynamic)");
                 }
-                else if(!solver.IsApplicable(ctx, problem))
+                else if(!IsApplicableCounted(solver, ctx, problem))
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable");
+                    MIOPEN_TRACE_EVENT(
+                        Detail, SolverNotApplicable, solver.SolverDbId().c_str(), 0);
                 }
                 else
                 {
+                    MIOPEN_TRACE_EVENT(Detail, SolverConsidered, solver.SolverDbId().c_str(), 0);
                     const Solution s =
                         FindSolution(solver, ctx, problem, db, invoke_ctx, "", options);
                     if(s.Succeeded())
@@ -353,12 +397,15 @@ struct SolverContainer
                 // it is much faster than IsApplicable().
                 // else if(problem.use_dynamic_solutions_only && !solver.IsDynamic())
                 //    MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (non-dynamic)");
-                else if(!solver.IsApplicable(ctx, problem))
+                else if(!IsApplicableCounted(solver, ctx, problem))
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable");
+                    MIOPEN_TRACE_EVENT(
+                        Detail, SolverNotApplicable, solver.SolverDbId().c_str(), 0);
                 }
                 else
                 {
+                    MIOPEN_TRACE_EVENT(Detail, SolverConsidered, solver.SolverDbId().c_str(), 0);
                     auto db = [&]() -> PerformanceDb& {
                         constexpr auto db_getter =
                             []([[maybe_unused]] const ExecutionContext& ctx,
@@ -423,7 +470,7 @@ struct SolverContainer
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (non-dynamic)");
                 }
-                else if(!solver.IsApplicable(ctx, problem))
+                else if(!IsApplicableCounted(solver, ctx, problem))
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable");
                 }
@@ -35,7 +35,10 @@ namespace fusion {
 
 struct FusionOpInvokeParamBase
 {
-    virtual ~FusionOpInvokeParamBase() = default;
+    FusionOpInvokeParamBase()                               = default;
+    FusionOpInvokeParamBase(const FusionOpInvokeParamBase&) = default;
+    FusionOpInvokeParamBase& operator=(const FusionOpInvokeParamBase&) = default;
+    virtual ~FusionOpInvokeParamBase()                                  = default;
 };
 
 struct ConvolutionOpInvokeParam : FusionOpInvokeParamBase
@@ -28,6 +28,10 @@
 
 #include <miopen/miopen.h>
 
+#include <memory>
+#include <utility>
+#include <vector>
+
 namespace miopen {
 
 namespace fusion {
@@ -44,6 +48,19 @@ struct OperatorArgs : miopenOperatorArgs
             params.resize(idx + 1);
         params[idx] = std::move(arg);
     }
+
+    /// Reuses the storage of the previous argument of op idx if it has the same type, so that
+    /// setting the arguments again before every execution doesn't allocate.
+    template <class Param, class... Args>
+    void EmplaceArg(size_t idx, Args&&... args)
+    {
+        if(params.size() < (idx + 1))
+            params.resize(idx + 1);
+        if(auto* current = dynamic_cast<Param*>(params[idx].get()))
+            *current = Param(std::forward<Args>(args)...);
+        else
+            params[idx] = std::make_unique<Param>(std::forward<Args>(args)...);
+    }
 };
 
 } // namespace miopen
@@ -35,8 +35,13 @@
 
 namespace miopen {
 
+struct ConvolutionDescriptor;
+
 namespace graphapi {
 
+MIOPEN_INTERNALS_EXPORT ConvolutionDescriptor makeConvolutionDescriptor(const Convolution& conv,
+                                                                        int groupCount);
+
 class ConvBiasResAddActivForwardExecutor : public GraphPatternExecutor
 {
     // We dont use pointers here as we need deserialization
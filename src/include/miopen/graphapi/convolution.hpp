@@ -291,6 +291,8 @@ public:
     Tensor* getW() const noexcept { return mW; }
     double getAlpha() const noexcept { return mAlpha; }
     double getBeta() const noexcept { return mBeta; }
+
+    bool hashAttributes(internal::NodeKey& seed) const override;
 };
 
 class OperationConvolutionForward : public OperationConvolution
@@ -79,9 +79,23 @@ using TensorInfoMap = std::unordered_map<int64_t, TensorInfo>;
 class MIOPEN_INTERNALS_EXPORT GraphPatternExecutor
 {
 public:
+    /// Execution state owned by a finalized execution plan. Executors may resolve
+    /// their arguments here once instead of on every execute() call.
+    class MIOPEN_INTERNALS_EXPORT Binding
+    {
+    public:
+        virtual void execute(miopenHandle_t handle, const VariantPack& vpk) = 0;
+        virtual ~Binding();
+    };
+
     virtual void execute(miopenHandle_t handle, const VariantPack& vpk) = 0;
     virtual size_t getWorkspaceSize() const                             = 0;
     virtual nlohmann::json getJson()                                    = 0;
+    /// Returns nullptr if the executor has nothing to prepare ahead of execution.
+    virtual std::unique_ptr<Binding> bind() { return nullptr; }
+    /// Virtual tensors the executor reads from and writes to device memory. The execution plan
+    /// places them in its workspace and passes them through the variant pack.
+    virtual std::vector<int64_t> getVirtualTensorIds() const { return {}; }
     virtual ~GraphPatternExecutor();
 
     struct JsonFields
@@ -119,6 +133,8 @@ public:
 
     nlohmann::json getJson() final;
 
+    std::unique_ptr<Binding> bind() final;
+
     static constexpr const char* name = "GraphExecutorFind20";
 
     struct JsonFields
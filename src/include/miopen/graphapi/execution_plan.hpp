@@ -27,10 +27,12 @@
 #pragma once
 
 #include <miopen/graphapi/enginecfg.hpp>
+#include <miopen/graphapi/memory_plan.hpp>
 #include <miopen/graphapi/variant_pack.hpp>
 #include <nlohmann/json.hpp>
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -48,9 +50,33 @@ private:
     EngineCfg mEngineCfg;
     miopenHandle_t mHandle = nullptr;
     std::vector<int64_t> mIntermediateIds;
+    // Computed by ExecutionPlanBuilder from the graph, serialized since deserialized engines have
+    // no graph
+    MemoryPlan mMemoryPlan;
+    // Prepared by ExecutionPlanBuilder, not serialized
+    std::shared_ptr<GraphPatternExecutor::Binding> mBinding;
+    // Variant pack extended with the virtual tensors of mMemoryPlan, reused across executions.
+    // Prepared by ExecutionPlanBuilder when the memory plan is not empty, not serialized
+    struct AugmentedVariantPack;
+    std::shared_ptr<AugmentedVariantPack> mAugmentedVariantPack;
 
     friend class ExecutionPlanBuilder;
 
+    void prepare();
+
+    void executeImpl(miopenHandle_t handle, const VariantPack& variantPack)
+    {
+        if(mBinding)
+            mBinding->execute(handle, variantPack);
+        else
+            mEngineCfg.getEngine().getExecutor()->execute(handle, variantPack);
+    }
+
+    /// Executes with the virtual tensors placed in the arena added to the variant pack, and the
+    /// executor workspace moved past the arena. Tensor ids are only rebuilt when the caller's
+    /// ones change; otherwise only the data pointers are patched.
+    void executeAugmented(miopenHandle_t handle, const VariantPack& variantPack);
+
 public:
     ExecutionPlan()                     = default;
     ExecutionPlan(const ExecutionPlan&) = default;
@@ -64,15 +90,22 @@ public:
     const std::vector<int64_t>& getIntermediateIds() const noexcept { return mIntermediateIds; }
     std::string getJsonRepresentation() const;
 
+    const MemoryPlan& getMemoryPlan() const noexcept { return mMemoryPlan; }
+
     void execute(miopenHandle_t handle, const VariantPack& variantPack)
     {
         checkPtr(handle);
-        mEngineCfg.getEngine().getExecutor()->execute(handle, variantPack);
+        if(mAugmentedVariantPack)
+        {
+            executeAugmented(handle, variantPack);
+            return;
+        }
+        executeImpl(handle, variantPack);
     }
 
     size_t getWorkspaceSize() const
     {
-        return mEngineCfg.getEngine().getExecutor()->getWorkspaceSize();
+        return mMemoryPlan.mArenaSize + mEngineCfg.getEngine().getExecutor()->getWorkspaceSize();
     }
 
     struct SerializationMetadata
@@ -108,6 +141,7 @@ public:
         static constexpr const char* Metadata        = "header";
         static constexpr const char* EngineCfg       = "engine_cfg";
         static constexpr const char* IntermediateIds = "intermediate_ids";
+        static constexpr const char* MemoryPlan      = "memory_plan";
     };
 
     friend void to_json(nlohmann::json& json, const ExecutionPlan& executionPlan)
@@ -116,6 +150,7 @@ public:
             {JsonFields::Metadata, SerializationMetadata::current()},
             {JsonFields::EngineCfg, executionPlan.mEngineCfg},
             {JsonFields::IntermediateIds, executionPlan.mIntermediateIds},
+            {JsonFields::MemoryPlan, executionPlan.mMemoryPlan},
         };
     }
 
@@ -146,7 +181,14 @@ public:
 
         json.at(JsonFields::EngineCfg).get_to(executionPlan.mEngineCfg);
         json.at(JsonFields::IntermediateIds).get_to(executionPlan.mIntermediateIds);
-        executionPlan.mHandle = nullptr;
+        // absent from plans serialized before the memory planner
+        if(auto it = json.find(JsonFields::MemoryPlan); it != json.end())
+            it->get_to(executionPlan.mMemoryPlan);
+        else
+            executionPlan.mMemoryPlan = {};
+        executionPlan.mHandle               = nullptr;
+        executionPlan.mBinding              = nullptr;
+        executionPlan.mAugmentedVariantPack = nullptr;
     }
 };
 
@@ -88,14 +88,14 @@ public:
 class OperationMatmul : public OpNode
 {
 private:
-    Tensor* mA;
-    Tensor* mB;
-    Tensor* mC;
-    int64_t mBatchCount = 1;
-    Tensor* mGemmMOverride;
-    Tensor* mGemmNOverride;
-    Tensor* mGemmKOverride;
-    Matmul* mMatmul;
+    Tensor* mA             = nullptr;
+    Tensor* mB             = nullptr;
+    Tensor* mC             = nullptr;
+    int64_t mBatchCount    = 1;
+    Tensor* mGemmMOverride = nullptr;
+    Tensor* mGemmNOverride = nullptr;
+    Tensor* mGemmKOverride = nullptr;
+    Matmul* mMatmul        = nullptr;
 
 public:
     OperationMatmul(Tensor* A,
@@ -133,6 +133,7 @@ public:
         static const std::string name = "OP_MATMUL";
         return name;
     }
+    bool hashAttributes(internal::NodeKey& seed) const override;
 
 private:
     friend class OperationMatmulBuilder;
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#pragma once
+
+#include <miopen/graphapi/opgraph.hpp>
+#include <nlohmann/json_fwd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+namespace graphapi {
+
+/// Device buffer of a virtual tensor, live from the step of the node producing it to the
+/// step of its last consumer, steps being positions in the topological order of the graph.
+struct BufferLifetime
+{
+    int64_t mId        = 0;
+    std::size_t mSize  = 0;
+    std::size_t mFirst = 0;
+    std::size_t mLast  = 0;
+};
+
+/// Placement of virtual tensors in one arena at the start of the workspace. Buffers whose
+/// lifetimes don't overlap may share memory.
+struct MIOPEN_INTERNALS_EXPORT MemoryPlan
+{
+    static constexpr std::size_t Alignment = 256;
+
+    std::vector<std::pair<int64_t, std::size_t>> mOffsets{}; // tensor id and offset
+    std::size_t mArenaSize = 0;
+
+    bool empty() const noexcept { return mOffsets.empty(); }
+
+    friend void to_json(nlohmann::json& json, const MemoryPlan& plan);
+    friend void from_json(const nlohmann::json& json, MemoryPlan& plan);
+};
+
+/// Lifetimes of the given virtual tensors along the topological order of the graph.
+MIOPEN_INTERNALS_EXPORT std::vector<BufferLifetime>
+getBufferLifetimes(const OpGraph& graph, const std::vector<int64_t>& tensorIds);
+
+/// Assigns offsets greedily, largest buffers first, each one at the lowest offset that is free
+/// during its whole lifetime (interval graph coloring).
+MIOPEN_INTERNALS_EXPORT MemoryPlan planMemory(std::vector<BufferLifetime> buffers);
+
+} // namespace graphapi
+
+} // namespace miopen
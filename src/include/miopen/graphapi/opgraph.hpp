@@ -29,8 +29,11 @@
 #include <miopen/graphapi/engine.hpp>
 
 #include <algorithm>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
+#include <type_traits>
 #include <unordered_set>
 #include <vector>
 
@@ -79,6 +82,32 @@ bool noRepetitions(const R& r)
         return true;
     }
 }
+
+template <typename T>
+void hashCombine(std::size_t& seed, const T& value)
+{
+    seed ^= std::hash<T>{}(value) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+
+/// Hash of the values describing a node, together with the values themselves, so that a hash
+/// collision can be told apart from equal values.
+struct NodeKey
+{
+    std::size_t hash = 0;
+    std::string values;
+};
+
+template <typename T>
+void hashCombine(NodeKey& key, const T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    hashCombine(key.hash, value);
+    key.values.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// hashes everything that identifies a tensor of a graph: id, virtualness, type and shape
+MIOPEN_INTERNALS_EXPORT void hashTensor(NodeKey& key, const Tensor* tensor);
+
 } // end namespace internal
 
 class OpGraphBuilder;
@@ -92,6 +121,12 @@ public:
 
     virtual const std::string& signName() const = 0;
 
+    /// Adds the op attributes which are not expressed by signName() to the key of the node.
+    /// Graphs are identified by these keys in the engine cache, so every attribute that
+    /// may change the engines of a graph must be included. Returns false if the node can't
+    /// describe its attributes, which keeps graphs containing it out of the cache.
+    virtual bool hashAttributes(internal::NodeKey& seed) const;
+
 private:
     std::vector<Edge> mInEdges;
     std::vector<Edge> mOutEdges;
@@ -220,6 +255,33 @@ using VecOfPaths = std::vector<Path>;
 
 class Engine;
 
+/// Summary of the graph shape which doesn't depend on the order of the nodes. It is computed
+/// once when the graph is built, so pattern matchers compare it instead of walking the graph.
+/// Everything the engines of a graph depend on: the sorted keys of its nodes. Tensor ids are
+/// part of the keys, and they also tell the edges, so equal fingerprints mean identical graphs.
+struct GraphFingerprint
+{
+    std::size_t hash = 0;
+    std::vector<std::string> nodes{}; // sorted
+
+    friend bool operator==(const GraphFingerprint& l, const GraphFingerprint& r)
+    {
+        return l.hash == r.hash && l.nodes == r.nodes;
+    }
+    friend bool operator!=(const GraphFingerprint& l, const GraphFingerprint& r)
+    {
+        return !(l == r);
+    }
+};
+
+struct GraphSignature
+{
+    std::size_t mNumEdges = 0;
+    std::vector<std::string> mNodeNames{};                  // sorted
+    std::vector<std::pair<size_t, size_t>> mInOutDegrees{}; // sorted
+    std::size_t mStructuralHash = 0;
+};
+
 class MIOPEN_INTERNALS_EXPORT OpGraph
 {
     // NOTE: mSrcNode and mSinkNode need to reside on the heap because the graph may move
@@ -231,7 +293,9 @@ class MIOPEN_INTERNALS_EXPORT OpGraph
 
     // Descriptor related members
     miopenHandle_t mHandle = nullptr;
-    std::vector<Engine> mEngines{};
+    std::optional<std::vector<Engine>> mEngines{};
+
+    GraphSignature mSignature{};
 
 public:
     OpGraph(const OpGraph&) = delete;
@@ -347,6 +411,16 @@ public:
 
     VecOfPaths getAllPaths() const;
 
+    /// Canonical hash of the graph shape: Weisfeiler-Lehman refinement over op names and
+    /// edges. Isomorphic graphs have equal hashes, tensors and op attributes are ignored.
+    std::size_t getStructuralHash() const noexcept { return mSignature.mStructuralHash; }
+
+    const GraphSignature& getSignature() const noexcept { return mSignature; }
+
+    /// Canonical description of the graph including tensor ids, types, shapes and op
+    /// attributes. Empty if some op can't describe its attributes.
+    std::optional<GraphFingerprint> getFingerprint() const;
+
     // NOTE: for testing only. May remove in the future
     bool hasEdgeFromSource(OpNode* dst, Tensor* tens_ptr) const
     {
@@ -360,9 +434,14 @@ public:
     }
 
     miopenHandle_t getHandle() const noexcept { return mHandle; }
-    const std::vector<Engine>& getEngines() const noexcept { return mEngines; }
 
-    void initEngines(); /// \todo make private. Called in finalize, but also
+    /// Engines are found on first use rather than when the graph is built, since
+    /// frameworks often build graphs which are never executed.
+    const std::vector<Engine>& getEngines();
+
+    bool hasEngines() const noexcept { return mEngines.has_value(); }
+
+    void initEngines(); /// \todo make private. Called on first use, but also
                         /// from C++ tests --amberhassaan May, 2024
 
 private:
@@ -431,6 +510,10 @@ public:
     OpGraph build() &&;
 };
 
+/// Nodes ordered so that every node comes after the producers of its inputs.
+/// Throws if the graph contains a cycle.
+MIOPEN_INTERNALS_EXPORT std::vector<OpNode*> topologicalSort(const OpGraph& graph);
+
 MIOPEN_INTERNALS_EXPORT bool isIsomorphic(const OpGraph& left, const OpGraph& right);
 
 MIOPEN_INTERNALS_EXPORT std::string pathToStr(const Path& path);
@@ -0,0 +1,166 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#pragma once
+
+#include <miopen/miopen.h>
+#include <miopen/graphapi/engine.hpp>
+#include <miopen/graphapi/opgraph.hpp>
+#include <miopen/graphapi/tensor.hpp>
+#include <miopen/graphapi/variant_pack.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+namespace graphapi {
+
+/// One step of a fused pointwise chain. Every register holds the value of one tensor of the
+/// chain at the element being computed.
+struct PointwiseInstruction
+{
+    miopenPointwiseMode_t mMode = MIOPEN_POINTWISE_IDENTITY;
+    int32_t mDst                = 0;
+    int32_t mSrc0               = 0;
+    int32_t mSrc1               = 0;
+    /// alpha1, alpha2, then the mode parameters: relu lower clip, upper clip and lower clip
+    /// slope, elu alpha, softplus beta or swish beta
+    float mConstants[5] = {1.0f, 1.0f, 0.0f, 0.0f, 0.0f};
+};
+
+/// Straight-line program computing all pointwise ops of a graph in one pass. Registers
+/// [0, mInputs.size()) are loaded from the input tensors, the following ones are written by
+/// the instructions in order.
+struct PointwiseProgram
+{
+    static constexpr std::size_t MaxInputs       = 8;
+    static constexpr std::size_t MaxOutputs      = 4;
+    static constexpr std::size_t MaxInstructions = 16;
+    static constexpr std::size_t MaxDims         = 5;
+
+    std::vector<int64_t> mInputs{};                        // tensor ids
+    std::vector<PointwiseInstruction> mInstructions{};
+    std::vector<std::pair<int64_t, int32_t>> mOutputs{}; // tensor id and register
+
+    int32_t getNumRegisters() const
+    {
+        return static_cast<int32_t>(mInputs.size() + mInstructions.size());
+    }
+
+    /// Describes everything the generated kernel is specialized for.
+    std::string getNetworkConfig() const;
+
+    /// Compiler definitions specializing MIOpenPointwiseChain.cpp for this program.
+    std::string getBuildParams() const;
+};
+
+/// Op producing the first value of the chain, whose output is read back from the workspace.
+enum class PointwiseChainAnchor
+{
+    None,
+    Convolution,
+    Matmul,
+    Reduction,
+};
+
+struct PointwiseChain
+{
+    PointwiseChainAnchor mAnchorKind = PointwiseChainAnchor::None;
+    OpNode* mAnchor                  = nullptr;
+    std::vector<Tensor*> mAnchorInputs{};
+    PointwiseProgram mProgram{};
+    std::vector<std::size_t> mLengths{};   // lengths of every output of the chain
+    std::vector<Tensor*> mInputTensors{};  // parallel to mProgram.mInputs
+    std::vector<Tensor*> mOutputTensors{}; // parallel to mProgram.mOutputs
+};
+
+/// Fusion decision for the generic pointwise engine. Accepts connected graphs of float
+/// pointwise ops that have a kernel implementation, optionally fed by one convolution forward,
+/// matmul or reduction. All outputs and virtual tensors must have the same lengths, and
+/// inputs must broadcast to them. Returns an empty optional if the graph can't be fused.
+MIOPEN_INTERNALS_EXPORT std::optional<PointwiseChain> analyzePointwiseChain(const OpGraph& graph);
+
+MIOPEN_INTERNALS_EXPORT bool isFusablePointwiseMode(miopenPointwiseMode_t mode);
+
+/// Host reference of a single instruction, following the generated kernel.
+MIOPEN_INTERNALS_EXPORT float evaluatePointwise(const PointwiseInstruction& instruction,
+                                                float x,
+                                                float b);
+
+/// Runs the chain on the host. Buffers are parallel to mInputTensors and mOutputTensors and
+/// are addressed through the strides of these tensors.
+MIOPEN_INTERNALS_EXPORT void evaluatePointwiseChain(const PointwiseChain& chain,
+                                                    const std::vector<const float*>& inputs,
+                                                    const std::vector<float*>& outputs);
+
+/// Runs the program as one elementwise kernel. If the chain is anchored, the anchor executor
+/// first writes its output into the virtual tensor the execution plan places in its workspace.
+class PointwiseChainExecutor : public GraphPatternExecutor
+{
+    PointwiseProgram mProgram;
+    std::vector<std::size_t> mLengths;
+    std::vector<Tensor> mInputTensors;
+    std::vector<Tensor> mOutputTensors;
+    std::shared_ptr<GraphPatternExecutor> mAnchor;
+    // anchor output is the virtual tensor with this id, anchor inputs come from the variant pack
+    int64_t mAnchorOutputId = 0;
+    std::vector<int64_t> mAnchorInputIds;
+
+public:
+    PointwiseChainExecutor(const PointwiseChain& chain,
+                           const std::shared_ptr<GraphPatternExecutor>& anchor = nullptr);
+
+    PointwiseChainExecutor(const nlohmann::json& json);
+
+    void execute(miopenHandle_t handle, const VariantPack& vpk) final;
+
+    size_t getWorkspaceSize() const final;
+
+    std::vector<int64_t> getVirtualTensorIds() const final;
+
+    nlohmann::json getJson() final;
+
+    static constexpr const char* name = "PointwiseChainExecutor";
+
+    struct JsonFields
+    {
+        static constexpr const char* Program        = "program";
+        static constexpr const char* Lengths        = "lengths";
+        static constexpr const char* InputTensors   = "input_tensors";
+        static constexpr const char* OutputTensors  = "output_tensors";
+        static constexpr const char* Anchor         = "anchor";
+        static constexpr const char* AnchorOutputId = "anchor_output_id";
+        static constexpr const char* AnchorInputIds = "anchor_input_ids";
+    };
+};
+
+} // namespace graphapi
+
+} // namespace miopen
@@ -58,6 +58,7 @@ public:
     OpKind getOpKind() const noexcept { return mOpKind; }
 
     const std::string& signName() const override;
+    bool hashAttributes(internal::NodeKey& seed) const override;
     std::vector<Tensor*> getInTensors() const override;
     std::vector<Tensor*> getOutTensors() const override;
 };
@@ -159,6 +159,7 @@ public:
     Tensor* getOffset() const noexcept { return mOffset; }
 
     virtual const std::string& signName() const override;
+    virtual bool hashAttributes(internal::NodeKey& seed) const override;
     virtual std::vector<Tensor*> getInTensors() const override;
     virtual std::vector<Tensor*> getOutTensors() const override;
 };
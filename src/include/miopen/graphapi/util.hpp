@@ -53,8 +53,8 @@ Tensor makeTensor(std::string_view name, miopenDataType_t dt, const Vec& dims, c
 
     return TensorBuilder{}
         .setDataType(dt)
-        .setDim(dims)
-        .setStride(strides)
+        .setDim(std::vector<std::size_t>(dims.begin(), dims.end()))
+        .setStride(std::vector<std::size_t>(strides.begin(), strides.end()))
         .setId(id)
         .setVirtual(isVirtual)
         .build();
@@ -98,6 +98,7 @@ public:
 private:
     friend class VariantPackBuilder;
     friend class BackendVariantPackDescriptor;
+    friend class ExecutionPlan;
 };
 
 class VariantPackBuilder
@@ -179,6 +179,10 @@ struct MIOPEN_EXPORT Handle : miopenHandle
 
     virtual std::string GetDeviceName() const;
     const TargetProperties& GetTargetProperties() const;
+#if MIOPEN_BACKEND_HIP
+    /// Ordinal of the device the handle runs on.
+    int GetDeviceId() const;
+#endif
 
 private:
     std::string GetDeviceNameImpl() const;
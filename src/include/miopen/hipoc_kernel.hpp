@@ -31,6 +31,7 @@
 #include <miopen/hipoc_program.hpp>
 #include <miopen/stringutils.hpp>
 #include <miopen/op_kernel_args.hpp>
+#include <miopen/trace.hpp>
 
 #include <array>
 #include <cassert>
@@ -127,6 +128,7 @@ struct MIOPEN_INTERNALS_EXPORT HIPOCKernelInvoke
                       std::array<size_t, 3> pldims,
                       std::array<size_t, 3> pgdims,
                       std::string pname,
+                      const char* ptrace_name,
                       std::function<void(hipEvent_t, hipEvent_t)> pcallback,
                       bool pcoop_launch)
         : stream(pstream),
@@ -134,6 +136,7 @@ struct MIOPEN_INTERNALS_EXPORT HIPOCKernelInvoke
           ldims(pldims),
           gdims(pgdims),
           name(pname),
+          trace_name(ptrace_name),
           callback(pcallback),
           coop_launch(pcoop_launch)
     {
@@ -193,6 +196,7 @@ private:
     std::array<size_t, 3> ldims = {};
     std::array<size_t, 3> gdims = {};
     std::string name;
+    const char* trace_name = nullptr;
     std::function<void(hipEvent_t, hipEvent_t)> callback;
     bool coop_launch;
 };
@@ -205,14 +209,19 @@ struct MIOPEN_INTERNALS_EXPORT HIPOCKernel
     std::array<size_t, 3> gdims = {};
     std::string kernel_module;
     hipFunction_t fun = nullptr;
+    /// Interned once here, so that launches don't lock the intern table.
+    const char* trace_name = nullptr;
 
     HIPOCKernel() {}
-    HIPOCKernel(HIPOCProgram p, const std::string kernel_name) : program(p), name(kernel_name) {}
+    HIPOCKernel(HIPOCProgram p, const std::string kernel_name)
+        : program(p), name(kernel_name), trace_name(trace::Intern(name))
+    {
+    }
     HIPOCKernel(HIPOCProgram p,
                 const std::string kernel_name,
                 std::vector<size_t> local_dims,
                 std::vector<size_t> global_dims)
-        : program(p), name(kernel_name)
+        : program(p), name(kernel_name), trace_name(trace::Intern(name))
     {
         assert(!local_dims.empty() && local_dims.size() <= 3);
         assert(!global_dims.empty() && global_dims.size() <= 3);
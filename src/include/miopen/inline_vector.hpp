@@ -26,7 +26,11 @@
 #ifndef GUARD_MIOPEN_INLINE_VECTOR_HPP
 #define GUARD_MIOPEN_INLINE_VECTOR_HPP
 
+#include <algorithm>
 #include <array>
+#include <cassert>
+#include <iterator>
+#include <vector>
 #include <miopen/config.h>
 #include <miopen/errors.hpp>
 
@@ -221,6 +225,20 @@ public:
         storage[real_size++] = std::move(e);
     }
 
+    // Insert element before pos
+    iterator insert(const_iterator pos, const T& e)
+    {
+        if(real_size == N)
+        {
+            MIOPEN_THROW("InlineVector already full");
+        }
+        const auto idx = std::distance(cbegin(), pos);
+        std::copy_backward(begin() + idx, end(), end() + 1);
+        storage[idx] = e;
+        ++real_size;
+        return begin() + idx;
+    }
+
     /*
         Because only scalar type is supported there is no need for emplace_back method.
         Implement emplace_back method when adding support for other data types.
@@ -241,6 +259,47 @@ public:
     // Capacity
     constexpr size_type capacity() const { return N; }
 
+    // Conversion for the code written against std::vector. Explicit, since it allocates.
+    explicit operator std::vector<T>() const { return {begin(), end()}; }
+
+    // Comparison
+    friend bool operator==(const InlineVector& lhs, const InlineVector& rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend bool operator==(const InlineVector& lhs, const std::vector<T>& rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend bool operator==(const std::vector<T>& lhs, const InlineVector& rhs)
+    {
+        return rhs == lhs;
+    }
+
+    friend bool operator!=(const InlineVector& lhs, const InlineVector& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator!=(const InlineVector& lhs, const std::vector<T>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator!=(const std::vector<T>& lhs, const InlineVector& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const InlineVector& lhs, const InlineVector& rhs)
+    {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend bool operator>(const InlineVector& lhs, const InlineVector& rhs) { return rhs < lhs; }
+
 private:
     storage_type storage{};
     size_type real_size = 0;
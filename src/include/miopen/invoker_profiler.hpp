@@ -0,0 +1,118 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_INVOKER_PROFILER_HPP_
+#define GUARD_MIOPEN_INVOKER_PROFILER_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/invoker.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace miopen {
+namespace invoker_profiler {
+
+/// Parts of an invoker call which are timed separately. Whatever remains of the call,
+/// i.e. the any_cast of the invoke params, building the kernel arguments and computing
+/// workspace offsets, is reported as marshalling.
+enum class Phase
+{
+    Lookup, ///< Handle::Run(): obtaining the launchable kernel.
+    Launch, ///< The kernel launch call itself.
+    Wait,   ///< Waiting for kernel events when Handle profiling is enabled.
+    Count,
+};
+
+/// Host time spent in the invokers of one solver, in nanoseconds.
+struct SolverProfile
+{
+    std::string solver;
+    std::uint64_t calls    = 0;
+    std::uint64_t launches = 0;
+    std::uint64_t total    = 0;
+    std::uint64_t lookup   = 0;
+    std::uint64_t launch   = 0;
+    std::uint64_t wait     = 0;
+    /// Time of invoker calls made from inside this solver's invokers.
+    std::uint64_t nested = 0;
+
+    std::uint64_t Marshalling() const { return total - nested - lookup - launch - wait; }
+};
+
+/// True when MIOPEN_INVOKER_PROFILE is set or profiling was enabled with Enable().
+MIOPEN_INTERNALS_EXPORT bool IsEnabled();
+MIOPEN_INTERNALS_EXPORT void Enable(bool enable);
+
+/// Returns an invoker which records its host time under `solver`, or the invoker itself
+/// when profiling is disabled.
+MIOPEN_INTERNALS_EXPORT Invoker Wrap(const Invoker& invoker, const std::string& solver);
+
+/// Adds time to the phase of the invoker call running on this thread, if any.
+MIOPEN_INTERNALS_EXPORT void AddTime(Phase phase, std::uint64_t ns);
+MIOPEN_INTERNALS_EXPORT bool IsInsideInvoker();
+
+/// Per-solver totals since the last Reset(), the most expensive solvers first.
+MIOPEN_INTERNALS_EXPORT std::vector<SolverProfile> Collect();
+MIOPEN_INTERNALS_EXPORT void Reset();
+MIOPEN_INTERNALS_EXPORT void Print(std::ostream& os, const std::vector<SolverProfile>& profiles);
+
+/// Records the lifetime of the object, or the time until Stop(), into the phase of the current
+/// invoker call.
+class PhaseTimer
+{
+public:
+    explicit PhaseTimer(Phase phase_) : phase(phase_), active(IsEnabled() && IsInsideInvoker())
+    {
+        if(active)
+            start = std::chrono::steady_clock::now();
+    }
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+    ~PhaseTimer() { Stop(); }
+
+    /// Ends the measurement before the end of the scope.
+    void Stop()
+    {
+        if(!active)
+            return;
+        active             = false;
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        AddTime(phase, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+private:
+    Phase phase;
+    bool active;
+    std::chrono::steady_clock::time_point start;
+};
+
+} // namespace invoker_profiler
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_INVOKER_PROFILER_HPP_
@@ -30,12 +30,17 @@
 #include <vector>
 
 #include <miopen/config.h>
+#include <miopen/config.hpp>
 #include <miopen/filesystem.hpp>
 
 namespace miopen {
 std::string_view GetKernelSrc(const fs::path& name);
 std::string_view GetKernelInc(const fs::path& name);
 const std::vector<std::reference_wrapper<const fs::path>>& GetKernelIncList();
+/// Headers of GetKernelIncList() which `src` includes directly or through other headers.
+/// Returns all of them if an include can't be resolved without preprocessing.
+MIOPEN_INTERNALS_EXPORT std::vector<std::reference_wrapper<const fs::path>>
+GetKernelIncClosure(std::string_view src);
 } // namespace miopen
 
 #if MIOPEN_BACKEND_OPENCL
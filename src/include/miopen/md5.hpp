@@ -7,6 +7,7 @@
 
 namespace miopen {
 
+MIOPEN_INTERNALS_EXPORT std::string md5(const void* data, std::size_t length);
 MIOPEN_INTERNALS_EXPORT std::string md5(const std::string&);
 MIOPEN_INTERNALS_EXPORT std::string md5(const std::vector<char>&);
 
@@ -53,32 +53,32 @@ inline std::string GetDataTypeName(miopenDataType_t data_type)
     return "Unknown(" + std::to_string(data_type) + ")";
 }
 
-template <class TElement>
-constexpr TElement GetN5(unsigned spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetN5(unsigned spatial_dims, const TData& data)
 {
     return std::get<0>(GetNCDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr TElement GetC5(unsigned spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetC5(unsigned spatial_dims, const TData& data)
 {
     return std::get<1>(GetNCDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr TElement GetD5(unsigned spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetD5(unsigned spatial_dims, const TData& data)
 {
     return std::get<2>(GetNCDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr TElement GetH5(unsigned spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetH5(unsigned spatial_dims, const TData& data)
 {
     return std::get<3>(GetNCDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr TElement GetW5(unsigned spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetW5(unsigned spatial_dims, const TData& data)
 {
     return std::get<4>(GetNCDHW(spatial_dims, data));
 }
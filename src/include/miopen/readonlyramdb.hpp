@@ -33,6 +33,7 @@
 
 #include <unordered_map>
 #include <string>
+#include <string_view>
 #include <sstream>
 
 namespace miopen {
@@ -89,26 +90,30 @@ public:
         return record->GetValues(id, value);
     }
 
+    /// Keys and contents point into the embedded database image or into the file contents
+    /// owned by the db, and are valid for the lifetime of the db.
     struct CacheItem
     {
         int line;
-        std::string content;
+        std::string_view content;
     };
 
-    const std::unordered_map<std::string, CacheItem>& GetCacheMap() const { return cache; }
+    const std::unordered_map<std::string_view, CacheItem>& GetCacheMap() const { return cache; }
 
 private:
     DbKinds db_kind;
     fs::path db_path;
-    std::unordered_map<std::string, CacheItem> cache;
+    std::string file_contents;
+    std::unordered_map<std::string_view, CacheItem> cache;
 
-    ReadonlyRamDb(const ReadonlyRamDb&) = default;
-    ReadonlyRamDb(ReadonlyRamDb&&)      = default;
-    ReadonlyRamDb& operator=(const ReadonlyRamDb&) = default;
-    ReadonlyRamDb& operator=(ReadonlyRamDb&&) = default;
+    // The cache points into file_contents.
+    ReadonlyRamDb(const ReadonlyRamDb&) = delete;
+    ReadonlyRamDb(ReadonlyRamDb&&)      = delete;
+    ReadonlyRamDb& operator=(const ReadonlyRamDb&) = delete;
+    ReadonlyRamDb& operator=(ReadonlyRamDb&&) = delete;
 
     void Prefetch(bool warn_if_unreadable);
-    void ParseAndLoadDb(std::istream& input_stream, bool warn_if_unreadable);
+    void ParseAndLoadDb(std::string_view contents);
 };
 
 } // namespace miopen
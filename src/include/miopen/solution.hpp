@@ -30,6 +30,7 @@
 
 #include <miopen/config.hpp>
 #include <miopen/errors.hpp>
+#include <miopen/invoke_params.hpp>
 #include <miopen/kernel_info.hpp>
 #include <miopen/object.hpp>
 #include <miopen/problem.hpp>
@@ -46,6 +47,7 @@
 namespace miopen {
 
 struct Handle;
+struct BoundSolution;
 
 struct MIOPEN_INTERNALS_EXPORT Solution : miopenSolution
 {
@@ -149,6 +151,8 @@ struct MIOPEN_INTERNALS_EXPORT Solution : miopenSolution
     const std::vector<KernelInfo>& GetKernels() const { return kernels; }
 
 private:
+    friend struct BoundSolution;
+
     float time                     = 0;
     std::size_t workspace_required = 0;
     solver::Id solver;
@@ -201,6 +205,55 @@ private:
 
 } // namespace miopen
 
+namespace miopen {
+
+/// Solution with its tensor descriptors fixed at creation. Arguments are looked up, validated
+/// and baked into invoke parameters once, so that subsequent runs only patch buffer pointers
+/// and call the cached invoker. The first run goes through Solution::Run to obtain the invoker.
+/// Operators without a prebuilt parameter layout always take that path.
+/// Runs patch the shared parameters in place, so a bound solution is not thread-safe, and the
+/// cached invoker is only used with the handle it has been obtained with.
+struct MIOPEN_INTERNALS_EXPORT BoundSolution : miopenBoundSolution
+{
+    BoundSolution(const Solution& solution_, const std::vector<miopenTensorArgument_t>& arguments);
+
+    // Slots point into params, so the object can't be copied.
+    BoundSolution(const BoundSolution&) = delete;
+    BoundSolution& operator=(const BoundSolution&) = delete;
+
+    /// buffers are given in the order of the arguments the solution has been bound with.
+    void Run(const Handle& handle,
+             void* const* buffers,
+             Data_t workspace,
+             std::size_t workspace_size);
+
+    std::size_t GetArgumentCount() const { return ids.size(); }
+    const Solution& GetSolution() const { return solution; }
+
+private:
+    Solution solution;
+    std::vector<miopenTensorArgumentId_t> ids;
+    std::unordered_map<miopenTensorArgumentId_t, Solution::RunInput> inputs;
+
+    AnyInvokeParams params;
+    std::optional<Invoker> invoker;
+    const Handle* invoker_handle = nullptr;
+    std::vector<std::pair<std::size_t, Data_t*>> slots;
+    std::vector<std::pair<std::size_t, ConstData_t*>> const_slots;
+    Data_t* workspace_slot           = nullptr;
+    std::size_t* workspace_size_slot = nullptr;
+
+    std::size_t GetIndex(miopenTensorArgumentId_t id) const;
+
+    template <class TData>
+    void BindSlot(miopenTensorArgumentId_t id, TData& field);
+
+    void Prepare(const ConvolutionDescriptor& conv_desc);
+    void Prepare(const SoftmaxDescriptor& softmax_desc);
+};
+
+} // namespace miopen
+
 inline std::ostream& operator<<(std::ostream& stream, const miopen::Solution& solution)
 {
     // Todo: sane printing
@@ -208,4 +261,11 @@ inline std::ostream& operator<<(std::ostream& stream, const miopen::Solution& so
     return stream;
 }
 
+inline std::ostream& operator<<(std::ostream& stream, const miopen::BoundSolution& solution)
+{
+    stream << &solution;
+    return stream;
+}
+
 MIOPEN_DEFINE_OBJECT(miopenSolution, miopen::Solution);
+MIOPEN_DEFINE_OBJECT(miopenBoundSolution, miopen::BoundSolution);
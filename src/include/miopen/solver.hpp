@@ -82,6 +82,9 @@ struct SolverBase
     /// Must return true if a Solver has its own implementation of GetWorkspaceSize().
     virtual bool MayNeedWorkspace() const { return false; }
 
+    /// Returns true for solvers whose invokers compute on the host instead of launching kernels.
+    virtual bool IsHostSolver() const { return false; }
+
 protected:
     template <class Solver>
     static const std::string& GetSolverDbId()
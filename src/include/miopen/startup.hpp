@@ -0,0 +1,93 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_STARTUP_HPP_
+#define GUARD_MIOPEN_STARTUP_HPP_
+
+#include <miopen/config.hpp>
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+struct Handle;
+
+namespace startup {
+
+/// One-time initialization work which the library does lazily on first use.
+enum class Step
+{
+    SolverRegistry, ///< Registering all solvers in the id registry.
+    DbPrefetch,     ///< Loading a system database into memory.
+    AiModel,        ///< Constructing a TunaNet or KernelTuningNet model.
+};
+
+MIOPEN_INTERNALS_EXPORT const char* ToString(Step step);
+
+/// Times are in nanoseconds since the library was loaded.
+struct Event
+{
+    Step step;
+    std::string detail;
+    std::uint64_t begin;
+    std::uint64_t end;
+    std::size_t thread;
+    /// Done by a thread of WarmStart().
+    bool warm_start;
+};
+
+/// Records the lifetime of the object as one step of the startup timeline.
+class MIOPEN_INTERNALS_EXPORT ScopedStep
+{
+public:
+    explicit ScopedStep(Step step_, std::string detail_ = {});
+    ScopedStep(const ScopedStep&) = delete;
+    ScopedStep& operator=(const ScopedStep&) = delete;
+    ~ScopedStep();
+
+private:
+    Step step;
+    std::string detail;
+    std::uint64_t begin;
+};
+
+/// All steps recorded so far, in the order they have started.
+MIOPEN_INTERNALS_EXPORT std::vector<Event> GetTimeline();
+MIOPEN_INTERNALS_EXPORT void Print(std::ostream& os, const std::vector<Event>& timeline);
+
+/// Starts the lazy initialization of the solver registry, the system databases of the handle's
+/// device and the TunaNet model on background threads. Each of them is still done only once,
+/// so the calls made later by the library just wait for the result.
+MIOPEN_INTERNALS_EXPORT void WarmStart(const Handle& handle);
+/// Waits until the threads started by WarmStart() are done.
+MIOPEN_INTERNALS_EXPORT void WaitForWarmStart();
+
+} // namespace startup
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_STARTUP_HPP_
@@ -0,0 +1,140 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_STATS_HPP_
+#define GUARD_MIOPEN_STATS_HPP_
+
+#include <miopen/config.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+namespace miopen {
+namespace stats {
+
+enum class Counter : std::size_t
+{
+    InvokerCacheHit,
+    InvokerCacheMiss,
+    FindDbHit,
+    FindDbMiss,
+    PerfDbHit,
+    PerfDbMiss,
+    KernelCacheHit,
+    KernelCacheMiss,
+    IsApplicable,
+    FusionPlanCacheHit,
+    FusionPlanCacheMiss,
+    GraphEngineCacheHit,
+    GraphEngineCacheMiss,
+    Count,
+};
+
+/// Durations, in microseconds.
+enum class Histogram : std::size_t
+{
+    FindDbLookup,
+    PerfDbLookup,
+    Compile,
+    Count,
+};
+
+/// Bucket i holds the values which need exactly i bits, the last one holds the rest.
+constexpr std::size_t histogram_buckets = 32;
+
+struct HistogramData
+{
+    std::uint64_t count = 0;
+    std::uint64_t sum   = 0;
+    std::array<std::uint64_t, histogram_buckets> buckets{};
+
+    double Mean() const { return count == 0 ? 0.0 : static_cast<double>(sum) / count; }
+    /// Upper bound of the bucket holding the given percentile.
+    MIOPEN_INTERNALS_EXPORT std::uint64_t Percentile(double percentile) const;
+};
+
+struct Snapshot
+{
+    std::array<std::uint64_t, static_cast<std::size_t>(Counter::Count)> counters{};
+    std::array<HistogramData, static_cast<std::size_t>(Histogram::Count)> histograms{};
+
+    std::uint64_t Get(Counter counter) const
+    {
+        return counters[static_cast<std::size_t>(counter)];
+    }
+    const HistogramData& Get(Histogram histogram) const
+    {
+        return histograms[static_cast<std::size_t>(histogram)];
+    }
+
+    MIOPEN_INTERNALS_EXPORT friend std::ostream& operator<<(std::ostream& os,
+                                                            const Snapshot& snapshot);
+};
+
+/// Counters are kept per thread and are only aggregated by Collect(),
+/// so updating them never contends with other threads.
+MIOPEN_INTERNALS_EXPORT void Increment(Counter counter, std::uint64_t value = 1);
+MIOPEN_INTERNALS_EXPORT void Record(Histogram histogram, std::uint64_t value);
+
+/// Sums the counters of all the threads, including the finished ones, since the last Reset().
+MIOPEN_INTERNALS_EXPORT Snapshot Collect();
+MIOPEN_INTERNALS_EXPORT void Reset();
+
+/// Number of threads whose counters are still registered. Exited threads fold their
+/// counters into a retired total and unregister.
+MIOPEN_INTERNALS_EXPORT std::size_t GetNumThreads();
+
+MIOPEN_INTERNALS_EXPORT const char* GetName(Counter counter);
+MIOPEN_INTERNALS_EXPORT const char* GetName(Histogram histogram);
+
+/// Records the lifetime of the object into the histogram.
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(Histogram histogram_)
+        : histogram(histogram_), start(std::chrono::steady_clock::now())
+    {
+    }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+    ~ScopedTimer()
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        Record(histogram,
+               std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+    }
+
+private:
+    Histogram histogram;
+    std::chrono::steady_clock::time_point start;
+};
+
+} // namespace stats
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_STATS_HPP_
@@ -32,6 +32,7 @@
 #include <miopen/each_args.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/functional.hpp>
+#include <miopen/inline_vector.hpp>
 #include <miopen/object.hpp>
 #include <miopen/returns.hpp>
 
@@ -42,6 +43,7 @@
 #include <numeric>
 #include <vector>
 #include <optional>
+#include <string_view>
 #include <utility>
 
 namespace miopen {
@@ -135,6 +137,14 @@ std::ptrdiff_t integer_division_ceil(X x, Y y)
     return (tx + ty - 1) / ty;
 }
 
+/// Maximum number of dimensions of a TensorDescriptor. Lengths and strides are stored inline, so
+/// that copying a descriptor never allocates.
+constexpr std::size_t tensor_max_dims = 8;
+
+using TensorDims = InlineVector<std::size_t, tensor_max_dims>;
+
+class TensorLayoutCode;
+
 struct MIOPEN_INTERNALS_EXPORT TensorDescriptor : miopenTensorDescriptor
 {
     TensorDescriptor();
@@ -156,6 +166,7 @@ struct MIOPEN_INTERNALS_EXPORT TensorDescriptor : miopenTensorDescriptor
     TensorDescriptor(miopenDataType_t t, const std::initializer_list<std::size_t>& lens_in);
     TensorDescriptor(miopenDataType_t t, const std::vector<std::size_t>& lens_in);
     TensorDescriptor(miopenDataType_t t, std::vector<std::size_t>&& lens_in);
+    TensorDescriptor(miopenDataType_t t, const TensorDims& lens_in);
 
     TensorDescriptor(miopenDataType_t t,
                      miopenTensorLayout_t layout_in,
@@ -182,6 +193,7 @@ struct MIOPEN_INTERNALS_EXPORT TensorDescriptor : miopenTensorDescriptor
     TensorDescriptor(miopenDataType_t t,
                      std::vector<std::size_t>&& lens_in,
                      std::vector<std::size_t>&& strides_in);
+    TensorDescriptor(miopenDataType_t t, const TensorDims& lens_in, const TensorDims& strides_in);
 
     TensorDescriptor(miopenDataType_t t,
                      miopenTensorLayout_t layout_in,
@@ -210,8 +222,8 @@ struct MIOPEN_INTERNALS_EXPORT TensorDescriptor : miopenTensorDescriptor
 
     bool IsVectorized() const;
 
-    const std::vector<std::size_t>& GetLengths() const;
-    const std::vector<std::size_t>& GetStrides() const;
+    const TensorDims& GetLengths() const;
+    const TensorDims& GetStrides() const;
     unsigned GetNumDims() const;
 
     miopenDataType_t GetType() const;
@@ -221,7 +233,10 @@ struct MIOPEN_INTERNALS_EXPORT TensorDescriptor : miopenTensorDescriptor
     // clang-format on
     const std::optional<miopenTensorLayout_t>& GetLayoutEnum() const;
     static std::string LayoutEnumToStr(miopenTensorLayout_t layout);
-    const std::string& GetLayout_str() const;
+    /// The view stays valid while the descriptor is alive.
+    std::string_view GetLayout_str() const;
+    /// Same layout as GetLayout_str(), computed from the layout enum or the strides.
+    TensorLayoutCode GetLayoutCode() const;
 
     std::size_t GetVectorLength() const;
     std::optional<miopenDataType_t> GetCastType() const;
@@ -287,10 +302,16 @@ private:
                      std::vector<std::size_t>&& strides_in,
                      bool use_strides);
 
+    TensorDescriptor(miopenDataType_t t,
+                     const std::optional<miopenTensorLayout_t>& layout_in,
+                     const TensorDims& lens_in,
+                     const TensorDims& strides_in,
+                     bool use_strides);
+
     void CheckArgsAndInit(bool use_strides);
 
-    std::vector<std::size_t> lens;
-    std::vector<std::size_t> strides;
+    TensorDims lens;
+    TensorDims strides;
 
     bool packed;
     std::size_t vector_length = 1;
@@ -303,11 +324,11 @@ private:
     mutable std::optional<miopenTensorLayout_t> cached_layout_enum;
     mutable bool cached_layout_enum_calculated = false;
 
-    // For GetLayout_str()
-    mutable std::string cached_layout_str;
+    // For GetLayout_str(). Kept as characters to leave the descriptor trivially copyable.
+    mutable InlineVector<char, tensor_max_dims + 8> cached_layout_str;
 
     // For GetLayout
-    mutable std::vector<int64_t> cached_permutation;
+    mutable InlineVector<int64_t, tensor_max_dims> cached_permutation;
 
     // For AllLengthsFitIntoInt()
     mutable std::optional<bool> cached_lengths_fit_into_int;
@@ -315,9 +336,11 @@ private:
     mutable std::optional<bool> cached_strides_fit_into_int;
 };
 
-template <class TElement>
-constexpr auto GetNCDHW(unsigned spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr auto GetNCDHW(unsigned spatial_dims, const TData& data)
 {
+    using TElement = typename TData::value_type;
+
     if(spatial_dims == 3)
         return miopen::tien<5>(data, 1);
     else
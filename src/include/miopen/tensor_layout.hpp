@@ -29,18 +29,23 @@
 #include <miopen/errors.hpp>
 #include <map>
 #include <algorithm>
+#include <cstdint>
+#include <ostream>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <iterator>
+#include <numeric>
 
 namespace miopen {
 
-template <typename T>
-void tensor_layout_to_strides(const std::vector<T>& len,
+template <typename TLens, typename TStrides>
+void tensor_layout_to_strides(const TLens& len,
                               const std::string& len_layout,
                               const std::string& layout,
-                              std::vector<T>& strides)
+                              TStrides& strides)
 {
+    using T = typename TStrides::value_type;
     // Bind the layout and the dimension lengths together into a map.
     std::map<char, T> dim_to_len;
     std::transform(len.begin(),
@@ -72,13 +77,14 @@ void tensor_layout_to_strides(const std::vector<T>& len,
 /// \brief Version for vectorized layouts.
 ///
 /// \todo Generalize with non-vectorized version, 90% of code is the same.
-template <typename T>
-void tensor_layout_to_strides(const std::vector<T>& len,
+template <typename TLens, typename TStrides>
+void tensor_layout_to_strides(const TLens& len,
                               const std::string& len_layout,
                               const std::string& layout,
                               const std::size_t vector_size,
-                              std::vector<T>& strides)
+                              TStrides& strides)
 {
+    using T = typename TStrides::value_type;
     const std::string base_layout = layout.substr(0, len.size());
     // Bind the layout and the dimension lengths together into a map.
     std::map<char, T> dim_to_len;
@@ -117,6 +123,128 @@ inline std::string tensor_layout_get_default(unsigned size)
     return "";
 }
 
+/// Layout string of a 4D/5D tensor ("NCHW", "NDHWC", "CHWNc", ...) packed into an integer,
+/// so that problem descriptions can store and compare layouts without touching strings.
+/// Each dimension letter takes 3 bits and the vectorized suffix 'c' takes one more bit.
+/// The zero code is "UNKNOWN", which is what descriptors of other ranks report.
+class TensorLayoutCode
+{
+public:
+    constexpr TensorLayoutCode() = default;
+
+    constexpr explicit TensorLayoutCode(std::string_view layout)
+    {
+        if(layout == unknown_name)
+            return;
+
+        if(!layout.empty() && layout.back() == vector_suffix)
+        {
+            code = vector_bit;
+            layout.remove_suffix(1);
+        }
+
+        if(layout.empty() || layout.size() > max_dims)
+            MIOPEN_THROW(miopenStatusInternalError, "Unsupported tensor layout");
+
+        for(std::size_t i = 0; i < layout.size(); ++i)
+            SetDim(i, layout[i]);
+    }
+
+    /// Layout whose i-th dimension is storage_layout[permutation[i]], e.g. NHWC for the NCHW
+    /// storage layout and the {0, 2, 3, 1} permutation.
+    template <class Permutation>
+    static TensorLayoutCode FromPermutation(std::string_view storage_layout,
+                                            const Permutation& permutation,
+                                            bool vectorized)
+    {
+        if(permutation.size() == 0 || permutation.size() > max_dims)
+            MIOPEN_THROW(miopenStatusInternalError, "Unsupported tensor layout");
+
+        TensorLayoutCode layout;
+        for(std::size_t i = 0; i < permutation.size(); ++i)
+            layout.SetDim(i, storage_layout.at(permutation[i]));
+        if(vectorized)
+            layout.code |= vector_bit;
+        return layout;
+    }
+
+    constexpr bool IsUnknown() const { return code == 0; }
+    constexpr bool IsVectorized() const { return (code & vector_bit) != 0; }
+
+    constexpr std::size_t GetNumDims() const
+    {
+        std::size_t n = 0;
+        while(n < max_dims && GetDimIndex(n) != 0)
+            ++n;
+        return n;
+    }
+
+    std::string ToString() const
+    {
+        if(IsUnknown())
+            return std::string{unknown_name};
+
+        std::string ret;
+        for(std::size_t i = 0; i < GetNumDims(); ++i)
+            ret += dim_names[GetDimIndex(i) - 1];
+        if(IsVectorized())
+            ret += vector_suffix;
+        return ret;
+    }
+
+    friend constexpr bool operator==(TensorLayoutCode l, TensorLayoutCode r)
+    {
+        return l.code == r.code;
+    }
+    friend constexpr bool operator!=(TensorLayoutCode l, TensorLayoutCode r) { return !(l == r); }
+
+    friend std::ostream& operator<<(std::ostream& stream, TensorLayoutCode layout)
+    {
+        if(layout.IsUnknown())
+            return stream << unknown_name;
+        for(std::size_t i = 0; i < layout.GetNumDims(); ++i)
+            stream << dim_names[layout.GetDimIndex(i) - 1];
+        if(layout.IsVectorized())
+            stream << vector_suffix;
+        return stream;
+    }
+
+private:
+    static constexpr std::string_view dim_names    = "NCDHW";
+    static constexpr std::string_view unknown_name = "UNKNOWN";
+    static constexpr char vector_suffix            = 'c';
+    static constexpr std::size_t max_dims          = 5;
+    static constexpr std::size_t bits_per_dim      = 3;
+    static constexpr std::uint16_t vector_bit      = 1u << (max_dims * bits_per_dim);
+
+    constexpr unsigned GetDimIndex(std::size_t i) const
+    {
+        return (code >> (i * bits_per_dim)) & ((1u << bits_per_dim) - 1);
+    }
+
+    constexpr void SetDim(std::size_t i, char name)
+    {
+        const auto dim = dim_names.find(name);
+        if(dim == std::string_view::npos)
+            MIOPEN_THROW(miopenStatusInternalError, "Unsupported tensor layout");
+        code |= static_cast<std::uint16_t>((dim + 1) << (i * bits_per_dim));
+    }
+
+    std::uint16_t code = 0;
+};
+
+namespace tensor_layout {
+
+inline constexpr TensorLayoutCode NCHW{"NCHW"};
+inline constexpr TensorLayoutCode NHWC{"NHWC"};
+inline constexpr TensorLayoutCode CHWN{"CHWN"};
+inline constexpr TensorLayoutCode NCDHW{"NCDHW"};
+inline constexpr TensorLayoutCode NDHWC{"NDHWC"};
+inline constexpr TensorLayoutCode NCHWc{"NCHWc"};
+inline constexpr TensorLayoutCode CHWNc{"CHWNc"};
+
+} // namespace tensor_layout
+
 } // namespace miopen
 
 #endif
@@ -0,0 +1,218 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_TRACE_HPP_
+#define GUARD_MIOPEN_TRACE_HPP_
+
+#include <miopen/config.h>
+#include <miopen/config.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace miopen {
+namespace trace {
+
+/// Trace levels. Levels above MIOPEN_TRACE_MAX_LEVEL are removed at compile time,
+/// the others are recorded when tracing is enabled at run time.
+enum class Level : int
+{
+    Off    = 0,
+    Coarse = 1, ///< Compilation, kernel launches.
+    Detail = 2, ///< Solver applicability, database lookups.
+};
+
+/// Static format ids of the recorded events.
+enum class Event : std::uint16_t
+{
+    SolverConsidered,
+    SolverNotApplicable,
+    FindDbHit,
+    FindDbMiss,
+    PerfDbHit,
+    PerfDbMiss,
+    Compile,
+    KernelLaunch,
+};
+
+enum class Phase : char
+{
+    Begin   = 'B',
+    End     = 'E',
+    Instant = 'i',
+};
+
+/// A single event. `name` must outlive the trace, use Intern() for strings
+/// which are not static.
+struct Record
+{
+    std::uint64_t timestamp; ///< Nanoseconds of the steady clock.
+    const char* name;
+    std::uint64_t arg;
+    Event event;
+    Phase phase;
+};
+
+struct ThreadRecord
+{
+    std::uint64_t tid;
+    Record record;
+};
+
+/// Single-producer single-consumer ring buffer. The producer never blocks:
+/// TryPush() fails when the buffer is full.
+template <class T, std::size_t Capacity>
+class RingBuffer
+{
+    static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0,
+                  "Capacity must be a power of two");
+
+public:
+    bool TryPush(const T& item)
+    {
+        const auto head = this->head.load(std::memory_order_relaxed);
+        if(head - tail.load(std::memory_order_acquire) == Capacity)
+            return false;
+        items[head & (Capacity - 1)] = item;
+        this->head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(T& item)
+    {
+        const auto tail = this->tail.load(std::memory_order_relaxed);
+        if(tail == head.load(std::memory_order_acquire))
+            return false;
+        item = items[tail & (Capacity - 1)];
+        this->tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t Size() const
+    {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+private:
+    alignas(64) std::atomic<std::size_t> head{0};
+    alignas(64) std::atomic<std::size_t> tail{0};
+    std::array<T, Capacity> items{};
+};
+
+/// True when MIOPEN_TRACE_FILE is set or tracing was enabled with Enable().
+MIOPEN_INTERNALS_EXPORT bool IsEnabled();
+MIOPEN_INTERNALS_EXPORT void Enable(bool enable);
+
+/// Appends the event to the ring buffer of the calling thread. Events are dropped
+/// (and counted) when the buffer is full.
+MIOPEN_INTERNALS_EXPORT void Emit(Event event, Phase phase, const char* name, std::uint64_t arg);
+
+/// Returns a copy of `str` which lives until the end of the process.
+MIOPEN_INTERNALS_EXPORT const char* Intern(std::string_view str);
+
+MIOPEN_INTERNALS_EXPORT const char* GetEventName(Event event);
+
+/// Moves the events recorded so far by all threads into `records`.
+/// Returns the number of events dropped since the previous call.
+MIOPEN_INTERNALS_EXPORT std::uint64_t Drain(std::vector<ThreadRecord>& records);
+
+/// Number of per-thread buffers still registered. Buffers of exited threads are released
+/// on exit when empty, otherwise by the Drain() that empties them.
+MIOPEN_INTERNALS_EXPORT std::size_t GetNumThreadBuffers();
+
+/// Writes the events as elements of a Chrome trace (and Perfetto) JSON array.
+/// `first` tells whether the array has no elements written yet.
+MIOPEN_INTERNALS_EXPORT void
+WriteChromeTrace(std::ostream& os, const std::vector<ThreadRecord>& records, bool first = true);
+
+class Scope
+{
+public:
+    /// `get_name` is only called when tracing is enabled.
+    template <class F>
+    Scope(Event event_, F get_name, std::uint64_t arg_ = 0)
+        : event(event_), arg(arg_), active(IsEnabled())
+    {
+        if(!active)
+            return;
+        name = get_name();
+        Emit(event, Phase::Begin, name, arg);
+    }
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    ~Scope()
+    {
+        if(active)
+            Emit(event, Phase::End, name, arg);
+    }
+
+private:
+    Event event;
+    const char* name = nullptr;
+    std::uint64_t arg;
+    bool active;
+};
+
+struct NullScope
+{
+    template <class... Ts>
+    NullScope(Ts&&...)
+    {
+    }
+};
+
+template <Level level>
+using ScopeAt = std::conditional_t<(static_cast<int>(level) <= MIOPEN_TRACE_MAX_LEVEL), Scope,
+                                   NullScope>;
+
+} // namespace trace
+} // namespace miopen
+
+#define MIOPEN_TRACE_EVENT(level, event, name, arg)                                          \
+    do                                                                                       \
+    {                                                                                        \
+        if constexpr(static_cast<int>(miopen::trace::Level::level) <= MIOPEN_TRACE_MAX_LEVEL) \
+        {                                                                                    \
+            if(miopen::trace::IsEnabled())                                                   \
+                miopen::trace::Emit(miopen::trace::Event::event,                             \
+                                    miopen::trace::Phase::Instant,                           \
+                                    (name),                                                  \
+                                    (arg));                                                  \
+        }                                                                                    \
+    } while(false)
+
+#define MIOPEN_TRACE_SCOPE(level, event, name, arg)                   \
+    const miopen::trace::ScopeAt<miopen::trace::Level::level>       \
+        miopen_trace_scope(miopen::trace::Event::event,              \
+                           [&]() -> const char* { return (name); }, \
+                           (arg))
+
+#endif // GUARD_MIOPEN_TRACE_HPP_
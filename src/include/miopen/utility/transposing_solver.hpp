@@ -34,7 +34,7 @@ namespace miopen {
 namespace solver {
 
 template <class Element = std::size_t>
-inline static std::array<Element, 5> GetNCDHW(const std::vector<std::size_t>& values)
+inline static std::array<Element, 5> GetNCDHW(const TensorDims& values)
 {
     const auto cast = [](auto v) { return static_cast<Element>(v); };
     std::size_t n = 1, c = 1, d = 1, h = 1, w = 1;
@@ -294,7 +294,9 @@ struct ProblemTensorTransposeDescriptor
         auto derived_strides = std::vector<size_t>{};
         tensor_layout_to_strides(
             in.GetLengths(), labels, SyncLayoutDims(labels.c_str(), to), derived_strides);
-        return {in.GetType(), in.GetLengths(), derived_strides};
+        return {in.GetType(),
+                in.GetLengths(),
+                TensorDims(derived_strides.begin(), derived_strides.end())};
     }
 };
 
@@ -439,7 +441,7 @@ struct TransposingSolver : Base
         for(auto transpose : Derived::GetTransposes())
         {
             decltype(auto) descriptor = (problem.*(transpose.cdescriptor))();
-            const auto layout         = descriptor.GetLayout_str();
+            const auto layout         = std::string{descriptor.GetLayout_str()};
             const auto to             = SyncLayoutDims(layout.c_str(), transpose.to);
 
             auto specific_pair = layout + "-";
@@ -485,7 +487,7 @@ struct TransposingSolver : Base
         for(auto transpose : Derived::GetTransposes())
         {
             const auto& descriptor = (problem.*(transpose.cdescriptor))();
-            const auto layout      = descriptor.GetLayout_str();
+            const auto layout      = std::string{descriptor.GetLayout_str()};
             const auto to          = SyncLayoutDims(layout.c_str(), transpose.to);
 
             if(layout == to)
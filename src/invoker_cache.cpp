@@ -25,7 +25,9 @@
  *******************************************************************************/
 
 #include <miopen/invoker_cache.hpp>
+#include <miopen/invoker_profiler.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/stats.hpp>
 
 namespace miopen {
 
@@ -33,12 +35,19 @@ std::optional<Invoker> InvokerCache::operator[](const Key& key) const
 {
     const auto item = invokers.find(key.first);
     if(item == invokers.end())
+    {
+        stats::Increment(stats::Counter::InvokerCacheMiss);
         return std::nullopt;
+    }
     const auto& item_invokers = item->second.invokers;
     const auto invoker        = item_invokers.find(key.second);
     if(invoker == item_invokers.end())
+    {
+        stats::Increment(stats::Counter::InvokerCacheMiss);
         return std::nullopt;
-    return invoker->second;
+    }
+    stats::Increment(stats::Counter::InvokerCacheHit);
+    return invoker_profiler::Wrap(invoker->second, key.second);
 }
 
 std::optional<Invoker> InvokerCache::GetFound1_0(const std::string& network_config,
@@ -48,12 +57,14 @@ std::optional<Invoker> InvokerCache::GetFound1_0(const std::string& network_conf
     if(item == invokers.end())
     {
         MIOPEN_LOG_I2("No invokers found for " << network_config);
+        stats::Increment(stats::Counter::InvokerCacheMiss);
         return std::nullopt;
     }
     if(item->second.found_1_0.empty())
     {
         MIOPEN_LOG_I2("Invokers found for " << network_config
                                             << " but there is no find 1.0 result.");
+        stats::Increment(stats::Counter::InvokerCacheMiss);
         return std::nullopt;
     }
     const auto& item_invokers = item->second.invokers;
@@ -63,6 +74,7 @@ std::optional<Invoker> InvokerCache::GetFound1_0(const std::string& network_conf
     {
         MIOPEN_LOG_I2("Invokers found for "
                       << network_config << " but there is no one with an algorithm " << algorithm);
+        stats::Increment(stats::Counter::InvokerCacheMiss);
         return std::nullopt;
     }
     const auto invoker = item_invokers.find(found_1_0_id->second);
@@ -71,7 +83,8 @@ std::optional<Invoker> InvokerCache::GetFound1_0(const std::string& network_conf
         MIOPEN_THROW("No invoker with solver_id of " + found_1_0_id->second +
                      " was registered for " + network_config);
     }
-    return invoker->second;
+    stats::Increment(stats::Counter::InvokerCacheHit);
+    return invoker_profiler::Wrap(invoker->second, found_1_0_id->second);
 }
 
 std::optional<std::string> InvokerCache::GetFound1_0SolverId(const std::string& network_config,
@@ -0,0 +1,214 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/invoker_profiler.hpp>
+
+#include <miopen/env.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+
+/// Measures the host time of invoker calls per solver and prints it to stderr at exit.
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_INVOKER_PROFILE)
+
+namespace miopen {
+namespace invoker_profiler {
+
+namespace {
+
+constexpr auto phase_count = static_cast<std::size_t>(Phase::Count);
+
+struct Call
+{
+    std::array<std::uint64_t, phase_count> phases{};
+    std::uint64_t launches = 0;
+    std::uint64_t nested   = 0;
+};
+
+thread_local Call* current_call = nullptr; // NOLINT (cppcoreguidelines-avoid-non-const-global-variables)
+
+struct Registry
+{
+    std::mutex mutex;
+    std::unordered_map<std::string, SolverProfile> profiles;
+};
+
+// Never destroyed: invokers may still run while the process exits.
+Registry& GetRegistry()
+{
+    static auto* const registry = new Registry{};
+    return *registry;
+}
+
+std::atomic<bool>& EnabledFlag()
+{
+    static std::atomic<bool> enabled{env::enabled(MIOPEN_INVOKER_PROFILE)};
+    return enabled;
+}
+
+void Record(const std::string& solver, const Call& call, std::uint64_t total)
+{
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto& profile = registry.profiles[solver];
+    profile.calls += 1;
+    profile.launches += call.launches;
+    profile.total += total;
+    profile.lookup += call.phases[static_cast<std::size_t>(Phase::Lookup)];
+    profile.launch += call.phases[static_cast<std::size_t>(Phase::Launch)];
+    profile.wait += call.phases[static_cast<std::size_t>(Phase::Wait)];
+    profile.nested += call.nested;
+}
+
+/// Makes `call` the current one for the lifetime of the object, also when the invoker throws.
+class CallScope
+{
+public:
+    explicit CallScope(Call& call) : parent(current_call) { current_call = &call; }
+    CallScope(const CallScope&) = delete;
+    CallScope& operator=(const CallScope&) = delete;
+    ~CallScope() { current_call = parent; }
+
+private:
+    Call* const parent;
+};
+
+struct DumpAtExit
+{
+    DumpAtExit() : enabled(IsEnabled()) {}
+    DumpAtExit(const DumpAtExit&) = delete;
+    DumpAtExit& operator=(const DumpAtExit&) = delete;
+    ~DumpAtExit()
+    {
+        if(enabled)
+            Print(std::cerr, Collect());
+    }
+
+    bool enabled;
+};
+
+const DumpAtExit dump_at_exit;
+
+} // namespace
+
+bool IsEnabled() { return EnabledFlag().load(std::memory_order_relaxed); }
+
+void Enable(bool enable) { EnabledFlag().store(enable, std::memory_order_relaxed); }
+
+Invoker Wrap(const Invoker& invoker, const std::string& solver)
+{
+    if(!IsEnabled())
+        return invoker;
+
+    return [invoker, solver](const Handle& handle, const AnyInvokeParams& params) {
+        auto call          = Call{};
+        auto* const parent = current_call;
+        const auto start   = std::chrono::steady_clock::now();
+        {
+            const CallScope scope{call};
+            invoker(handle, params);
+        }
+        const auto total = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                 start)
+                .count());
+
+        if(parent != nullptr)
+            parent->nested += total;
+        Record(solver, call, total);
+    };
+}
+
+void AddTime(Phase phase, std::uint64_t ns)
+{
+    if(current_call == nullptr)
+        return;
+    current_call->phases[static_cast<std::size_t>(phase)] += ns;
+    if(phase == Phase::Launch)
+        ++current_call->launches;
+}
+
+bool IsInsideInvoker() { return current_call != nullptr; }
+
+std::vector<SolverProfile> Collect()
+{
+    auto result    = std::vector<SolverProfile>{};
+    auto& registry = GetRegistry();
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        result.reserve(registry.profiles.size());
+        for(const auto& item : registry.profiles)
+        {
+            result.push_back(item.second);
+            result.back().solver = item.first;
+        }
+    }
+    std::sort(result.begin(), result.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.total - lhs.nested > rhs.total - rhs.nested;
+    });
+    return result;
+}
+
+void Reset()
+{
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.profiles.clear();
+}
+
+void Print(std::ostream& os, const std::vector<SolverProfile>& profiles)
+{
+    const auto flags = os.flags();
+    const auto per_call_us = [](std::uint64_t ns, std::uint64_t calls) {
+        return static_cast<double>(ns) * 1e-3 / static_cast<double>(calls);
+    };
+
+    os << "MIOpen invoker host time per call, us:" << std::endl;
+    os << std::left << std::setw(48) << "  solver" << std::right << std::setw(10) << "calls"
+       << std::setw(10) << "kernels" << std::setw(10) << "total" << std::setw(10) << "marshal"
+       << std::setw(10) << "lookup" << std::setw(10) << "launch" << std::setw(10) << "wait"
+       << std::endl;
+    os << std::fixed << std::setprecision(2);
+    for(const auto& p : profiles)
+    {
+        if(p.calls == 0)
+            continue;
+        os << "  " << std::left << std::setw(46) << p.solver << std::right << std::setw(10)
+           << p.calls << std::setw(10) << p.launches << std::setw(10)
+           << per_call_us(p.total - p.nested, p.calls) << std::setw(10)
+           << per_call_us(p.Marshalling(), p.calls) << std::setw(10)
+           << per_call_us(p.lookup, p.calls) << std::setw(10) << per_call_us(p.launch, p.calls)
+           << std::setw(10) << per_call_us(p.wait, p.calls) << std::endl;
+    }
+    os.flags(flags);
+}
+
+} // namespace invoker_profiler
+} // namespace miopen
@@ -0,0 +1,185 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/kernel.hpp>
+
+#include <miopen/env.hpp>
+#include <miopen/logger.hpp>
+
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
+/// Hands the HIP compilers only the headers a kernel includes instead of all of them.
+/// Enabled by default.
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_KERNEL_INCLUDE_CLOSURE)
+
+namespace miopen {
+
+namespace {
+
+using HeaderRef = std::reference_wrapper<const fs::path>;
+
+bool IsBlank(char c) { return c == ' ' || c == '\t'; }
+
+/// Appends the names of the files included by `text`. Returns false if some include names a
+/// macro, which can't be resolved without preprocessing. Includes in comments and disabled
+/// conditional blocks are also collected, which only adds unused headers.
+bool ScanIncludes(std::string_view text, std::vector<std::string_view>& names)
+{
+    constexpr std::string_view directive = "include";
+
+    while(!text.empty())
+    {
+        const auto line_end = text.find('\n');
+        auto line           = text.substr(0, line_end);
+        text.remove_prefix(line_end == std::string_view::npos ? text.size() : line_end + 1);
+
+        const auto skip_blanks = [&]() {
+            while(!line.empty() && IsBlank(line.front()))
+                line.remove_prefix(1);
+        };
+
+        skip_blanks();
+        if(line.empty() || line.front() != '#')
+            continue;
+        line.remove_prefix(1);
+        skip_blanks();
+        if(line.substr(0, directive.size()) != directive)
+            continue;
+        line.remove_prefix(directive.size());
+        skip_blanks();
+
+        // Anything else than a quoted name is a macro, or #include_next.
+        if(line.empty() || (line.front() != '"' && line.front() != '<'))
+            return false;
+        const auto close    = line.front() == '"' ? '"' : '>';
+        const auto name_end = line.find(close, 1);
+        if(name_end == std::string_view::npos)
+            return false;
+        names.push_back(line.substr(1, name_end - 1));
+    }
+    return true;
+}
+
+/// Headers from GetKernelIncList() indexed by file name, with their direct includes scanned once
+/// per process.
+class IncludeGraph
+{
+public:
+    IncludeGraph()
+    {
+        for(const auto& header : GetKernelIncList())
+            headers.emplace(header.get().filename().string(), &header.get());
+    }
+
+    const fs::path* Find(std::string_view name) const
+    {
+        const auto it = headers.find(fs::path{name}.filename().string());
+        return it == headers.end() ? nullptr : it->second;
+    }
+
+    /// Direct includes of `header` which are embedded headers, or nothing when they can't be
+    /// determined.
+    const std::optional<std::vector<const fs::path*>>& Includes(const fs::path* header)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = includes.find(header);
+        if(it == includes.end())
+            it = includes.emplace(header, Resolve(GetKernelInc(*header))).first;
+        return it->second;
+    }
+
+    std::optional<std::vector<const fs::path*>> Resolve(std::string_view text) const
+    {
+        auto names = std::vector<std::string_view>{};
+        if(!ScanIncludes(text, names))
+            return std::nullopt;
+
+        auto result = std::vector<const fs::path*>{};
+        for(const auto& name : names)
+        {
+            // Not an embedded header: a system or a HIP runtime one.
+            if(const auto* header = Find(name))
+                result.push_back(header);
+        }
+        return result;
+    }
+
+private:
+    std::unordered_map<std::string, const fs::path*> headers;
+    std::mutex mutex;
+    // Entries are never erased, so references to them stay valid.
+    std::unordered_map<const fs::path*, std::optional<std::vector<const fs::path*>>> includes;
+};
+
+IncludeGraph& GetIncludeGraph()
+{
+    static IncludeGraph graph;
+    return graph;
+}
+
+std::vector<HeaderRef> AllHeaders()
+{
+    const auto& all = GetKernelIncList();
+    return {all.begin(), all.end()};
+}
+
+} // namespace
+
+std::vector<HeaderRef> GetKernelIncClosure(std::string_view src)
+{
+    if(env::disabled(MIOPEN_DEBUG_KERNEL_INCLUDE_CLOSURE))
+        return AllHeaders();
+
+    auto& graph = GetIncludeGraph();
+    auto queue  = graph.Resolve(src);
+    if(!queue)
+        return AllHeaders();
+
+    auto result  = std::vector<HeaderRef>{};
+    auto visited = std::unordered_set<const fs::path*>{};
+    while(!queue->empty())
+    {
+        const auto* header = queue->back();
+        queue->pop_back();
+        if(!visited.insert(header).second)
+            continue;
+        result.emplace_back(*header);
+
+        const auto& includes = graph.Includes(header);
+        if(!includes)
+        {
+            MIOPEN_LOG_I2("Including all kernel headers: " << *header
+                                                          << " includes a header by a macro");
+            return AllHeaders();
+        }
+        queue->insert(queue->end(), includes->begin(), includes->end());
+    }
+    return result;
+}
+
+} // namespace miopen
@@ -0,0 +1,221 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef MIOPEN_DONT_USE_HIP_RUNTIME_HEADERS
+#include <hip/hip_runtime.h>
+#endif
+
+#include "pointwise_chain_args.hpp"
+
+// The kernel is specialized for one chain of pointwise ops by PointwiseProgram::getBuildParams:
+//   PW_NUM_INPUTS, PW_NUM_OUTPUTS, PW_NUM_OPS and PW_NUM_REGS give the sizes of the program,
+//   PW_OP<i>_MODE, PW_OP<i>_SRC0 and PW_OP<i>_SRC1 describe the instruction i,
+//   PW_OUT<j>_REG is the register stored to the output j.
+// Registers [0, PW_NUM_INPUTS) are loaded from the inputs, instruction i writes register
+// PW_NUM_INPUTS + i. Alphas and mode parameters are kernel arguments, so that chains which only
+// differ in them share the binary.
+
+#define PW_MODE_ADD 0
+#define PW_MODE_ADD_SQUARE 1
+#define PW_MODE_DIV 2
+#define PW_MODE_MAX 3
+#define PW_MODE_MIN 4
+#define PW_MODE_MOD 5
+#define PW_MODE_MUL 6
+#define PW_MODE_POW 7
+#define PW_MODE_SUB 8
+#define PW_MODE_ABS 9
+#define PW_MODE_CEIL 10
+#define PW_MODE_COS 11
+#define PW_MODE_EXP 12
+#define PW_MODE_FLOOR 13
+#define PW_MODE_LOG 14
+#define PW_MODE_NEG 15
+#define PW_MODE_RSQRT 16
+#define PW_MODE_SIN 17
+#define PW_MODE_SQRT 18
+#define PW_MODE_TAN 19
+#define PW_MODE_IDENTITY 20
+#define PW_MODE_RELU_FWD 21
+#define PW_MODE_TANH_FWD 22
+#define PW_MODE_SIGMOID_FWD 23
+#define PW_MODE_ELU_FWD 24
+#define PW_MODE_GELU_FWD 25
+#define PW_MODE_SOFTPLUS_FWD 26
+#define PW_MODE_SWISH_FWD 27
+#define PW_MODE_GELU_APPROX_TANH_FWD 28
+#define PW_MODE_RECIPROCAL 29
+
+template <int Mode>
+__device__ float pw_apply(float x, float b, const float* c)
+{
+    x *= c[0];
+    b *= c[1];
+
+    if constexpr(Mode == PW_MODE_ADD)
+        return x + b;
+    else if constexpr(Mode == PW_MODE_ADD_SQUARE)
+        return x + b * b;
+    else if constexpr(Mode == PW_MODE_DIV)
+        return x / b;
+    else if constexpr(Mode == PW_MODE_MAX)
+        return fmaxf(x, b);
+    else if constexpr(Mode == PW_MODE_MIN)
+        return fminf(x, b);
+    else if constexpr(Mode == PW_MODE_MOD)
+        return fmodf(x, b);
+    else if constexpr(Mode == PW_MODE_MUL)
+        return x * b;
+    else if constexpr(Mode == PW_MODE_POW)
+        return powf(x, b);
+    else if constexpr(Mode == PW_MODE_SUB)
+        return x - b;
+    else if constexpr(Mode == PW_MODE_ABS)
+        return fabsf(x);
+    else if constexpr(Mode == PW_MODE_CEIL)
+        return ceilf(x);
+    else if constexpr(Mode == PW_MODE_COS)
+        return cosf(x);
+    else if constexpr(Mode == PW_MODE_EXP)
+        return expf(x);
+    else if constexpr(Mode == PW_MODE_FLOOR)
+        return floorf(x);
+    else if constexpr(Mode == PW_MODE_LOG)
+        return logf(x);
+    else if constexpr(Mode == PW_MODE_NEG)
+        return -x;
+    else if constexpr(Mode == PW_MODE_RSQRT)
+        return 1.0f / sqrtf(x);
+    else if constexpr(Mode == PW_MODE_SIN)
+        return sinf(x);
+    else if constexpr(Mode == PW_MODE_SQRT)
+        return sqrtf(x);
+    else if constexpr(Mode == PW_MODE_TAN)
+        return tanf(x);
+    else if constexpr(Mode == PW_MODE_RELU_FWD)
+        return x <= c[2] ? c[2] + c[4] * (x - c[2]) : fminf(x, c[3]);
+    else if constexpr(Mode == PW_MODE_TANH_FWD)
+        return tanhf(x);
+    else if constexpr(Mode == PW_MODE_SIGMOID_FWD)
+        return 1.0f / (1.0f + expf(-x));
+    else if constexpr(Mode == PW_MODE_ELU_FWD)
+        return x > 0.0f ? x : c[2] * (expf(x) - 1.0f);
+    else if constexpr(Mode == PW_MODE_GELU_FWD)
+        return 0.5f * x * (1.0f + erff(x * 0.70710678f));
+    else if constexpr(Mode == PW_MODE_SOFTPLUS_FWD)
+        return log1pf(expf(c[2] * x)) / c[2];
+    else if constexpr(Mode == PW_MODE_SWISH_FWD)
+        return x / (1.0f + expf(-c[2] * x));
+    else if constexpr(Mode == PW_MODE_GELU_APPROX_TANH_FWD)
+        return 0.5f * x * (1.0f + tanhf(0.79788456f * (x + 0.044715f * x * x * x)));
+    else if constexpr(Mode == PW_MODE_RECIPROCAL)
+        return 1.0f / x;
+    else
+        return x;
+}
+
+#define PW_STEP(i)                                                                  \
+    r[PW_NUM_INPUTS + i] = pw_apply<PW_OP##i##_MODE>(                               \
+        r[PW_OP##i##_SRC0], r[PW_OP##i##_SRC1], args.constants + PW_CHAIN_NUM_CONSTANTS * i);
+
+#define PW_STORE(j) \
+    args.outputs[j][args.output_tv[j].get_tensor_view_idx(layout)] = r[PW_OUT##j##_REG];
+
+extern "C" __global__ void
+PointwiseChain(pointwise_chain_args_t args, tensor_view_t<5> chain_tv, uint64_t numel)
+{
+    for(uint64_t gid = blockIdx.x * blockDim.x + threadIdx.x; gid < numel;
+        gid += static_cast<uint64_t>(gridDim.x) * blockDim.x)
+    {
+        tensor_layout_t<5> layout(chain_tv, gid);
+        float r[PW_NUM_REGS];
+
+#pragma unroll
+        for(int i = 0; i < PW_NUM_INPUTS; ++i)
+            r[i] = args.inputs[i][args.input_tv[i].get_tensor_view_idx(layout)];
+
+#if PW_NUM_OPS > 0
+        PW_STEP(0)
+#endif
+#if PW_NUM_OPS > 1
+        PW_STEP(1)
+#endif
+#if PW_NUM_OPS > 2
+        PW_STEP(2)
+#endif
+#if PW_NUM_OPS > 3
+        PW_STEP(3)
+#endif
+#if PW_NUM_OPS > 4
+        PW_STEP(4)
+#endif
+#if PW_NUM_OPS > 5
+        PW_STEP(5)
+#endif
+#if PW_NUM_OPS > 6
+        PW_STEP(6)
+#endif
+#if PW_NUM_OPS > 7
+        PW_STEP(7)
+#endif
+#if PW_NUM_OPS > 8
+        PW_STEP(8)
+#endif
+#if PW_NUM_OPS > 9
+        PW_STEP(9)
+#endif
+#if PW_NUM_OPS > 10
+        PW_STEP(10)
+#endif
+#if PW_NUM_OPS > 11
+        PW_STEP(11)
+#endif
+#if PW_NUM_OPS > 12
+        PW_STEP(12)
+#endif
+#if PW_NUM_OPS > 13
+        PW_STEP(13)
+#endif
+#if PW_NUM_OPS > 14
+        PW_STEP(14)
+#endif
+#if PW_NUM_OPS > 15
+        PW_STEP(15)
+#endif
+
+#if PW_NUM_OUTPUTS > 0
+        PW_STORE(0)
+#endif
+#if PW_NUM_OUTPUTS > 1
+        PW_STORE(1)
+#endif
+#if PW_NUM_OUTPUTS > 2
+        PW_STORE(2)
+#endif
+#if PW_NUM_OUTPUTS > 3
+        PW_STORE(3)
+#endif
+    }
+}
@@ -0,0 +1,47 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_POINTWISE_CHAIN_ARGS_HPP
+#define GUARD_POINTWISE_CHAIN_ARGS_HPP
+
+#include "tensor_view.hpp"
+
+#define PW_CHAIN_MAX_INPUTS 8
+#define PW_CHAIN_MAX_OUTPUTS 4
+#define PW_CHAIN_MAX_OPS 16
+#define PW_CHAIN_NUM_CONSTANTS 5
+
+// Arguments of MIOpenPointwiseChain.cpp, shared with the host to keep the layouts in sync.
+// Broadcast dimensions of the inputs have a zero stride.
+struct pointwise_chain_args_t
+{
+    const float* inputs[PW_CHAIN_MAX_INPUTS];
+    float* outputs[PW_CHAIN_MAX_OUTPUTS];
+    tensor_view_t<5> input_tv[PW_CHAIN_MAX_INPUTS];
+    tensor_view_t<5> output_tv[PW_CHAIN_MAX_OUTPUTS];
+    float constants[PW_CHAIN_MAX_OPS * PW_CHAIN_NUM_CONSTANTS];
+};
+
+#endif // GUARD_POINTWISE_CHAIN_ARGS_HPP
@@ -28,7 +28,7 @@
 #include <miopen/handle.hpp>
 #include <miopen/tensor_ops.hpp>
 
-inline std::ostream& operator<<(std::ostream& os, const std::vector<size_t>& v)
+inline std::ostream& operator<<(std::ostream& os, const miopen::TensorDims& v)
 {
     os << '{';
     for(int i = 0; i < v.size(); ++i)
@@ -83,7 +83,10 @@ static auto GetDirectSolvers()
                                            miopen::solver::conv::ConvOclDirectFwd,
                                            miopen::solver::conv::ConvDirectNaiveConvFwd,
                                            miopen::solver::conv::ConvDirectNaiveConvBwd,
-                                           miopen::solver::conv::ConvDirectNaiveConvWrw>{};
+                                           miopen::solver::conv::ConvDirectNaiveConvWrw,
+                                           miopen::solver::conv::ConvHostReferenceFwd,
+                                           miopen::solver::conv::ConvHostReferenceBwd,
+                                           miopen::solver::conv::ConvHostReferenceWrw>{};
 }
 
 static auto GetImplicitGemmSolvers()
@@ -196,7 +199,10 @@ static auto GetBwdWrW2DSolvers()
                                            miopen::solver::conv::ConvOclBwdWrW1x1,
                                            miopen::solver::conv::ConvDirectNaiveConvFwd,
                                            miopen::solver::conv::ConvDirectNaiveConvBwd,
-                                           miopen::solver::conv::ConvDirectNaiveConvWrw>{};
+                                           miopen::solver::conv::ConvDirectNaiveConvWrw,
+                                           miopen::solver::conv::ConvHostReferenceFwd,
+                                           miopen::solver::conv::ConvHostReferenceBwd,
+                                           miopen::solver::conv::ConvHostReferenceWrw>{};
 }
 
 static auto GetFFTSolvers() { return miopen::solver::SolverContainer<miopen::solver::conv::fft>{}; }
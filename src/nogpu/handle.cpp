@@ -52,6 +52,8 @@
 #include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <cstring>
+#include <new>
 #include <thread>
 #include <miopen/nogpu/handle_impl.hpp>
 
@@ -61,10 +63,31 @@
 
 namespace miopen {
 
+namespace {
+
+/// Buffers live in host memory, so that host reference solvers and the memory transfer
+/// API operate on real data. Alignment matches what device allocations guarantee.
+constexpr std::size_t host_buffer_alignment = 256;
+
+void* default_allocator(void*, size_t sz)
+{
+    if(sz == 0)
+        return nullptr;
+    return ::operator new(sz, std::align_val_t{host_buffer_alignment}, std::nothrow);
+}
+
+void default_deallocator(void*, void* mem)
+{
+    ::operator delete(mem, std::align_val_t{host_buffer_alignment});
+}
+
+} // namespace
+
 Handle::Handle(miopenAcceleratorQueue_t /* stream */) : Handle::Handle() {}
 
 Handle::Handle() : impl(new HandleImpl())
 {
+    this->SetAllocator(nullptr, nullptr, nullptr);
     this->impl->target_properties.Init(this);
     MIOPEN_LOG_NQI(*this);
 }
@@ -78,10 +101,14 @@ void Handle::ReserveExtraStreamsInPool(int) const {}
 
 miopenAcceleratorQueue_t Handle::GetStream() const { return {}; }
 
-void Handle::SetAllocator(miopenAllocatorFunction /* allocator */,
-                          miopenDeallocatorFunction /* deallocator */,
-                          void* /* allocatorContext */) const
+void Handle::SetAllocator(miopenAllocatorFunction allocator,
+                          miopenDeallocatorFunction deallocator,
+                          void* allocatorContext) const
 {
+    this->impl->allocator.allocator   = allocator == nullptr ? default_allocator : allocator;
+    this->impl->allocator.deallocator = deallocator == nullptr ? default_deallocator : deallocator;
+
+    this->impl->allocator.context = allocatorContext;
 }
 
 void Handle::EnableProfiling(bool enable) const { this->impl->enable_profiling = enable; }
@@ -91,20 +118,29 @@ float Handle::GetKernelTime() const { return this->impl->profiling_result; }
 Allocator::ManageDataPtr Handle::Create(std::size_t sz) const { return this->impl->allocator(sz); }
 
 Allocator::ManageDataPtr&
-Handle::WriteTo(const void* /* data */, Allocator::ManageDataPtr& ddata, std::size_t /* sz */) const
+Handle::WriteTo(const void* data, Allocator::ManageDataPtr& ddata, std::size_t sz) const
 {
+    if(sz != 0)
+        std::memcpy(ddata.get(), data, sz);
     return ddata;
 }
 
-void Handle::ReadTo(void* /* data */,
-                    const Allocator::ManageDataPtr& /* ddata */,
-                    std::size_t /* sz */) const
+void Handle::ReadTo(void* data, const Allocator::ManageDataPtr& ddata, std::size_t sz) const
 {
+    this->ReadTo(data, ddata.get(), sz);
 }
 
-void Handle::ReadTo(void* /* data */, ConstData_t /* ddata */, std::size_t /* sz */) const {}
+void Handle::ReadTo(void* data, ConstData_t ddata, std::size_t sz) const
+{
+    if(sz != 0)
+        std::memcpy(data, ddata, sz);
+}
 
-void Handle::Copy(ConstData_t /* src */, Data_t /* dest */, std::size_t /* size */) const {}
+void Handle::Copy(ConstData_t src, Data_t dest, std::size_t size) const
+{
+    if(size != 0 && src != dest)
+        std::memmove(dest, src, size);
+}
 
 KernelInvoke Handle::AddKernel(const std::string& algorithm,
                                const std::string& network_config,
@@ -275,6 +311,7 @@ const TargetProperties& Handle::GetTargetProperties() const
 
 std::string Handle::GetDeviceNameImpl() const { return this->impl->device_name; }
 std::string Handle::GetDeviceName() const { return this->impl->target_properties.Name(); }
+int Handle::GetDeviceId() const { return this->impl->device; }
 
 std::ostream& Handle::Print(std::ostream& os) const
 {
@@ -44,11 +44,11 @@
 
 namespace miopen {
 
-template <typename T>
-inline void SquashPairedTensor(const std::vector<T> x_len,
-                               const std::vector<T> x_str,
-                               const std::vector<T> y_len,
-                               const std::vector<T> y_str,
+template <typename TDims, typename T>
+inline void SquashPairedTensor(const TDims& x_len,
+                               const TDims& x_str,
+                               const TDims& y_len,
+                               const TDims& y_str,
                                std::vector<T>& in_len,
                                std::vector<T>& in_str,
                                std::vector<T>& out_len,
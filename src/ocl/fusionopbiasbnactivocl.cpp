@@ -114,7 +114,7 @@ BatchNormInferenceFusionOpDescriptor::GetGlobalWGSz(const Handle& /*handle*/,
 /// END BN inference ------------------------------------------
 
 // BN Bwd Training start
-void BatchNormBwdTrainFusionOpDescriptor::calcBNParams(std::vector<size_t> in_lens,
+void BatchNormBwdTrainFusionOpDescriptor::calcBNParams(const TensorDims& in_lens,
                                                        int& variant,
                                                        size_t& in_cstride,
                                                        size_t& in_nstride,
@@ -246,7 +246,7 @@ std::vector<size_t> BatchNormBwdTrainFusionOpDescriptor::GetGlobalWGSz()
 
 /// BATCH NORMALIZATION training forward start ================
 
-void BatchNormFwdTrainFusionOpDescriptor::calcBNParams(std::vector<size_t> in_lens,
+void BatchNormFwdTrainFusionOpDescriptor::calcBNParams(const TensorDims& in_lens,
                                                        int& variant,
                                                        size_t& in_cstride,
                                                        size_t& in_nstride,
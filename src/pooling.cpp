@@ -243,7 +243,9 @@ std::size_t PoolingDescriptor::GetWorkSpaceSize(const TensorDescriptor& yDesc) c
         const auto in_layout    = yDesc.GetLayout(labels);
         tensor_layout_to_strides(yDesc.GetLengths(), labels, in_layout, transposed_strides);
         const auto transposed_y =
-            TensorDescriptor{yDesc.GetType(), yDesc.GetLengths(), transposed_strides};
+            TensorDescriptor{yDesc.GetType(),
+                             yDesc.GetLengths(),
+                             TensorDims(transposed_strides.begin(), transposed_strides.end())};
 
         const auto y_transpose_size = transposed_y.GetElementSpace() * e_size;
         // Todo: We do not have xDesc, so we infer that. But currently this is incorrect, x tensor
@@ -36,8 +36,8 @@ namespace pooling {
 
 namespace {
 
-template <typename T>
-std::string get_vect_config(const std::vector<T>& v)
+template <typename TData>
+std::string get_vect_config(const TData& v)
 {
     std::string str;
     for(auto itr = v.begin(); itr < v.end(); itr++)
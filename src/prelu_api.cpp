@@ -28,7 +28,7 @@
 #include <miopen/tensor_ops.hpp>
 #include <miopen/prelu.hpp>
 
-inline std::ostream& operator<<(std::ostream& os, const std::vector<size_t>& v)
+inline std::ostream& operator<<(std::ostream& os, const miopen::TensorDims& v)
 {
     os << '{';
     for(int i = 0; i < v.size(); ++i)
@@ -28,6 +28,7 @@
 #include <miopen/logger.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/filesystem.hpp>
+#include <miopen/startup.hpp>
 
 #if MIOPEN_EMBED_DB
 #include <miopen_data.hpp>
@@ -35,7 +36,7 @@
 
 #include <fstream>
 #include <mutex>
-#include <sstream>
+#include <string_view>
 #include <map>
 
 namespace miopen {
@@ -52,22 +53,33 @@ bool& rordb_embed_fs_override()
 ReadonlyRamDb&
 ReadonlyRamDb::GetCached(DbKinds db_kind_, const fs::path& path, bool warn_if_unreadable)
 {
-    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
-    static std::mutex mutex;
-    const std::lock_guard<std::mutex> lock{mutex};
+    struct Instance
+    {
+        Instance(DbKinds db_kind_, const fs::path& path_) : db(db_kind_, path_) {}
 
-    // We don't have to store kind to properly index as different dbs would have different paths
-    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
-    static auto instances = std::map<fs::path, std::unique_ptr<ReadonlyRamDb>>{};
-    const auto it         = instances.find(path);
+        ReadonlyRamDb db;
+        std::once_flag prefetched;
+    };
 
-    if(it != instances.end())
-        return *it->second;
+    Instance* instance;
+    {
+        // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+        static std::mutex mutex;
+        const std::lock_guard<std::mutex> lock{mutex};
+
+        // We don't have to store kind to properly index as different dbs would have different
+        // paths
+        // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+        static auto instances = std::map<fs::path, std::unique_ptr<Instance>>{};
+        auto& slot            = instances[path];
+        if(!slot)
+            slot = std::make_unique<Instance>(db_kind_, path);
+        instance = slot.get();
+    }
 
-    auto& instance =
-        *instances.emplace(path, std::make_unique<ReadonlyRamDb>(db_kind_, path)).first->second;
-    instance.Prefetch(warn_if_unreadable);
-    return instance;
+    // The map lock is not held while loading, so that different dbs are loaded concurrently.
+    std::call_once(instance->prefetched, [&]() { instance->db.Prefetch(warn_if_unreadable); });
+    return instance->db;
 }
 
 template <class TFunc>
@@ -83,28 +95,24 @@ static auto Measure(const std::string& funcName, TFunc&& func)
                                    << " ms");
 }
 
-void ReadonlyRamDb::ParseAndLoadDb(std::istream& input_stream, bool warn_if_unreadable)
+void ReadonlyRamDb::ParseAndLoadDb(std::string_view contents)
 {
-    if(!input_stream)
-    {
-        const auto log_level = (warn_if_unreadable && !MIOPEN_DISABLE_SYSDB) ? LoggingLevel::Warning
-                                                                             : LoggingLevel::Info;
-        MIOPEN_LOG(log_level, "File is unreadable: " << db_path);
-        return;
-    }
-
-    auto line   = std::string{};
     auto n_line = 0;
 
-    while(std::getline(input_stream, line))
+    while(!contents.empty())
     {
         ++n_line;
 
+        const auto line_size = contents.find('\n');
+        const auto line      = contents.substr(0, line_size);
+        contents.remove_prefix(line_size == std::string_view::npos ? contents.size()
+                                                                   : line_size + 1);
+
         if(line.empty())
             continue;
 
         const auto key_size = line.find('=');
-        const bool is_key   = (key_size != std::string::npos && key_size != 0);
+        const bool is_key   = (key_size != std::string_view::npos && key_size != 0);
 
         if(!is_key)
         {
@@ -112,10 +120,7 @@ void ReadonlyRamDb::ParseAndLoadDb(std::istream& input_stream, bool warn_if_unre
             continue;
         }
 
-        const auto key      = line.substr(0, key_size);
-        const auto contents = line.substr(key_size + 1);
-
-        cache.emplace(key, CacheItem{n_line, contents});
+        cache.emplace(line.substr(0, key_size), CacheItem{n_line, line.substr(key_size + 1)});
     }
 }
 
@@ -124,6 +129,7 @@ void ReadonlyRamDb::Prefetch(bool warn_if_unreadable)
     Measure("Prefetch", [this, warn_if_unreadable]() {
         if(db_path.empty())
             return;
+        const startup::ScopedStep step{startup::Step::DbPrefetch, db_path.string()};
         constexpr bool isEmbedded = MIOPEN_EMBED_DB;
         // cppcheck-suppress knownConditionTrueFalse
         if(!debug::rordb_embed_fs_override() && isEmbedded)
@@ -139,14 +145,27 @@ void ReadonlyRamDb::Prefetch(bool warn_if_unreadable)
             const auto& p = it_p->second;
             ptrdiff_t sz  = p.second - p.first;
             MIOPEN_LOG_I2("Loading In Memory file: " << filepath);
-            auto input_stream = std::stringstream(std::string(p.first, sz));
-            ParseAndLoadDb(input_stream, warn_if_unreadable);
+            // The image is in read-only memory for the lifetime of the process, so the cache
+            // points straight into it.
+            ParseAndLoadDb({p.first, static_cast<std::size_t>(sz)});
 #endif
         }
         else
         {
-            auto input_stream = std::ifstream{db_path};
-            ParseAndLoadDb(input_stream, warn_if_unreadable);
+            auto file = std::ifstream{db_path, std::ios::binary | std::ios::ate};
+            if(!file)
+            {
+                const auto log_level = (warn_if_unreadable && !MIOPEN_DISABLE_SYSDB)
+                                           ? LoggingLevel::Warning
+                                           : LoggingLevel::Info;
+                MIOPEN_LOG(log_level, "File is unreadable: " << db_path);
+                return;
+            }
+            file_contents.resize(static_cast<std::size_t>(file.tellg()));
+            file.seekg(0);
+            file.read(file_contents.data(), static_cast<std::streamsize>(file_contents.size()));
+            file_contents.resize(static_cast<std::size_t>(file.gcount()));
+            ParseAndLoadDb(file_contents);
         }
     });
 }
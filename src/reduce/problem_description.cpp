@@ -36,12 +36,10 @@ namespace reduce {
 NetworkConfig ProblemDescriptionExtreme::MakeNetworkConfig() const
 {
     auto xlength = xDesc.GetLengths();
-    std::vector<std::size_t> outputlength;
-    if((reduceExtremeOp == MIOPEN_REDUCE_EXTREME_MIN) ||
-       (reduceExtremeOp == MIOPEN_REDUCE_EXTREME_MAX))
-        outputlength = yDesc.GetLengths();
-    else
-        outputlength = indiceDesc.GetLengths();
+    const auto& outputlength = ((reduceExtremeOp == MIOPEN_REDUCE_EXTREME_MIN) ||
+                                (reduceExtremeOp == MIOPEN_REDUCE_EXTREME_MAX))
+                                   ? yDesc.GetLengths()
+                                   : indiceDesc.GetLengths();
 
     auto size         = xlength[dim];
     auto output_numel = std::accumulate(outputlength.begin(),
@@ -73,8 +71,7 @@ NetworkConfig ProblemDescriptionExtreme::MakeNetworkConfig() const
 NetworkConfig ProblemDescriptionCalculation::MakeNetworkConfig() const
 {
     auto xlength = xDesc.GetLengths();
-    std::vector<std::size_t> outputlength;
-    outputlength = yDesc.GetLengths();
+    const auto& outputlength = yDesc.GetLengths();
 
     auto size         = xlength[dim];
     auto output_numel = std::accumulate(outputlength.begin(),
@@ -213,12 +213,12 @@ void RNNTensorBaseLayoutConverter::ReorderHiddenTensorGPUData(const Handle& hand
                                                               ConstData_t src,
                                                               Data_t dst)
 {
-    const auto& lens = tensor_desc.GetLengths();
+    const std::vector<size_t> lens(tensor_desc.GetLengths());
     if(lens[reordering_dim] != sample_order.size())
         MIOPEN_THROW(miopenStatusInternalError, "Wrong tensor lens");
 
-    const std::vector<size_t> src_stride = tensor_desc.GetStrides();
-    const std::vector<size_t> dst_stride = tensor_desc.GetStrides();
+    const std::vector<size_t> src_stride(tensor_desc.GetStrides());
+    const std::vector<size_t> dst_stride(tensor_desc.GetStrides());
 
     ReorderTensorGPUData(handle,
                          lens,
@@ -42,6 +42,9 @@
 #include <nlohmann/json.hpp>
 
 #include <boost/hof/match.hpp>
+
+#include <algorithm>
+#include <type_traits>
 #include "miopen/fusion/problem_description.hpp"
 #include "miopen/fusion/context.hpp"
 
@@ -659,6 +662,223 @@ Problem Solution::Transpose(const Problem& problem, RunInput* x, const RunInput&
     return transposed;
 }
 
+BoundSolution::BoundSolution(const Solution& solution_,
+                             const std::vector<miopenTensorArgument_t>& arguments)
+    : solution(solution_)
+{
+    ids.reserve(arguments.size());
+    inputs.reserve(arguments.size());
+
+    for(const auto& argument : arguments)
+    {
+        if(!inputs.emplace(argument.id, Solution::RunInput{argument}).second)
+            MIOPEN_THROW(miopenStatusInvalidValue,
+                         "Tensor argument " + std::to_string(argument.id) + " is bound twice.");
+        ids.push_back(argument.id);
+    }
+
+    // Numerics checks need descriptors and buffers on every run, so those stay on the slow path.
+    if(miopen::CheckNumericsEnabled())
+        return;
+
+    const auto& problem_ = solution.GetProblem().item;
+    if(!std::holds_alternative<Problem>(problem_))
+        return;
+
+    std::visit(boost::hof::match([&](const ConvolutionDescriptor& op_desc) { Prepare(op_desc); },
+                                 [&](const SoftmaxDescriptor& op_desc) { Prepare(op_desc); },
+                                 [&](const auto& /*op_desc*/) {}),
+               std::get<Problem>(problem_).GetOperatorDescriptor());
+}
+
+std::size_t BoundSolution::GetIndex(miopenTensorArgumentId_t id) const
+{
+    const auto found = std::find(ids.begin(), ids.end(), id);
+    if(found == ids.end())
+        MIOPEN_THROW(miopenStatusInvalidValue,
+                     "Tensor argument " + std::to_string(id) + " has not been bound.");
+    return std::distance(ids.begin(), found);
+}
+
+template <class TData>
+void BoundSolution::BindSlot(miopenTensorArgumentId_t id, TData& field)
+{
+    if constexpr(std::is_same_v<TData, Data_t>)
+        slots.emplace_back(GetIndex(id), &field);
+    else
+        const_slots.emplace_back(GetIndex(id), &field);
+}
+
+void BoundSolution::Prepare(const ConvolutionDescriptor& conv_desc)
+{
+    const auto& problem_casted = std::get<Problem>(solution.GetProblem().item);
+
+    const auto get_input_checked = [&](auto name, const std::string& name_str) {
+        const auto& found = inputs.find(name);
+        if(found == inputs.end())
+        {
+            MIOPEN_THROW(miopenStatusInvalidValue,
+                         "Problem is missing " + name_str + " tensor descriptor.");
+        }
+        auto ret = found->second;
+        if(!ret.descriptor.has_value())
+            ret.descriptor = problem_casted.GetTensorDescriptorChecked(name, name_str);
+        return ret;
+    };
+
+    auto x       = get_input_checked(miopenTensorConvolutionX, "miopenTensorConvolutionX");
+    const auto w = get_input_checked(miopenTensorConvolutionW, "miopenTensorConvolutionW");
+    auto y       = get_input_checked(miopenTensorConvolutionY, "miopenTensorConvolutionY");
+
+    const auto transposed = conv_desc.mode == miopenTranspose;
+    const auto problem_ =
+        transposed ? Solution::Transpose(problem_casted, &x, w, &y) : problem_casted;
+
+    if(problem_.GetDirection() == miopenProblemDirectionBackward &&
+       y.descriptor->GetLengths()[1] != w.descriptor->GetLengths()[0])
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+
+    Problem::ValidateGroupCount(*x.descriptor, *w.descriptor, conv_desc);
+
+    // Transposition swaps x and y, so the slots follow the arguments they have been taken from.
+    const auto x_id = transposed ? miopenTensorConvolutionY : miopenTensorConvolutionX;
+    const auto y_id = transposed ? miopenTensorConvolutionX : miopenTensorConvolutionY;
+
+    params = Solution::MakeInvokeParams(problem_, conv_desc, x, w, y, nullptr, 0);
+
+    switch(problem_.GetDirection())
+    {
+    case miopenProblemDirectionForward:
+    case miopenProblemDirectionBackward: {
+        const auto forward = problem_.GetDirection() == miopenProblemDirectionForward;
+        auto& data         = params.CastTo<conv::DataInvokeParams>();
+        BindSlot(forward ? x_id : y_id, data.tensors.in);
+        BindSlot(miopenTensorConvolutionW, data.tensors.w);
+        BindSlot(forward ? y_id : x_id, data.tensors.out);
+        workspace_slot      = &data.workSpace;
+        workspace_size_slot = &data.workSpaceSize;
+        break;
+    }
+    case miopenProblemDirectionBackwardWeights: {
+        auto& data = params.CastTo<conv::WrWInvokeParams>();
+        BindSlot(y_id, data.tensors.dy);
+        BindSlot(x_id, data.tensors.x);
+        BindSlot(miopenTensorConvolutionW, data.tensors.dw);
+        workspace_slot      = &data.workSpace;
+        workspace_size_slot = &data.workSpaceSize;
+        break;
+    }
+    default: MIOPEN_THROW(miopenStatusNotImplemented);
+    }
+}
+
+void BoundSolution::Prepare(const SoftmaxDescriptor& softmax_desc)
+{
+    const auto& problem_casted = std::get<Problem>(solution.GetProblem().item);
+
+    const auto get_descriptor = [&](auto name, const std::string& name_str) {
+        const auto& found = inputs.find(name);
+        if(found == inputs.end())
+        {
+            MIOPEN_THROW(miopenStatusInvalidValue,
+                         "Problem is missing " + name_str + " tensor descriptor.");
+        }
+        if(found->second.descriptor.has_value())
+            return *found->second.descriptor;
+        return problem_casted.GetTensorDescriptorChecked(name, name_str);
+    };
+
+    const auto alpha     = softmax_desc.GetAlpha();
+    const auto beta      = softmax_desc.GetBeta();
+    const auto algorithm = softmax_desc.GetAlgorithm();
+    const auto mode      = softmax_desc.GetMode();
+
+    switch(problem_casted.GetDirection())
+    {
+    case miopenProblemDirectionForward: {
+        params = softmax::InvokeParams(&alpha,
+                                       &beta,
+                                       get_descriptor(miopenTensorSoftmaxX, "miopenTensorSoftmaxX"),
+                                       nullptr,
+                                       get_descriptor(miopenTensorSoftmaxY, "miopenTensorSoftmaxY"),
+                                       nullptr,
+                                       algorithm,
+                                       mode);
+        auto& data = params.CastTo<softmax::InvokeParams>();
+        BindSlot(miopenTensorSoftmaxX, data.x);
+        BindSlot(miopenTensorSoftmaxY, data.forward_y);
+        break;
+    }
+    case miopenProblemDirectionBackward: {
+        params =
+            softmax::InvokeParams(&alpha,
+                                  &beta,
+                                  get_descriptor(miopenTensorSoftmaxY, "miopenTensorSoftmaxY"),
+                                  nullptr,
+                                  get_descriptor(miopenTensorSoftmaxDY, "miopenTensorSoftmaxDY"),
+                                  nullptr,
+                                  get_descriptor(miopenTensorSoftmaxDX, "miopenTensorSoftmaxDX"),
+                                  nullptr,
+                                  algorithm,
+                                  mode);
+        auto& data = params.CastTo<softmax::InvokeParams>();
+        BindSlot(miopenTensorSoftmaxY, data.backward_y);
+        BindSlot(miopenTensorSoftmaxDY, data.dy);
+        BindSlot(miopenTensorSoftmaxDX, data.dx);
+        break;
+    }
+    default: MIOPEN_THROW(miopenStatusNotImplemented);
+    }
+}
+
+void BoundSolution::Run(const Handle& handle,
+                        void* const* buffers,
+                        Data_t workspace,
+                        std::size_t workspace_size)
+{
+    if(invoker)
+    {
+        if(&handle != invoker_handle)
+        {
+            MIOPEN_THROW(miopenStatusBadParm,
+                         "A bound solution can only be run on the handle of its first run.");
+        }
+        if(workspace_size < solution.GetWorkspaceSize())
+        {
+            MIOPEN_THROW(miopenStatusBadParm,
+                         solution.GetSolver().ToString() + " requires at least " +
+                             std::to_string(solution.GetWorkspaceSize()) + " workspace, while " +
+                             std::to_string(workspace_size) + " was provided");
+        }
+
+        for(const auto& slot : slots)
+            *slot.second = DataCast(buffers[slot.first]);
+        for(const auto& slot : const_slots)
+            *slot.second = DataCast(static_cast<const void*>(buffers[slot.first]));
+        if(workspace_slot != nullptr)
+        {
+            *workspace_slot      = workspace;
+            *workspace_size_slot = workspace_size;
+        }
+
+        (*invoker)(handle, params);
+        return;
+    }
+
+    for(std::size_t i = 0; i < ids.size(); ++i)
+        inputs[ids[i]].buffer = DataCast(buffers[i]);
+
+    solution.Run(handle, inputs, workspace, workspace_size);
+
+    if(params)
+    {
+        invoker        = solution.GetInvoker();
+        invoker_handle = &handle;
+    }
+}
+
 namespace fields {
 namespace header {
 inline constexpr const char* Validation = "validation";
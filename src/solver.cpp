@@ -48,6 +48,7 @@
 #include <miopen/db.hpp>
 #include <miopen/env.hpp>
 #include <miopen/solver_id.hpp>
+#include <miopen/startup.hpp>
 #include <miopen/par_for.hpp>
 #include <miopen/stringutils.hpp>
 #include <miopen/any_solver.hpp>
@@ -152,7 +153,10 @@ static auto& IdRegistry()
 {
     // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
     static auto data            = IdRegistryData{};
-    static const auto registrar = SolverRegistrar{data};
+    static const auto registrar = [&]() {
+        const startup::ScopedStep step{startup::Step::SolverRegistry};
+        return SolverRegistrar{data};
+    }();
     (void)registrar; // clang-tidy
     return data;
 }
@@ -707,6 +711,9 @@ inline SolverRegistrar::SolverRegistrar(IdRegistryData& registry)
              multimarginloss::MultiMarginLossForward{}.SolverDbId());
 
     Register(registry, ++id, Primitive::Mha, mha::MhaCKFlashAttentionV2Forward{}.SolverDbId());
+    RegisterWithSolver(registry, ++id, conv::ConvHostReferenceFwd{}, miopenConvolutionAlgoDirect);
+    RegisterWithSolver(registry, ++id, conv::ConvHostReferenceBwd{}, miopenConvolutionAlgoDirect);
+    RegisterWithSolver(registry, ++id, conv::ConvHostReferenceWrw{}, miopenConvolutionAlgoDirect);
     // IMPORTANT: New solvers should be added to the end of the function, and don't leave a white
     // space between this comment and the newly registered solver(s)!
 }
@@ -307,7 +307,7 @@ static bool IsApplicableTransform(const ExecutionContext& ctx, const ProblemDesc
         && out_W < std::pow(2, 16)
         && group_cnt < std::pow(2, 16)
         && problem.GetBias() == 0
-        && problem.GetInLayout() == "NCHW");
+        && problem.GetInLayoutCode() == tensor_layout::NCHW);
     // clang-format on
     return ok;
 #else
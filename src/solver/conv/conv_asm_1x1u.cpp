@@ -577,7 +577,7 @@ bool ConvAsm1x1U::IsApplicable(const ExecutionContext& ctx, const ProblemDescrip
         && problem.GetBias() == 0
         && problem.GetInChannels() % elements_in_dword == 0
         && problem.GetOutChannels() % elements_in_dword == 0
-        && problem.GetInLayout() == "NCHW"
+        && problem.GetInLayoutCode() == tensor_layout::NCHW
         && problem.GetGroupCount() == 1
         && img_hw >= elements_in_dword
         && (elements_in_dword == 1 || problem.GetOutChannels() >= 4));
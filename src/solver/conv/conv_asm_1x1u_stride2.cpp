@@ -531,7 +531,7 @@ bool ConvAsm1x1UV2::IsApplicable(const ExecutionContext& ctx,
         && problem.GetDilationW() == 1
         && problem.GetDilationH() == 1
         && problem.GetBias() == 0
-        && problem.GetInLayout() == "NCHW"
+        && problem.GetInLayoutCode() == tensor_layout::NCHW
         && problem.GetGroupCount() == 1
         && img_hw >= elements_in_dword);
 
@@ -241,7 +241,7 @@ bool ConvAsm3x3U::IsApplicable(const ExecutionContext& ctx, const ProblemDescrip
         && OUT_BUF_SZ <= 256 * TIB
         && WEI_BUF_SZ <= 4 * GIB
         && problem.IsFp32()
-        && problem.GetInLayout() == "NCHW";
+        && problem.GetInLayoutCode() == tensor_layout::NCHW;
         // && (problem.forward ? problem.GetWeightsLayout() == "KCHW" : problem.GetWeightsLayout() == "CKHW" )
     // clang-format on
 }
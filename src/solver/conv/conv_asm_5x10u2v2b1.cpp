@@ -103,7 +103,7 @@ bool ConvAsm5x10u2v2b1::IsApplicable(const ExecutionContext& ctx,
         && problem.GetOutHeight() <= max_out_height
         && problem.IsFp32()
         && problem.GetGroupCount() == 1
-        && problem.GetOutLayout() == "NCHW";          // hardcoded
+        && problem.GetOutLayoutCode() == tensor_layout::NCHW; // hardcoded
         // && (isForwardDirection() ? _weights_layout == "KCHW" : _weights_layout == "CKHW" )
     // clang-format on
 }
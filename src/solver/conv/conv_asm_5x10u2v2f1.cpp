@@ -104,7 +104,7 @@ bool ConvAsm5x10u2v2f1::IsApplicable(const ExecutionContext& ctx,
         && problem.GetInHeight() <= max_in_height
         && problem.IsFp32()
         && problem.GetGroupCount() == 1
-        && problem.GetInLayout() == "NCHW";         // hardcoded
+        && problem.GetInLayoutCode() == tensor_layout::NCHW; // hardcoded
         // && (problem.forward ? problem.GetWeightsLayout() == "KCHW" : problem.GetWeightsLayout() == "CKHW" )
     // clang-format on
 }
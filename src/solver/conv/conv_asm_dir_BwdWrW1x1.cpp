@@ -521,7 +521,7 @@ bool ConvAsmBwdWrW1x1::IsApplicable(const ExecutionContext& ctx,
         && problem.GetDilationH() == 1
         && problem.GetBias() == 0
         && (problem.IsFp32() || problem.IsFp16() || problem.IsBfp16())
-        && problem.GetInLayout() == "NCHW"
+        && problem.GetInLayoutCode() == tensor_layout::NCHW
         && problem.GetGroupCount() == 1);
     if(!ok)
     {
@@ -446,7 +446,7 @@ bool ConvAsmBwdWrW3x3::IsApplicable(const ExecutionContext& ctx,
         && problem.GetDilationH() == 1
         && problem.GetBias() == 0
         && (problem.IsFp32() || problem.IsFp16())
-        && problem.GetInLayout() == "NCHW";
+        && problem.GetInLayoutCode() == tensor_layout::NCHW;
     if(!ok)
         return false; // Early exit to speed up the check.
 
@@ -281,7 +281,7 @@ bool ConvBinWinogradRxS::IsApplicable(const ExecutionContext& ctx,
         && problem.GetDilationH() == 1
         && problem.GetBias() == 0
         && problem.GetGroupCount() == 1
-        && problem.GetInLayout() == "NCHW"))
+        && problem.GetInLayoutCode() == tensor_layout::NCHW))
         return false;
     // clang-format on
 
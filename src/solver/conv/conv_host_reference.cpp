@@ -0,0 +1,469 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/config.h>
+#include <miopen/conv/solvers.hpp>
+#include <miopen/conv/data_invoke_params.hpp>
+#include <miopen/conv/wrw_invoke_params.hpp>
+#include <miopen/bfloat16.hpp>
+#include <miopen/env.hpp>
+#include <miopen/find_solution.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/par_for.hpp>
+#include <miopen/tensor.hpp>
+
+#include <half/half.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <tuple>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_CONV_HOST_REFERENCE)
+
+namespace miopen {
+namespace solver {
+namespace conv {
+
+using ProblemDescription = miopen::conv::ProblemDescription;
+
+namespace {
+
+/// Convolution parameters captured from the problem. Tensor lengths and strides are taken
+/// from the descriptors passed to the invoker, so that any layout is handled through strides.
+struct HostConvGeometry
+{
+    std::array<int, 3> pad;
+    std::array<int, 3> stride;
+    std::array<int, 3> dilation;
+    int groups;
+};
+
+HostConvGeometry MakeHostConvGeometry(const ProblemDescription& problem)
+{
+    return {{problem.GetPadD(), problem.GetPadH(), problem.GetPadW()},
+            {problem.GetKernelStrideD(), problem.GetKernelStrideH(), problem.GetKernelStrideW()},
+            {problem.GetDilationD(), problem.GetDilationH(), problem.GetDilationW()},
+            problem.GetGroupCount()};
+}
+
+/// NCDHW view of a 4D or 5D tensor, 2D tensors get a unit depth.
+struct HostTensorView
+{
+    std::array<std::size_t, 5> lens;
+    std::array<std::size_t, 5> strides;
+
+    explicit HostTensorView(const TensorDescriptor& desc)
+    {
+        const auto& l = desc.GetLengths();
+        const auto& s = desc.GetStrides();
+        if(l.size() == 5)
+        {
+            std::copy(l.begin(), l.end(), lens.begin());
+            std::copy(s.begin(), s.end(), strides.begin());
+        }
+        else
+        {
+            lens    = {l[0], l[1], 1, l[2], l[3]};
+            strides = {s[0], s[1], 0, s[2], s[3]};
+        }
+    }
+
+    std::size_t
+    Offset(std::size_t n, std::size_t c, std::size_t d, std::size_t h, std::size_t w) const
+    {
+        return n * strides[0] + c * strides[1] + d * strides[2] + h * strides[3] + w * strides[4];
+    }
+};
+
+/// Maps output position `o` and filter tap `f` along one spatial dimension onto
+/// the input. Returns false for taps falling into the padding.
+inline bool InputIndex(const HostConvGeometry& g,
+                       int dim,
+                       std::size_t o,
+                       std::size_t f,
+                       std::size_t in_len,
+                       std::size_t& i)
+{
+    const auto pos = static_cast<long long>(o) * g.stride[dim] - g.pad[dim] +
+                     static_cast<long long>(f) * g.dilation[dim];
+    if(pos < 0 || pos >= static_cast<long long>(in_len))
+        return false;
+    i = static_cast<std::size_t>(pos);
+    return true;
+}
+
+/// Inverse of InputIndex: finds the output position which reads input position `i`
+/// through filter tap `f`, if there is one.
+inline bool OutputIndex(const HostConvGeometry& g,
+                        int dim,
+                        std::size_t i,
+                        std::size_t f,
+                        std::size_t out_len,
+                        std::size_t& o)
+{
+    const auto pos = static_cast<long long>(i) + g.pad[dim] -
+                     static_cast<long long>(f) * g.dilation[dim];
+    if(pos < 0 || pos % g.stride[dim] != 0)
+        return false;
+    o = static_cast<std::size_t>(pos / g.stride[dim]);
+    return o < out_len;
+}
+
+template <class T>
+inline void Blend(T* dst, std::size_t offset, double acc, double alpha, double beta)
+{
+    const auto prev = beta == 0.0 ? 0.0 : static_cast<double>(static_cast<float>(dst[offset]));
+    dst[offset]     = static_cast<T>(static_cast<float>(alpha * acc + beta * prev));
+}
+
+template <class T>
+inline double Value(const T* src, std::size_t offset)
+{
+    return static_cast<float>(src[offset]);
+}
+
+template <class T>
+void HostConvFwd(const HostConvGeometry& g,
+                 const HostTensorView& xv,
+                 const T* x,
+                 const HostTensorView& wv,
+                 const T* w,
+                 const HostTensorView& yv,
+                 T* y,
+                 double alpha,
+                 double beta)
+{
+    const auto k_per_group = yv.lens[1] / g.groups;
+    const auto c_per_group = wv.lens[1];
+
+    par_for(yv.lens[0] * yv.lens[1], 1, [&](std::size_t nk) {
+        const auto n     = nk / yv.lens[1];
+        const auto k     = nk % yv.lens[1];
+        const auto c_beg = (k / k_per_group) * c_per_group;
+
+        for(std::size_t od = 0; od < yv.lens[2]; ++od)
+            for(std::size_t oh = 0; oh < yv.lens[3]; ++oh)
+                for(std::size_t ow = 0; ow < yv.lens[4]; ++ow)
+                {
+                    double acc = 0.0;
+                    for(std::size_t c = 0; c < c_per_group; ++c)
+                        for(std::size_t fd = 0; fd < wv.lens[2]; ++fd)
+                        {
+                            std::size_t id = 0;
+                            if(!InputIndex(g, 0, od, fd, xv.lens[2], id))
+                                continue;
+                            for(std::size_t fh = 0; fh < wv.lens[3]; ++fh)
+                            {
+                                std::size_t ih = 0;
+                                if(!InputIndex(g, 1, oh, fh, xv.lens[3], ih))
+                                    continue;
+                                for(std::size_t fw = 0; fw < wv.lens[4]; ++fw)
+                                {
+                                    std::size_t iw = 0;
+                                    if(!InputIndex(g, 2, ow, fw, xv.lens[4], iw))
+                                        continue;
+                                    acc += Value(x, xv.Offset(n, c_beg + c, id, ih, iw)) *
+                                           Value(w, wv.Offset(k, c, fd, fh, fw));
+                                }
+                            }
+                        }
+                    Blend(y, yv.Offset(n, k, od, oh, ow), acc, alpha, beta);
+                }
+    });
+}
+
+template <class T>
+void HostConvBwd(const HostConvGeometry& g,
+                 const HostTensorView& dyv,
+                 const T* dy,
+                 const HostTensorView& wv,
+                 const T* w,
+                 const HostTensorView& dxv,
+                 T* dx,
+                 double alpha,
+                 double beta)
+{
+    const auto k_per_group = dyv.lens[1] / g.groups;
+    const auto c_per_group = wv.lens[1];
+
+    par_for(dxv.lens[0] * dxv.lens[1], 1, [&](std::size_t nc) {
+        const auto n     = nc / dxv.lens[1];
+        const auto c     = nc % dxv.lens[1];
+        const auto k_beg = (c / c_per_group) * k_per_group;
+        const auto cg    = c % c_per_group;
+
+        for(std::size_t id = 0; id < dxv.lens[2]; ++id)
+            for(std::size_t ih = 0; ih < dxv.lens[3]; ++ih)
+                for(std::size_t iw = 0; iw < dxv.lens[4]; ++iw)
+                {
+                    double acc = 0.0;
+                    for(std::size_t fd = 0; fd < wv.lens[2]; ++fd)
+                    {
+                        std::size_t od = 0;
+                        if(!OutputIndex(g, 0, id, fd, dyv.lens[2], od))
+                            continue;
+                        for(std::size_t fh = 0; fh < wv.lens[3]; ++fh)
+                        {
+                            std::size_t oh = 0;
+                            if(!OutputIndex(g, 1, ih, fh, dyv.lens[3], oh))
+                                continue;
+                            for(std::size_t fw = 0; fw < wv.lens[4]; ++fw)
+                            {
+                                std::size_t ow = 0;
+                                if(!OutputIndex(g, 2, iw, fw, dyv.lens[4], ow))
+                                    continue;
+                                for(std::size_t k = k_beg; k < k_beg + k_per_group; ++k)
+                                    acc += Value(dy, dyv.Offset(n, k, od, oh, ow)) *
+                                           Value(w, wv.Offset(k, cg, fd, fh, fw));
+                            }
+                        }
+                    }
+                    Blend(dx, dxv.Offset(n, c, id, ih, iw), acc, alpha, beta);
+                }
+    });
+}
+
+template <class T>
+void HostConvWrw(const HostConvGeometry& g,
+                 const HostTensorView& dyv,
+                 const T* dy,
+                 const HostTensorView& xv,
+                 const T* x,
+                 const HostTensorView& dwv,
+                 T* dw,
+                 double alpha,
+                 double beta)
+{
+    const auto k_per_group = dyv.lens[1] / g.groups;
+    const auto c_per_group = dwv.lens[1];
+
+    par_for(dwv.lens[0] * dwv.lens[1], 1, [&](std::size_t kc) {
+        const auto k  = kc / dwv.lens[1];
+        const auto c  = kc % dwv.lens[1];
+        const auto ci = (k / k_per_group) * c_per_group + c;
+
+        for(std::size_t fd = 0; fd < dwv.lens[2]; ++fd)
+            for(std::size_t fh = 0; fh < dwv.lens[3]; ++fh)
+                for(std::size_t fw = 0; fw < dwv.lens[4]; ++fw)
+                {
+                    double acc = 0.0;
+                    for(std::size_t n = 0; n < dyv.lens[0]; ++n)
+                        for(std::size_t od = 0; od < dyv.lens[2]; ++od)
+                        {
+                            std::size_t id = 0;
+                            if(!InputIndex(g, 0, od, fd, xv.lens[2], id))
+                                continue;
+                            for(std::size_t oh = 0; oh < dyv.lens[3]; ++oh)
+                            {
+                                std::size_t ih = 0;
+                                if(!InputIndex(g, 1, oh, fh, xv.lens[3], ih))
+                                    continue;
+                                for(std::size_t ow = 0; ow < dyv.lens[4]; ++ow)
+                                {
+                                    std::size_t iw = 0;
+                                    if(!InputIndex(g, 2, ow, fw, xv.lens[4], iw))
+                                        continue;
+                                    acc += Value(dy, dyv.Offset(n, k, od, oh, ow)) *
+                                           Value(x, xv.Offset(n, ci, id, ih, iw));
+                                }
+                            }
+                        }
+                    Blend(dw, dwv.Offset(k, c, fd, fh, fw), acc, alpha, beta);
+                }
+    });
+}
+
+/// Calls `f` with a null pointer of the host type matching `type`.
+template <class F>
+void VisitHostType(miopenDataType_t type, F f)
+{
+    switch(type)
+    {
+    case miopenFloat: f(static_cast<float*>(nullptr)); break;
+    case miopenHalf: f(static_cast<half_float::half*>(nullptr)); break;
+    case miopenBFloat16: f(static_cast<bfloat16*>(nullptr)); break;
+    default: MIOPEN_THROW(miopenStatusInternalError, "Unsupported data type for host reference");
+    }
+}
+
+/// Runs `f` and, while profiling is enabled, reports its wall time as the kernel time, so that
+/// Find measures host solutions like kernel ones.
+template <class F>
+void RunTimed(const Handle& handle, F f)
+{
+    if(!handle.IsProfilingEnabled())
+    {
+        f();
+        return;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const auto elapsed =
+        std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start);
+    handle.ResetKernelTime();
+    handle.AccumKernelTime(elapsed.count());
+}
+
+bool IsHostReferenceApplicable(const ProblemDescription& problem)
+{
+#if MIOPEN_MODE_NOGPU
+    if(env::disabled(MIOPEN_DEBUG_CONV_HOST_REFERENCE))
+        return false;
+    if(!problem.Is2d() && !problem.Is3d())
+        return false;
+    if(!(problem.IsFp32() || problem.IsFp16() || problem.IsBfp16()))
+        return false;
+    if(problem.IsTensorsCasted())
+        return false;
+    if(problem.GetInDataType() != problem.GetWeightsDataType() ||
+       problem.GetInDataType() != problem.GetOutDataType())
+        return false;
+    return true;
+#else
+    std::ignore = problem;
+    return false;
+#endif
+}
+
+} // namespace
+
+#if MIOPEN_MODE_NOGPU
+bool IsSupersededByHostSolver(const SolverBase& solver, const ProblemDescription& problem)
+{
+    return !solver.IsHostSolver() && IsHostReferenceApplicable(problem);
+}
+#endif
+
+bool ConvHostReferenceFwd::IsApplicable(const ExecutionContext&,
+                                        const ProblemDescription& problem) const
+{
+    return problem.IsDirectionForward() && IsHostReferenceApplicable(problem);
+}
+
+ConvSolution ConvHostReferenceFwd::GetSolution(const ExecutionContext&,
+                                               const ProblemDescription& problem) const
+{
+    ConvSolution result;
+    const auto geometry = MakeHostConvGeometry(problem);
+
+    result.invoker_factory = [=](const std::vector<Kernel>&) {
+        return [=](const Handle& handle, const AnyInvokeParams& primitive_parameters) {
+            decltype(auto) data_ctx = primitive_parameters.CastTo<miopen::conv::DataInvokeParams>();
+            const auto& tensors     = data_ctx.tensors;
+            RunTimed(handle, [&] {
+                VisitHostType(tensors.inDesc.GetType(), [&](auto* type) {
+                    using T = std::remove_pointer_t<decltype(type)>;
+                    HostConvFwd(geometry,
+                                HostTensorView{tensors.inDesc},
+                                static_cast<const T*>(tensors.in),
+                                HostTensorView{tensors.wDesc},
+                                static_cast<const T*>(tensors.w),
+                                HostTensorView{tensors.outDesc},
+                                static_cast<T*>(tensors.out),
+                                data_ctx.alpha.GetAsDouble(),
+                                data_ctx.beta.GetAsDouble());
+                });
+            });
+        };
+    };
+    return result;
+}
+
+bool ConvHostReferenceBwd::IsApplicable(const ExecutionContext&,
+                                        const ProblemDescription& problem) const
+{
+    return problem.IsDirectionBackwardData() && IsHostReferenceApplicable(problem);
+}
+
+ConvSolution ConvHostReferenceBwd::GetSolution(const ExecutionContext&,
+                                               const ProblemDescription& problem) const
+{
+    ConvSolution result;
+    const auto geometry = MakeHostConvGeometry(problem);
+
+    result.invoker_factory = [=](const std::vector<Kernel>&) {
+        return [=](const Handle& handle, const AnyInvokeParams& primitive_parameters) {
+            decltype(auto) data_ctx = primitive_parameters.CastTo<miopen::conv::DataInvokeParams>();
+            const auto& tensors     = data_ctx.tensors;
+            /// \ref backward_tensors_reversed_why
+            RunTimed(handle, [&] {
+                VisitHostType(tensors.inDesc.GetType(), [&](auto* type) {
+                    using T = std::remove_pointer_t<decltype(type)>;
+                    HostConvBwd(geometry,
+                                HostTensorView{tensors.inDesc},
+                                static_cast<const T*>(tensors.in),
+                                HostTensorView{tensors.wDesc},
+                                static_cast<const T*>(tensors.w),
+                                HostTensorView{tensors.outDesc},
+                                static_cast<T*>(tensors.out),
+                                data_ctx.alpha.GetAsDouble(),
+                                data_ctx.beta.GetAsDouble());
+                });
+            });
+        };
+    };
+    return result;
+}
+
+bool ConvHostReferenceWrw::IsApplicable(const ExecutionContext&,
+                                        const ProblemDescription& problem) const
+{
+    return problem.IsDirectionBackwardWrW() && IsHostReferenceApplicable(problem);
+}
+
+ConvSolution ConvHostReferenceWrw::GetSolution(const ExecutionContext&,
+                                               const ProblemDescription& problem) const
+{
+    ConvSolution result;
+    const auto geometry = MakeHostConvGeometry(problem);
+
+    result.invoker_factory = [=](const std::vector<Kernel>&) {
+        return [=](const Handle& handle, const AnyInvokeParams& primitive_parameters) {
+            decltype(auto) wrw_ctx = primitive_parameters.CastTo<miopen::conv::WrWInvokeParams>();
+            const auto& tensors    = wrw_ctx.tensors;
+            RunTimed(handle, [&] {
+                VisitHostType(tensors.dwDesc.GetType(), [&](auto* type) {
+                    using T = std::remove_pointer_t<decltype(type)>;
+                    HostConvWrw(geometry,
+                                HostTensorView{tensors.dyDesc},
+                                static_cast<const T*>(tensors.dy),
+                                HostTensorView{tensors.xDesc},
+                                static_cast<const T*>(tensors.x),
+                                HostTensorView{tensors.dwDesc},
+                                static_cast<T*>(tensors.dw),
+                                wrw_ctx.alpha.GetAsDouble(),
+                                wrw_ctx.beta.GetAsDouble());
+                });
+            });
+        };
+    };
+    return result;
+}
+
+} // namespace conv
+} // namespace solver
+} // namespace miopen
@@ -549,7 +549,7 @@ bool ConvWinograd3x3MultipassWrW<WinoDataH, WinoFilterH, WinoDataW, WinoFilterW>
         && problem.GetInHeight() < std::pow(2, 24)
         && problem.GetInWidth() < std::pow(2, 24)
         && problem.GetBias() == 0
-        && problem.GetInLayout() == "NCHW"
+        && problem.GetInLayoutCode() == tensor_layout::NCHW
         && problem.GetGroupCount() == 1);
     // clang-format on
     return ok;
@@ -63,7 +63,7 @@ SplitBufferToWorkspace(size_t S, size_t D, size_t NHS, miopenDataType_t out_type
         out_type == miopenFloat ? 0 : NHS * S * get_data_size(out_type)}; // fp8 dS
 }
 
-MultiBufferWorkspaceTraits SplitBufferToWorkspace(const std::vector<size_t>& lengths,
+MultiBufferWorkspaceTraits SplitBufferToWorkspace(const TensorDims& lengths,
                                                   miopenDataType_t out_type)
 {
     const auto [N, H, S, D] = miopen::tien<4>(lengths);
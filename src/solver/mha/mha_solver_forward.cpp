@@ -57,7 +57,7 @@ SplitBufferToWorkspace(size_t S, size_t D, size_t NHS, miopenDataType_t out_type
         NHS * S * get_data_size(out_type)};                // first matmul tensor
 }
 
-MultiBufferWorkspaceTraits SplitBufferToWorkspace(const std::vector<size_t>& lengths,
+MultiBufferWorkspaceTraits SplitBufferToWorkspace(const TensorDims& lengths,
                                                   miopenDataType_t out_type)
 {
     const auto [N, H, S, D] = miopen::tien<4>(lengths);
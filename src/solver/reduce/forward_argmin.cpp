@@ -39,7 +39,7 @@ namespace solver {
 
 namespace reduce {
 
-size_t ArgminForward::XGridSize(std::vector<size_t> indicedims) const
+size_t ArgminForward::XGridSize(const TensorDims& indicedims) const
 {
     size_t indice_numel =
         std::accumulate(indicedims.begin(), indicedims.end(), 1ULL, std::multiplies<size_t>());
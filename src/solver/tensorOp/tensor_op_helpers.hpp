@@ -71,8 +71,8 @@ inline std::tuple<size_t, std::string> GetRDBLCKandREADTYPE(size_t len, miopenDa
                            (RD_BLCK == 1) ? data_type : data_type + std::to_string(RD_BLCK));
 }
 
-inline std::tuple<int, int, unsigned int> GetBitmapAndWgInfo(const std::vector<size_t>& blens,
-                                                             const std::vector<size_t>& clens)
+inline std::tuple<int, int, unsigned int> GetBitmapAndWgInfo(const TensorDims& blens,
+                                                             const TensorDims& clens)
 {
     // first_not_one is incorrect if btensor size equal to 1
     auto first_not_one = std::find_if(blens.rbegin(), blens.rend(), [](int i) { return i != 1; });
@@ -288,11 +288,21 @@ static void memShmBarrier(sqlite3_file* pFile) { return; }
 /* Unmap a shared memory segment */
 static int memShmUnmap(sqlite3_file* pFile, int deleteFlag) { return SQLITE_OK; }
 
-/* Fetch a page of a memory-mapped file */
+/*
+** Fetch a page of a memory-mapped file. The pager uses the returned pointer
+** in place of its own copy of the page, so with "PRAGMA mmap_size" set pages
+** are read straight from aData. Pages beyond the end of the file are not
+** mapped; the pager falls back to xRead for them.
+*/
 static int memFetch(sqlite3_file* pFile, sqlite3_int64 iOfst, int iAmt, void** pp)
 {
     MemFile* p = (MemFile*)pFile;
-    *pp        = (void*)(p->aData + iOfst);
+    if(iOfst < 0 || iOfst + iAmt > p->sz)
+    {
+        *pp = 0;
+        return SQLITE_OK;
+    }
+    *pp = (void*)(p->aData + iOfst);
     return SQLITE_OK;
 }
 
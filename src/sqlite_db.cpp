@@ -105,13 +105,21 @@ class SQLite::impl
             ptrdiff_t ptr_sz = p.second - p.first;
             char* memuri     = sqlite3_mprintf(
                 "file:ignoredFilename?ptr=0x%p&sz=%lld", p.first, static_cast<long long>(ptr_sz));
+            // The image lives in read-only memory: open it read-only and let the pager fetch
+            // pages straight from it (memFetch()) instead of copying them into its page cache.
             if(sqlite3_open_v2(
-                   memuri, &ptr_tmp, SQLITE_OPEN_READWRITE | SQLITE_OPEN_URI, nullptr) != SQLITE_OK)
+                   memuri, &ptr_tmp, SQLITE_OPEN_READONLY | SQLITE_OPEN_URI, nullptr) != SQLITE_OK)
             {
                 MIOPEN_THROW(miopenStatusInternalError,
                              "open memvfs: " + std::string(sqlite3_errmsg(ptr_tmp)));
             }
             sqlite3_free(memuri);
+            const auto mmap_pragma = "PRAGMA mmap_size=" + std::to_string(ptr_sz) + ";";
+            if(sqlite3_exec(ptr_tmp, mmap_pragma.c_str(), nullptr, nullptr, nullptr) != SQLITE_OK)
+            {
+                MIOPEN_LOG_W("Failed to enable mmap for " << filepath << ": "
+                                                          << sqlite3_errmsg(ptr_tmp));
+            }
         }
         else
         {
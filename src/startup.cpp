@@ -0,0 +1,222 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/startup.hpp>
+
+#include <miopen/env.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/find_db.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/mlo_internal.hpp>
+#include <miopen/solver_id.hpp>
+#if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
+#include <miopen/conv/heuristics/ai_heuristics.hpp>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
+/// Prints the timeline of the one-time initialization steps to stderr at exit.
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_STARTUP_REPORT)
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_ENABLE_AI_IMMED_MODE_FALLBACK)
+
+namespace miopen {
+namespace startup {
+
+namespace {
+
+const auto load_time = std::chrono::steady_clock::now();
+
+thread_local bool in_warm_start = false; // NOLINT (cppcoreguidelines-avoid-non-const-global-variables)
+
+std::uint64_t Now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                load_time)
+        .count();
+}
+
+struct Registry
+{
+    std::mutex mutex;
+    std::vector<Event> events;
+    std::vector<std::thread> warm_start_threads;
+};
+
+// Never destroyed: steps may still be recorded while the process exits.
+Registry& GetRegistry()
+{
+    static auto* const registry = new Registry{};
+    return *registry;
+}
+
+struct DumpAtExit
+{
+    DumpAtExit() : enabled(env::enabled(MIOPEN_STARTUP_REPORT)) {}
+    DumpAtExit(const DumpAtExit&) = delete;
+    DumpAtExit& operator=(const DumpAtExit&) = delete;
+    ~DumpAtExit()
+    {
+        if(enabled)
+            Print(std::cerr, GetTimeline());
+    }
+
+    bool enabled;
+};
+
+const DumpAtExit dump_at_exit;
+
+/// Runs `task` on a warm start thread. Failures are only logged: the same work is redone, and
+/// reported, on first use.
+std::thread Launch(const char* name, std::function<void()> task)
+{
+    return std::thread{[name, task = std::move(task)]() {
+        in_warm_start = true;
+        try
+        {
+            task();
+        }
+        catch(const std::exception& ex)
+        {
+            MIOPEN_LOG_W("Warm start of " << name << " failed: " << ex.what());
+        }
+    }};
+}
+
+} // namespace
+
+const char* ToString(Step step)
+{
+    switch(step)
+    {
+    case Step::SolverRegistry: return "SolverRegistry";
+    case Step::DbPrefetch: return "DbPrefetch";
+    case Step::AiModel: return "AiModel";
+    }
+    return "<Unknown>";
+}
+
+ScopedStep::ScopedStep(Step step_, std::string detail_)
+    : step(step_), detail(std::move(detail_)), begin(Now())
+{
+}
+
+ScopedStep::~ScopedStep()
+{
+    const auto end  = Now();
+    auto& registry  = GetRegistry();
+    const auto hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.events.push_back({step, std::move(detail), begin, end, hash, in_warm_start});
+}
+
+std::vector<Event> GetTimeline()
+{
+    auto result    = std::vector<Event>{};
+    auto& registry = GetRegistry();
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        result = registry.events;
+    }
+    std::sort(result.begin(), result.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.begin < rhs.begin;
+    });
+    return result;
+}
+
+void Print(std::ostream& os, const std::vector<Event>& timeline)
+{
+    const auto flags = os.flags();
+    const auto ms    = [](std::uint64_t ns) { return static_cast<double>(ns) * 1e-6; };
+
+    // Threads are numbered in the order of their first step.
+    auto threads = std::vector<std::size_t>{};
+
+    os << "MIOpen startup timeline, ms since load:" << std::endl;
+    os << std::right << std::setw(12) << "begin" << std::setw(10) << "duration" << std::setw(8)
+       << "thread" << "  " << std::left << std::setw(16) << "step" << "detail" << std::endl;
+    os << std::fixed << std::setprecision(3);
+    for(const auto& event : timeline)
+    {
+        auto thread = std::find(threads.begin(), threads.end(), event.thread);
+        if(thread == threads.end())
+            thread = threads.insert(threads.end(), event.thread);
+
+        os << std::right << std::setw(12) << ms(event.begin) << std::setw(10)
+           << ms(event.end - event.begin) << std::setw(7) << (thread - threads.begin())
+           << (event.warm_start ? 'w' : ' ') << "  " << std::left << std::setw(16)
+           << ToString(event.step) << event.detail << std::endl;
+    }
+    os.flags(flags);
+}
+
+void WarmStart(const Handle& handle)
+{
+    auto threads = std::vector<std::thread>{};
+
+    threads.push_back(Launch("solver registry", []() {
+        std::ignore = solver::GetSolversByPrimitive(solver::Primitive::Convolution);
+    }));
+    threads.push_back(Launch("perf db", [&handle]() {
+        const auto ctx = ExecutionContext{&handle};
+        std::ignore    = GetDb(ctx);
+    }));
+    threads.push_back(Launch("find db", [&handle]() { FindDbRecord::Prefetch(handle); }));
+#if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
+    if(!env::disabled(MIOPEN_DEBUG_ENABLE_AI_IMMED_MODE_FALLBACK))
+    {
+        threads.push_back(Launch("TunaNet model", [device = handle.GetDeviceName()]() {
+            ai::immed_mode::LoadModel(device);
+        }));
+    }
+#endif
+
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    std::move(threads.begin(), threads.end(), std::back_inserter(registry.warm_start_threads));
+}
+
+void WaitForWarmStart()
+{
+    auto threads   = std::vector<std::thread>{};
+    auto& registry = GetRegistry();
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        threads.swap(registry.warm_start_threads);
+    }
+    for(auto& thread : threads)
+        thread.join();
+}
+
+} // namespace startup
+} // namespace miopen
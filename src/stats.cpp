@@ -0,0 +1,290 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/stats.hpp>
+
+#include <miopen/env.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+/// Prints the performance counters to stderr when the process exits.
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_STATS_DUMP)
+
+namespace miopen {
+namespace stats {
+
+namespace {
+
+constexpr auto counter_count   = static_cast<std::size_t>(Counter::Count);
+constexpr auto histogram_count = static_cast<std::size_t>(Histogram::Count);
+
+struct AtomicHistogram
+{
+    std::atomic<std::uint64_t> count{0};
+    std::atomic<std::uint64_t> sum{0};
+    std::array<std::atomic<std::uint64_t>, histogram_buckets> buckets{};
+};
+
+/// Only the owning thread writes the values, so they are updated with plain
+/// loads and stores instead of read-modify-write operations.
+struct ThreadStats
+{
+    std::array<std::atomic<std::uint64_t>, counter_count> counters{};
+    std::array<AtomicHistogram, histogram_count> histograms{};
+};
+
+void Add(std::atomic<std::uint64_t>& value, std::uint64_t n)
+{
+    value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+void AddTo(Snapshot& to, const ThreadStats& from)
+{
+    for(std::size_t i = 0; i < counter_count; ++i)
+        to.counters[i] += from.counters[i].load(std::memory_order_relaxed);
+    for(std::size_t i = 0; i < histogram_count; ++i)
+    {
+        const auto& src = from.histograms[i];
+        auto& dst       = to.histograms[i];
+        dst.count += src.count.load(std::memory_order_relaxed);
+        dst.sum += src.sum.load(std::memory_order_relaxed);
+        for(std::size_t b = 0; b < histogram_buckets; ++b)
+            dst.buckets[b] += src.buckets[b].load(std::memory_order_relaxed);
+    }
+}
+
+struct Registry
+{
+    std::mutex mutex;
+    std::vector<const ThreadStats*> threads;
+    Snapshot retired; // counters of the exited threads
+    Snapshot baseline;
+};
+
+// Never destroyed: threads may still be counting while the process exits.
+Registry& GetRegistry()
+{
+    static auto* const registry = new Registry{};
+    return *registry;
+}
+
+/// Registers the counters of the calling thread. When the thread exits they are folded
+/// into the retired total and unregistered, so exited threads hold no memory.
+class ThreadStatsOwner
+{
+public:
+    ThreadStatsOwner()
+    {
+        auto& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.threads.push_back(&stats);
+    }
+
+    ThreadStatsOwner(const ThreadStatsOwner&) = delete;
+    ThreadStatsOwner& operator=(const ThreadStatsOwner&) = delete;
+
+    ~ThreadStatsOwner()
+    {
+        auto& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        AddTo(registry.retired, stats);
+        auto& threads = registry.threads;
+        threads.erase(std::remove(threads.begin(), threads.end(), &stats), threads.end());
+    }
+
+    ThreadStats& Get() { return stats; }
+
+private:
+    ThreadStats stats;
+};
+
+ThreadStats& GetThreadStats()
+{
+    thread_local ThreadStatsOwner owner;
+    return owner.Get();
+}
+
+std::size_t GetBucket(std::uint64_t value)
+{
+    std::size_t bits = 0;
+    for(; value != 0; value >>= 1)
+        ++bits;
+    return std::min(bits, histogram_buckets - 1);
+}
+
+Snapshot CollectTotal(const Registry& registry)
+{
+    auto result = registry.retired;
+    for(const auto* thread : registry.threads)
+        AddTo(result, *thread);
+    return result;
+}
+
+struct DumpAtExit
+{
+    DumpAtExit() : enabled(env::enabled(MIOPEN_STATS_DUMP)) {}
+    DumpAtExit(const DumpAtExit&) = delete;
+    DumpAtExit& operator=(const DumpAtExit&) = delete;
+    ~DumpAtExit()
+    {
+        if(enabled)
+            std::cerr << Collect();
+    }
+
+    bool enabled;
+};
+
+const DumpAtExit dump_at_exit;
+
+} // namespace
+
+std::uint64_t HistogramData::Percentile(double percentile) const
+{
+    if(count == 0)
+        return 0;
+    const auto rank = static_cast<std::uint64_t>(percentile / 100.0 * (count - 1));
+    std::uint64_t seen = 0;
+    for(std::size_t b = 0; b < histogram_buckets; ++b)
+    {
+        seen += buckets[b];
+        if(seen > rank)
+            return (std::uint64_t{1} << b) - 1;
+    }
+    return (std::uint64_t{1} << (histogram_buckets - 1)) - 1;
+}
+
+void Increment(Counter counter, std::uint64_t value)
+{
+    Add(GetThreadStats().counters[static_cast<std::size_t>(counter)], value);
+}
+
+void Record(Histogram histogram, std::uint64_t value)
+{
+    auto& data = GetThreadStats().histograms[static_cast<std::size_t>(histogram)];
+    Add(data.count, 1);
+    Add(data.sum, value);
+    Add(data.buckets[GetBucket(value)], 1);
+}
+
+Snapshot Collect()
+{
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto result = CollectTotal(registry);
+    for(std::size_t i = 0; i < counter_count; ++i)
+        result.counters[i] -= registry.baseline.counters[i];
+    for(std::size_t i = 0; i < histogram_count; ++i)
+    {
+        const auto& base = registry.baseline.histograms[i];
+        auto& data       = result.histograms[i];
+        data.count -= base.count;
+        data.sum -= base.sum;
+        for(std::size_t b = 0; b < histogram_buckets; ++b)
+            data.buckets[b] -= base.buckets[b];
+    }
+    return result;
+}
+
+void Reset()
+{
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.baseline = CollectTotal(registry);
+}
+
+std::size_t GetNumThreads()
+{
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.threads.size();
+}
+
+const char* GetName(Counter counter)
+{
+    switch(counter)
+    {
+    case Counter::InvokerCacheHit: return "InvokerCacheHit";
+    case Counter::InvokerCacheMiss: return "InvokerCacheMiss";
+    case Counter::FindDbHit: return "FindDbHit";
+    case Counter::FindDbMiss: return "FindDbMiss";
+    case Counter::PerfDbHit: return "PerfDbHit";
+    case Counter::PerfDbMiss: return "PerfDbMiss";
+    case Counter::KernelCacheHit: return "KernelCacheHit";
+    case Counter::KernelCacheMiss: return "KernelCacheMiss";
+    case Counter::IsApplicable: return "IsApplicable";
+    case Counter::FusionPlanCacheHit: return "FusionPlanCacheHit";
+    case Counter::FusionPlanCacheMiss: return "FusionPlanCacheMiss";
+    case Counter::GraphEngineCacheHit: return "GraphEngineCacheHit";
+    case Counter::GraphEngineCacheMiss: return "GraphEngineCacheMiss";
+    case Counter::Count: break;
+    }
+    return "<Unknown>";
+}
+
+const char* GetName(Histogram histogram)
+{
+    switch(histogram)
+    {
+    case Histogram::FindDbLookup: return "FindDbLookup";
+    case Histogram::PerfDbLookup: return "PerfDbLookup";
+    case Histogram::Compile: return "Compile";
+    case Histogram::Count: break;
+    }
+    return "<Unknown>";
+}
+
+std::ostream& operator<<(std::ostream& os, const Snapshot& snapshot)
+{
+    os << "MIOpen stats:" << std::endl;
+    for(std::size_t i = 0; i < counter_count; ++i)
+        os << "  " << GetName(static_cast<Counter>(i)) << ": " << snapshot.counters[i]
+           << std::endl;
+
+    const auto flags = os.flags();
+    os << std::fixed << std::setprecision(3);
+    for(std::size_t i = 0; i < histogram_count; ++i)
+    {
+        const auto& data = snapshot.histograms[i];
+        os << "  " << GetName(static_cast<Histogram>(i)) << ": count " << data.count
+           << ", total " << data.sum * 1e-3 << " ms";
+        if(data.count != 0)
+        {
+            os << ", mean " << data.Mean() * 1e-3 << " ms, p50 <= "
+               << data.Percentile(50) * 1e-3 << " ms, p99 <= " << data.Percentile(99) * 1e-3
+               << " ms";
+        }
+        os << std::endl;
+    }
+    os.flags(flags);
+    return os;
+}
+
+} // namespace stats
+} // namespace miopen
@@ -98,8 +98,8 @@ std::optional<miopenTensorLayout_t> GetDefaultLayout(unsigned num_dims)
     }
 }
 
-template <class T>
-bool CheckLengths(const std::vector<T>& lens, T maxval = 0)
+template <class TDims, class T = typename TDims::value_type>
+bool CheckLengths(const TDims& lens, T maxval = 0)
 {
     if(lens.empty())
         return false;
@@ -113,6 +113,14 @@ bool CheckLengths(const std::vector<T>& lens, T maxval = 0)
     return true;
 }
 
+TensorDims MakeDimsOrThrow(const std::vector<std::size_t>& dims)
+{
+    if(dims.size() > tensor_max_dims)
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "Number of dimensions must be <= " + std::to_string(tensor_max_dims));
+    return {dims.cbegin(), dims.cend()};
+}
+
 std::vector<std::size_t> ConvertLengthsOrThrow(const std::vector<int>& lens_in,
                                                [[maybe_unused]] const std::string& err_msg)
 {
@@ -157,20 +165,19 @@ std::size_t GetVectorLengthForLayout(const std::optional<miopenTensorLayout_t>&
     return vector_length;
 }
 
-void ReorderVector(std::vector<size_t>& lens, const std::initializer_list<size_t>& indices)
+void ReorderVector(TensorDims& lens, const std::initializer_list<size_t>& indices)
 {
-    std::vector<size_t> out_lens;
-    out_lens.reserve(indices.size());
+    TensorDims out_lens;
     for(size_t index : indices)
     {
         assert(index < lens.size());
         out_lens.push_back(lens[index]);
     }
-    lens = std::move(out_lens);
+    lens = out_lens;
 }
 
 // Relevant for NCHWc and CHWNc
-void VectLensReorder(miopenTensorLayout_t layout, std::vector<size_t>& lens)
+void VectLensReorder(miopenTensorLayout_t layout, TensorDims& lens)
 {
     switch(layout)
     {
@@ -188,9 +195,7 @@ void VectLensReorder(miopenTensorLayout_t layout, std::vector<size_t>& lens)
 }
 
 // Relevant for NCHWc and CHWNc
-void VectLensRecalc(miopenTensorLayout_t layout,
-                    std::size_t vector_length,
-                    std::vector<size_t>& lens)
+void VectLensRecalc(miopenTensorLayout_t layout, std::size_t vector_length, TensorDims& lens)
 {
     unsigned c_pos;
 
@@ -211,9 +216,7 @@ void VectLensRecalc(miopenTensorLayout_t layout,
     lens[c_pos] /= vector_length;
 }
 
-void CalculateStrides(std::size_t vector_length,
-                      const std::vector<size_t>& lens,
-                      std::vector<size_t>& strides)
+void CalculateStrides(std::size_t vector_length, const TensorDims& lens, TensorDims& strides)
 {
     if(lens.empty())
         MIOPEN_THROW(miopenStatusInternalError);
@@ -228,8 +231,8 @@ void CalculateStrides(std::size_t vector_length,
 
 void SetStrides(const std::optional<miopenTensorLayout_t>& layout,
                 std::size_t vector_length,
-                const std::vector<size_t>& lens,
-                std::vector<size_t>& strides)
+                const TensorDims& lens,
+                TensorDims& strides)
 {
     const bool is_vectorized = vector_length > 1;
     if(!layout || layout == miopenTensorNCHW || layout == miopenTensorNCDHW || is_vectorized)
@@ -245,7 +248,7 @@ void SetStrides(const std::optional<miopenTensorLayout_t>& layout,
     }
 }
 
-bool CheckDimsFitIntoInt(const std::vector<std::size_t>& v)
+bool CheckDimsFitIntoInt(const TensorDims& v)
 {
     if(std::any_of(
            v.cbegin(), v.cend(), [](std::size_t x) { return x > std::numeric_limits<int>::max(); }))
@@ -257,6 +260,9 @@ bool CheckDimsFitIntoInt(const std::vector<std::size_t>& v)
 
 } // namespace
 
+static_assert(std::is_trivially_copyable_v<TensorDescriptor>,
+              "TensorDescriptor is copied on every problem construction, keep it allocation free");
+
 TensorDescriptor::TensorDescriptor() : packed(true) {}
 
 TensorDescriptor::TensorDescriptor(miopenDataType_t t) : packed(true), type(t) {}
@@ -294,6 +300,11 @@ TensorDescriptor::TensorDescriptor(miopenDataType_t t, std::vector<std::size_t>&
 {
 }
 
+TensorDescriptor::TensorDescriptor(miopenDataType_t t, const TensorDims& lens_in)
+    : TensorDescriptor(t, GetDefaultLayout(lens_in.size()), lens_in, {}, false)
+{
+}
+
 TensorDescriptor::TensorDescriptor(miopenDataType_t t,
                                    miopenTensorLayout_t layout_in,
                                    const std::vector<int>& lens_in)
@@ -352,6 +363,13 @@ TensorDescriptor::TensorDescriptor(miopenDataType_t t,
 {
 }
 
+TensorDescriptor::TensorDescriptor(miopenDataType_t t,
+                                   const TensorDims& lens_in,
+                                   const TensorDims& strides_in)
+    : TensorDescriptor(t, std::nullopt, lens_in, strides_in, true)
+{
+}
+
 TensorDescriptor::TensorDescriptor(miopenDataType_t t,
                                    miopenTensorLayout_t layout_in,
                                    const std::vector<std::size_t>& lens_in,
@@ -374,8 +392,8 @@ TensorDescriptor::TensorDescriptor(miopenDataType_t t,
                                    const std::vector<std::size_t>& lens_in,
                                    const std::vector<std::size_t>& strides_in,
                                    bool use_strides)
-    : lens(lens_in),
-      strides(use_strides ? strides_in : std::vector<std::size_t>()),
+    : lens(MakeDimsOrThrow(lens_in)),
+      strides(use_strides ? MakeDimsOrThrow(strides_in) : TensorDims{}),
       type(t),
       tensorLayout(layout_in)
 {
@@ -387,8 +405,21 @@ TensorDescriptor::TensorDescriptor(miopenDataType_t t,
                                    std::vector<std::size_t>&& lens_in,
                                    std::vector<std::size_t>&& strides_in,
                                    bool use_strides)
-    : lens(std::move(lens_in)),
-      strides(use_strides ? std::move(strides_in) : std::vector<std::size_t>()),
+    : lens(MakeDimsOrThrow(lens_in)),
+      strides(use_strides ? MakeDimsOrThrow(strides_in) : TensorDims{}),
+      type(t),
+      tensorLayout(layout_in)
+{
+    this->CheckArgsAndInit(use_strides);
+}
+
+TensorDescriptor::TensorDescriptor(miopenDataType_t t,
+                                   const std::optional<miopenTensorLayout_t>& layout_in,
+                                   const TensorDims& lens_in,
+                                   const TensorDims& strides_in,
+                                   bool use_strides)
+    : lens(lens_in),
+      strides(use_strides ? strides_in : TensorDims{}),
       type(t),
       tensorLayout(layout_in)
 {
@@ -509,9 +540,9 @@ TensorDescriptor TensorDescriptor::MakeDescriptor(miopenDataType_t t,
 
 bool TensorDescriptor::IsVectorized() const { return vector_length > 1; }
 
-const std::vector<std::size_t>& TensorDescriptor::GetLengths() const { return lens; }
+const TensorDims& TensorDescriptor::GetLengths() const { return lens; }
 
-const std::vector<std::size_t>& TensorDescriptor::GetStrides() const { return strides; }
+const TensorDims& TensorDescriptor::GetStrides() const { return strides; }
 
 unsigned TensorDescriptor::GetNumDims() const { return lens.size(); }
 
@@ -584,11 +615,11 @@ std::string TensorDescriptor::LayoutEnumToStr(miopenTensorLayout_t layout)
     }
 }
 
-const std::string& TensorDescriptor::GetLayout_str() const
+std::string_view TensorDescriptor::GetLayout_str() const
 {
     if(cached_layout_str.empty())
     {
-        cached_layout_str = [&]() -> std::string {
+        const auto layout_str = [&]() -> std::string {
             if(tensorLayout)
                 return TensorDescriptor::LayoutEnumToStr(tensorLayout.value());
 
@@ -599,9 +630,10 @@ const std::string& TensorDescriptor::GetLayout_str() const
             default: return "UNKNOWN";
             }
         }();
+        cached_layout_str = {layout_str.cbegin(), layout_str.cend()};
     }
 
-    return cached_layout_str;
+    return {cached_layout_str.data(), cached_layout_str.size()};
 }
 
 std::size_t TensorDescriptor::GetVectorLength() const { return this->vector_length; }
@@ -711,11 +743,14 @@ bool TensorDescriptor::IsPossibleLayout4D5D(const std::string& layout) const
     }
 }
 
+namespace {
+
 // See https://github.com/ROCm/MIOpen/pull/765#discussion_r596465551
-std::vector<int64_t> TensorDescriptor::find_permutation(const std::vector<std::size_t>& lens,
-                                                        const std::vector<std::size_t>& strides)
+template <class TResult, class TDims>
+TResult FindPermutation(const TDims& lens, const TDims& strides)
 {
-    std::vector<int64_t> result(lens.size());
+    TResult result;
+    result.resize(lens.size());
     std::iota(result.begin(), result.end(), 0);
     std::stable_sort(result.begin(), result.end(), by(std::greater<>{}, [&](auto x) {
                          return std::make_tuple(strides[x], lens[x]);
@@ -723,6 +758,14 @@ std::vector<int64_t> TensorDescriptor::find_permutation(const std::vector<std::s
     return result;
 }
 
+} // namespace
+
+std::vector<int64_t> TensorDescriptor::find_permutation(const std::vector<std::size_t>& lens,
+                                                        const std::vector<std::size_t>& strides)
+{
+    return FindPermutation<std::vector<int64_t>>(lens, strides);
+}
+
 // storage_layout must be NCHW or NCHWc for NCHWc, CHWN or CHWNc for CHWNc, NCHW for other 4D
 // layouts, NCDHW for 5D layouts
 std::string TensorDescriptor::GetLayout(std::string storage_layout) const
@@ -746,7 +789,7 @@ std::string TensorDescriptor::GetLayout(std::string storage_layout) const
     auto result = base_storage_layout;
 
     if(cached_permutation.size() == 0)
-        cached_permutation = find_permutation(lens, strides);
+        cached_permutation = FindPermutation<decltype(cached_permutation)>(lens, strides);
     const auto& p = cached_permutation;
 
     std::transform(
@@ -758,6 +801,36 @@ std::string TensorDescriptor::GetLayout(std::string storage_layout) const
     return result;
 }
 
+TensorLayoutCode TensorDescriptor::GetLayoutCode() const
+{
+    if(tensorLayout)
+    {
+        switch(tensorLayout.value())
+        {
+        case miopenTensorNCHW: return tensor_layout::NCHW;
+        case miopenTensorNHWC: return tensor_layout::NHWC;
+        case miopenTensorNCHWc4:
+        case miopenTensorNCHWc8: return tensor_layout::NCHWc;
+        case miopenTensorCHWN: return tensor_layout::CHWN;
+        case miopenTensorCHWNc4:
+        case miopenTensorCHWNc8: return tensor_layout::CHWNc;
+        case miopenTensorNCDHW: return tensor_layout::NCDHW;
+        case miopenTensorNDHWC: return tensor_layout::NDHWC;
+        default: MIOPEN_THROW(miopenStatusInternalError, "Unknown layout");
+        }
+    }
+
+    const auto num_dims = this->GetNumDims();
+    if(num_dims != 4 && num_dims != 5)
+        return {};
+
+    if(cached_permutation.size() == 0)
+        cached_permutation = FindPermutation<decltype(cached_permutation)>(lens, strides);
+
+    return TensorLayoutCode::FromPermutation(
+        num_dims == 4 ? "NCHW" : "NCDHW", cached_permutation, this->IsVectorized());
+}
+
 std::size_t TensorDescriptor::GetNumBytes() const
 {
     std::size_t typesize = GetTypeSize(this->type);
@@ -861,8 +934,8 @@ std::ostream& operator<<(std::ostream& stream, const TensorDescriptor& t)
 void to_json(nlohmann::json& j, const TensorDescriptor& descriptor)
 {
     j = nlohmann::json{
-        {"lengths", descriptor.lens},
-        {"strides", descriptor.strides},
+        {"lengths", std::vector<std::size_t>(descriptor.lens)},
+        {"strides", std::vector<std::size_t>(descriptor.strides)},
         {"packed", descriptor.packed},
         {"type", descriptor.type},
     };
@@ -870,8 +943,8 @@ void to_json(nlohmann::json& j, const TensorDescriptor& descriptor)
 
 void from_json(const nlohmann::json& j, TensorDescriptor& descriptor)
 {
-    j.at("lengths").get_to(descriptor.lens);
-    j.at("strides").get_to(descriptor.strides);
+    descriptor.lens    = MakeDimsOrThrow(j.at("lengths").get<std::vector<std::size_t>>());
+    descriptor.strides = MakeDimsOrThrow(j.at("strides").get<std::vector<std::size_t>>());
     j.at("packed").get_to(descriptor.packed);
     j.at("type").get_to(descriptor.type);
 }
@@ -938,7 +1011,7 @@ struct two_exp_ceiling_t
     }
 };
 
-static std::vector<std::size_t> get_worker_sizes(const std::vector<std::size_t>& data_sizes)
+static std::vector<std::size_t> get_worker_sizes(const TensorDims& data_sizes)
 {
     const std::size_t dim = data_sizes.size();
 
@@ -1156,7 +1229,7 @@ void ScaleTensor(const Handle& handle,
 
     std::string kernel_name = "SubTensorOpWithScalar" + std::to_string(yDim_flat) + "d";
 
-    const std::vector<std::size_t>& lens = yDesc_flat.GetLengths();
+    const auto& lens = yDesc_flat.GetLengths();
 
     std::string network_config = "scale " + std::to_string(yDesc_flat.GetType());
     for(auto& len : lens)
@@ -1332,7 +1405,7 @@ void CopyTensor(const Handle& handle,
     {
         std::string kernel_name = "SubTensorOpWithSubTensor" + std::to_string(srcDim_flat) + "d";
 
-        const std::vector<std::size_t>& lens = srcDesc_flat.GetLengths();
+        const auto& lens = srcDesc_flat.GetLengths();
 
         std::string network_config = "copy " + std::to_string(srcDesc_flat.GetType());
         for(auto& len : lens)
@@ -1549,7 +1622,7 @@ void CastTensor(const Handle& handle,
     {
         std::string kernel_name = "SubTensorOpWithCastTensor" + std::to_string(srcDim_flat) + "d";
 
-        const std::vector<std::size_t>& lens = srcDesc_flat.GetLengths();
+        const auto& lens = srcDesc_flat.GetLengths();
 
         // TODO: make proper network config
         std::string network_config = "cast " + std::to_string(srcDesc_flat.GetType()) +
@@ -1853,7 +1926,7 @@ void TransformTensor(const Handle& handle,
 
         std::string kernel_name = "SubTensorOpWithTransform" + std::to_string(yDim_flat) + "d";
 
-        const std::vector<std::size_t>& lens = yDesc_flat.GetLengths();
+        const auto& lens = yDesc_flat.GetLengths();
 
         std::string network_config = "transform " + std::to_string(yDesc_flat.GetType());
         for(auto& len : lens)
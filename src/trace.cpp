@@ -0,0 +1,336 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/trace.hpp>
+
+#include <miopen/env.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/logger.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+/// Enables tracing and writes the events to the given file in Chrome trace JSON format,
+/// which can be loaded into chrome://tracing or Perfetto.
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_TRACE_FILE)
+
+namespace miopen {
+namespace trace {
+
+namespace {
+
+constexpr std::size_t buffer_capacity = 4096;
+
+struct ThreadBuffer
+{
+    std::uint64_t tid = 0;
+    RingBuffer<Record, buffer_capacity> records;
+    std::atomic<std::uint64_t> dropped{0};
+    /// Set when the thread exits, the buffer is released once drained.
+    std::atomic<bool> retired{false};
+};
+
+struct Registry
+{
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    /// Serializes the consumers, the ring buffers have a single one.
+    std::mutex drain_mutex;
+};
+
+// Never destroyed: threads may still be emitting while the process exits.
+Registry& GetRegistry()
+{
+    static auto* const registry = new Registry{};
+    return *registry;
+}
+
+std::uint64_t GetThreadId()
+{
+#ifdef __linux__
+    return syscall(SYS_gettid); // NOLINT
+#else
+    return std::hash<std::thread::id>{}(std::this_thread::get_id());
+#endif
+}
+
+int GetProcessId()
+{
+#ifdef __linux__
+    return getpid();
+#else
+    return 0; // Not implemented.
+#endif
+}
+
+std::uint64_t Now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/// Registers the buffer of the calling thread and retires it when the thread exits.
+/// Retired buffers which still hold events are released by the next Drain().
+class ThreadBufferOwner
+{
+public:
+    ThreadBufferOwner() : buffer(std::make_shared<ThreadBuffer>())
+    {
+        buffer->tid    = GetThreadId();
+        auto& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.buffers.push_back(buffer);
+    }
+
+    ThreadBufferOwner(const ThreadBufferOwner&) = delete;
+    ThreadBufferOwner& operator=(const ThreadBufferOwner&) = delete;
+
+    ~ThreadBufferOwner()
+    {
+        buffer->retired.store(true, std::memory_order_release);
+        if(buffer->records.Size() != 0)
+            return;
+        auto& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        auto& buffers = registry.buffers;
+        buffers.erase(std::remove(buffers.begin(), buffers.end(), buffer), buffers.end());
+    }
+
+    ThreadBuffer& Get() const { return *buffer; }
+
+private:
+    std::shared_ptr<ThreadBuffer> buffer;
+};
+
+ThreadBuffer& GetThreadBuffer()
+{
+    thread_local const ThreadBufferOwner owner;
+    return owner.Get();
+}
+
+/// Periodically drains the ring buffers into the file.
+class FileWriter
+{
+public:
+    explicit FileWriter(const fs::path& path) : file(path)
+    {
+        if(!file)
+        {
+            MIOPEN_LOG_W("Unable to open trace file: " << path);
+            return;
+        }
+        file << "[\n";
+        thread = std::thread([this]() { Run(); });
+    }
+
+    FileWriter(const FileWriter&) = delete;
+    FileWriter& operator=(const FileWriter&) = delete;
+
+    ~FileWriter()
+    {
+        if(!thread.joinable())
+            return;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        cv.notify_one();
+        thread.join();
+        Flush();
+        file << "\n]\n";
+    }
+
+private:
+    void Run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while(!stop)
+        {
+            cv.wait_for(lock, std::chrono::milliseconds{100}, [this]() { return stop; });
+            lock.unlock();
+            Flush();
+            lock.lock();
+        }
+    }
+
+    void Flush()
+    {
+        records.clear();
+        const auto dropped = Drain(records);
+        if(dropped != 0)
+            MIOPEN_LOG_W("Trace buffers overflowed, " << dropped << " events dropped");
+        if(records.empty())
+            return;
+        WriteChromeTrace(file, records, first);
+        first = false;
+        file.flush();
+    }
+
+    std::ofstream file;
+    std::vector<ThreadRecord> records;
+    bool first = true;
+    bool stop  = false;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::thread thread;
+};
+
+std::atomic<bool>& EnabledFlag()
+{
+    static std::atomic<bool> enabled = []() {
+        const auto path = env::value(MIOPEN_TRACE_FILE);
+        if(path.empty())
+            return false;
+        static FileWriter writer{path};
+        return true;
+    }();
+    return enabled;
+}
+
+} // namespace
+
+bool IsEnabled() { return EnabledFlag().load(std::memory_order_relaxed); }
+
+void Enable(bool enable) { EnabledFlag().store(enable, std::memory_order_relaxed); }
+
+void Emit(Event event, Phase phase, const char* name, std::uint64_t arg)
+{
+    auto& buffer = GetThreadBuffer();
+    if(!buffer.records.TryPush({Now(), name, arg, event, phase}))
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+const char* Intern(std::string_view str)
+{
+    static std::mutex mutex;
+    static auto* const strings = new std::unordered_set<std::string>{};
+    std::lock_guard<std::mutex> lock(mutex);
+    return strings->emplace(str).first->c_str();
+}
+
+const char* GetEventName(Event event)
+{
+    switch(event)
+    {
+    case Event::SolverConsidered: return "SolverConsidered";
+    case Event::SolverNotApplicable: return "SolverNotApplicable";
+    case Event::FindDbHit: return "FindDbHit";
+    case Event::FindDbMiss: return "FindDbMiss";
+    case Event::PerfDbHit: return "PerfDbHit";
+    case Event::PerfDbMiss: return "PerfDbMiss";
+    case Event::Compile: return "Compile";
+    case Event::KernelLaunch: return "KernelLaunch";
+    }
+    return "<Unknown>";
+}
+
+std::uint64_t Drain(std::vector<ThreadRecord>& records)
+{
+    auto& registry = GetRegistry();
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        buffers = registry.buffers;
+    }
+
+    std::lock_guard<std::mutex> drain_lock(registry.drain_mutex);
+    std::uint64_t dropped = 0;
+    std::vector<std::shared_ptr<ThreadBuffer>> drained;
+    for(const auto& buffer : buffers)
+    {
+        // Checked before popping: a retired buffer gets no new events
+        const auto retired = buffer->retired.load(std::memory_order_acquire);
+        Record record;
+        while(buffer->records.TryPop(record))
+            records.push_back({buffer->tid, record});
+        dropped += buffer->dropped.exchange(0, std::memory_order_relaxed);
+        if(retired)
+            drained.push_back(buffer);
+    }
+
+    if(!drained.empty())
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        auto& registered = registry.buffers;
+        registered.erase(std::remove_if(registered.begin(),
+                                        registered.end(),
+                                        [&](const auto& buffer) {
+                                            return std::find(drained.begin(),
+                                                             drained.end(),
+                                                             buffer) != drained.end();
+                                        }),
+                         registered.end());
+    }
+    return dropped;
+}
+
+std::size_t GetNumThreadBuffers()
+{
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.buffers.size();
+}
+
+void WriteChromeTrace(std::ostream& os, const std::vector<ThreadRecord>& records, bool first)
+{
+    const auto pid = GetProcessId();
+    for(const auto& [tid, record] : records)
+    {
+        auto event = nlohmann::json{
+            {"name", record.name != nullptr ? record.name : GetEventName(record.event)},
+            {"cat", GetEventName(record.event)},
+            {"ph", std::string(1, static_cast<char>(record.phase))},
+            {"ts", static_cast<double>(record.timestamp) / 1000.0},
+            {"pid", pid},
+            {"tid", tid},
+            {"args", {{"arg", record.arg}}},
+        };
+        if(record.phase == Phase::Instant)
+            event["s"] = "t";
+        if(!first)
+            os << ",\n";
+        os << event.dump();
+        first = false;
+    }
+}
+
+} // namespace trace
+} // namespace miopen
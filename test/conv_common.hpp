@@ -184,7 +184,7 @@ tensor<Tout> get_output_tensor(const miopen::ConvolutionDescriptor& filter,
                                const std::string& out_layout)
 {
 
-    std::string yLayout = out_layout.empty() ? input.desc.GetLayout_str() : out_layout;
+    std::string yLayout = out_layout.empty() ? std::string{input.desc.GetLayout_str()} : out_layout;
     return tensor<Tout>{filter.GetForwardOutputTensorWithLayout(
         input.desc, weights.desc, yLayout, miopen_type<Tout>{})};
 }
@@ -2081,7 +2081,7 @@ struct conv_driver : test_driver
         // but this requires the dimensions come from commandline, which is hard for non-NCHW layout
         if(in_layout != "NCHW" && in_layout != "NCDHW")
         {
-            const std::vector<std::size_t> dim_lens = input.desc.GetLengths();
+            const std::vector<std::size_t> dim_lens(input.desc.GetLengths());
             std::vector<std::size_t> dim_strides;
             miopen::tensor_layout_to_strides(
                 dim_lens,
@@ -2093,7 +2093,7 @@ struct conv_driver : test_driver
         }
         if(fil_layout != "NCHW" && fil_layout != "NCDHW" && fil_layout != "CHWN")
         {
-            const std::vector<std::size_t> dim_lens = weights.desc.GetLengths();
+            const std::vector<std::size_t> dim_lens(weights.desc.GetLengths());
             std::vector<std::size_t> dim_strides;
             miopen::tensor_layout_to_strides(
                 dim_lens,
@@ -27,11 +27,13 @@
 #include "test.hpp"
 #include "driver.hpp"
 #include "get_handle.hpp"
+#include "verify.hpp"
 #include "workspace.hpp"
 #include <miopen/env.hpp>
 
 #include <miopen/miopen.h>
 
+#include <miopen/check_numerics.hpp>
 #include <miopen/convolution.hpp>
 #include <miopen/solution.hpp>
 
@@ -108,13 +110,32 @@ private:
 
         x = tensor<float>{16, 192, 28, 28}.generate(tensor_elem_gen_integer{17});
         w = tensor<float>{32, 192, 5, 5}.generate(tensor_elem_gen_integer{17});
-        y = tensor<float>{filter.GetForwardOutputTensor(x.desc, w.desc)};
+        y = tensor<float>{filter.GetForwardOutputTensor(x.desc, w.desc)}.generate(
+            tensor_elem_gen_integer{17});
 
         x_dev = handle_deref.Write(x.data);
         w_dev = handle_deref.Write(w.data);
         y_dev = handle_deref.Write(y.data);
     }
 
+    struct ConvOutput
+    {
+        std::size_t index; // in the X, W, Y argument order
+        const Allocator::ManageDataPtr* buffer;
+        std::size_t size;
+    };
+
+    ConvOutput GetOutput() const
+    {
+        switch(direction)
+        {
+        case miopenProblemDirectionForward: return {2, &y_dev, y.data.size()};
+        case miopenProblemDirectionBackward: return {0, &x_dev, x.data.size()};
+        case miopenProblemDirectionBackwardWeights: return {1, &w_dev, w.data.size()};
+        default: MIOPEN_THROW(miopenStatusNotImplemented);
+        }
+    }
+
     void TestConv()
     {
         miopenHandle_t handle = &get_handle();
@@ -361,6 +382,65 @@ private:
         checked_run_solution(descriptors);
 
         std::cerr << "Ran a solution." << std::endl;
+
+        std::cerr << "Running a bound solution..." << std::endl;
+
+        {
+            auto& handle_deref  = get_handle();
+            const auto output   = GetOutput();
+            const auto expected = handle_deref.Read<float>(*output.buffer, output.size);
+
+            // The bound runs write to their own output buffer, so that it only holds what they
+            // computed from the same inputs as miopenRunSolution.
+            auto bound_output           = handle_deref.Write(std::vector<float>(output.size));
+            auto bound_buffers          = std::vector<void*>(buffers, buffers + num_arguments);
+            bound_buffers[output.index] = bound_output.get();
+
+            auto arguments = std::make_unique<miopenTensorArgument_t[]>(num_arguments);
+
+            for(auto i = 0; i < num_arguments; ++i)
+            {
+                arguments[i].id         = names[i];
+                arguments[i].descriptor = &descriptors[i];
+                arguments[i].buffer     = nullptr;
+            }
+
+            miopenBoundSolution_t bound;
+            EXPECT_EQUAL(miopenBindSolution(&bound, solution, num_arguments, arguments.get()),
+                         miopenStatusSuccess);
+
+            // The first run prepares the invoker, the following ones take the bound path.
+            for(auto i = 0; i < 3; ++i)
+                EXPECT_EQUAL(miopenRunBoundSolution(
+                                 handle, bound, bound_buffers.data(), wspace.ptr(), wspace.size()),
+                             miopenStatusSuccess);
+
+            const auto actual = handle_deref.Read<float>(bound_output, output.size);
+            EXPECT_OP(miopen::rms_range(expected, actual), <=, 1e-6);
+
+            if(workspace_size > 0)
+                EXPECT_EQUAL(
+                    miopenRunBoundSolution(handle, bound, bound_buffers.data(), nullptr, 0),
+                    miopenStatusBadParm);
+
+            // The cached invoker belongs to the handle of the first run.
+            if(!miopen::CheckNumericsEnabled())
+            {
+                miopenHandle_t other_handle;
+                EXPECT_EQUAL(miopenCreate(&other_handle), miopenStatusSuccess);
+                EXPECT_EQUAL(miopenRunBoundSolution(other_handle,
+                                                    bound,
+                                                    bound_buffers.data(),
+                                                    wspace.ptr(),
+                                                    wspace.size()),
+                             miopenStatusBadParm);
+                EXPECT_EQUAL(miopenDestroy(other_handle), miopenStatusSuccess);
+            }
+
+            EXPECT_EQUAL(miopenDestroyBoundSolution(bound), miopenStatusSuccess);
+        }
+
+        std::cerr << "Ran a bound solution." << std::endl;
     }
 };
 } // namespace miopen
@@ -27,8 +27,13 @@
 #define GUARD_GEMM_HPP
 
 #include "ford.hpp"
+#include <miopen/par_for.hpp>
 #include <miopen/returns.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
 template <class AF, class BF, class CF>
 void gemm(std::size_t n, std::size_t m, std::size_t k, AF a, BF b, CF c)
 {
@@ -66,4 +71,120 @@ template <class T>
 auto with_stride(T* data, std::size_t stride) MIOPEN_RETURNS(
     std::bind(with_stride_impl{}, data, stride, std::placeholders::_1, std::placeholders::_2));
 
+namespace host_gemm {
+
+/// Cache blocking of the host GEMM: an MC x KC panel of A and a KC x NC panel of B are
+/// packed into contiguous buffers of the accumulation type and multiplied into an
+/// MC x NC accumulator tile.
+constexpr std::size_t block_m = 64;
+constexpr std::size_t block_n = 128;
+constexpr std::size_t block_k = 256;
+
+/// Below this number of multiply-adds threads cost more than they save.
+constexpr std::size_t min_parallel_work = std::size_t{1} << 18;
+
+/// Computes, for every batch, the row-major product
+///     C(m x n) = alpha * op(A)(m x k) * op(B)(k x n) + beta * C
+/// where op(X) is X or its transpose and the leading dimensions refer to the stored
+/// (non-transposed) matrices. Inputs of any element type are converted to `Tacc` while
+/// packing, so fp16/bf16/fp8 inputs accumulate in fp32 or double. Every element of C is
+/// summed over k in order, so results do not depend on blocking or the thread count.
+/// C is not read when beta is zero.
+template <class Tacc = double, class Ta, class Tb, class Tc>
+void gemm_strided_batched(bool trans_a,
+                          bool trans_b,
+                          std::size_t m,
+                          std::size_t n,
+                          std::size_t k,
+                          double alpha,
+                          const Ta* a,
+                          std::size_t lda,
+                          std::size_t stride_a,
+                          const Tb* b,
+                          std::size_t ldb,
+                          std::size_t stride_b,
+                          double beta,
+                          Tc* c,
+                          std::size_t ldc,
+                          std::size_t stride_c,
+                          std::size_t batch_count = 1)
+{
+    if(m == 0 || n == 0 || batch_count == 0)
+        return;
+
+    const std::size_t m_blocks = (m + block_m - 1) / block_m;
+    const std::size_t n_blocks = (n + block_n - 1) / block_n;
+    const std::size_t tasks    = batch_count * m_blocks * n_blocks;
+
+    auto tile = [&](std::size_t task) {
+        const std::size_t batch = task / (m_blocks * n_blocks);
+        const std::size_t i0    = (task / n_blocks % m_blocks) * block_m;
+        const std::size_t j0    = (task % n_blocks) * block_n;
+        const std::size_t mc    = std::min(block_m, m - i0);
+        const std::size_t nc    = std::min(block_n, n - j0);
+
+        const Ta* a_batch = a + batch * stride_a;
+        const Tb* b_batch = b + batch * stride_b;
+        Tc* c_batch       = c + batch * stride_c;
+
+        auto a_at = [&](std::size_t i, std::size_t p) {
+            return trans_a ? a_batch[p * lda + i] : a_batch[i * lda + p];
+        };
+        auto b_at = [&](std::size_t p, std::size_t j) {
+            return trans_b ? b_batch[j * ldb + p] : b_batch[p * ldb + j];
+        };
+
+        std::vector<Tacc> acc(mc * nc, Tacc{0});
+        std::vector<Tacc> a_pack(mc * std::min(block_k, k));
+        std::vector<Tacc> b_pack(std::min(block_k, k) * nc);
+
+        for(std::size_t p0 = 0; p0 < k; p0 += block_k)
+        {
+            const std::size_t kc = std::min(block_k, k - p0);
+
+            for(std::size_t i = 0; i < mc; ++i)
+                for(std::size_t p = 0; p < kc; ++p)
+                    a_pack[i * kc + p] = static_cast<Tacc>(a_at(i0 + i, p0 + p));
+
+            for(std::size_t p = 0; p < kc; ++p)
+                for(std::size_t j = 0; j < nc; ++j)
+                    b_pack[p * nc + j] = static_cast<Tacc>(b_at(p0 + p, j0 + j));
+
+            for(std::size_t i = 0; i < mc; ++i)
+            {
+                Tacc* acc_row = &acc[i * nc];
+                for(std::size_t p = 0; p < kc; ++p)
+                {
+                    const Tacc a_ip   = a_pack[i * kc + p];
+                    const Tacc* b_row = &b_pack[p * nc];
+                    for(std::size_t j = 0; j < nc; ++j)
+                        acc_row[j] += a_ip * b_row[j];
+                }
+            }
+        }
+
+        for(std::size_t i = 0; i < mc; ++i)
+        {
+            for(std::size_t j = 0; j < nc; ++j)
+            {
+                Tc& dst        = c_batch[(i0 + i) * ldc + j0 + j];
+                const double r = alpha * static_cast<double>(acc[i * nc + j]);
+                dst = static_cast<Tc>(beta == 0.0 ? r : beta * static_cast<double>(dst) + r);
+            }
+        }
+    };
+
+    if(tasks > 1 && batch_count * m * n * k >= min_parallel_work)
+    {
+        miopen::par_for(tasks, miopen::min_grain{1}, tile);
+    }
+    else
+    {
+        for(std::size_t task = 0; task < tasks; ++task)
+            tile(task);
+    }
+}
+
+} // namespace host_gemm
+
 #endif
@@ -73,7 +73,7 @@ protected:
 
         ASSERT_GE(dstSuperTensor.desc.GetNumDims(), lens.size());
 
-        const std::vector<size_t>& dstSuperStrides = dstSuperTensor.desc.GetStrides();
+        const auto& dstSuperStrides = dstSuperTensor.desc.GetStrides();
         std::vector<size_t> dstStrides(dstSuperStrides.begin() +
                                            (dstSuperTensor.desc.GetNumDims() - lens.size()),
                                        dstSuperStrides.end());
@@ -85,7 +85,7 @@ protected:
 
         ASSERT_GE(srcSuperTensor.desc.GetNumDims(), lens.size());
 
-        const std::vector<size_t>& srcSuperStrides = srcSuperTensor.desc.GetStrides();
+        const auto& srcSuperStrides = srcSuperTensor.desc.GetStrides();
         std::vector<size_t> srcStrides(srcSuperStrides.begin() +
                                            (srcSuperTensor.desc.GetNumDims() - lens.size()),
                                        srcSuperStrides.end());
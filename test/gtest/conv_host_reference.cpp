@@ -0,0 +1,200 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <gtest/gtest.h>
+#include <miopen/any_solver.hpp>
+#include <miopen/config.h>
+#include <miopen/conv/data_invoke_params.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/conv/solvers.hpp>
+#include <miopen/conv/wrw_invoke_params.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/find_solution.hpp>
+#include <miopen/solver_id.hpp>
+
+#include "cpu_conv.hpp"
+#include "get_handle.hpp"
+#include "tensor_holder.hpp"
+
+namespace {
+
+/// Grouped, padded, strided and dilated, so that every index mapping of the
+/// host solvers is exercised. Integer data keeps both references exact.
+struct HostReferenceConv
+{
+    miopen::ConvolutionDescriptor conv{{1, 1}, {2, 1}, {1, 2}, {0, 0}, 2};
+    tensor<float> x{std::vector<std::size_t>{2, 4, 9, 8}};
+    tensor<float> w{std::vector<std::size_t>{6, 2, 3, 3}};
+    tensor<float> y{conv.GetForwardOutputTensor(x.desc, w.desc).GetLengths()};
+
+    HostReferenceConv()
+    {
+        x.generate(tensor_elem_gen_integer{7});
+        w.generate(tensor_elem_gen_integer{5});
+        y.generate(tensor_elem_gen_integer{3});
+    }
+
+    miopen::conv::ProblemDescription Problem(miopen::conv::Direction direction) const
+    {
+        if(direction == miopen::conv::Direction::Forward)
+            return {x.desc, w.desc, y.desc, conv, direction};
+        return {y.desc, w.desc, x.desc, conv, direction};
+    }
+
+    template <class Solver, class InvokeParams>
+    void Run(const Solver& solver, miopen::conv::Direction direction, const InvokeParams& params)
+    {
+        const auto ctx     = miopen::ExecutionContext{};
+        const auto problem = Problem(direction);
+        const auto invoker = (*solver.GetSolution(ctx, problem).invoker_factory)({});
+        invoker(get_handle(), params);
+    }
+};
+
+} // namespace
+
+TEST(CPU_ConvHostReference_FP32, Forward)
+{
+    auto t   = HostReferenceConv{};
+    auto ref = t.y;
+    cpu_convolution_forward(2,
+                            t.x,
+                            t.w,
+                            ref,
+                            t.conv.GetConvPads(),
+                            t.conv.GetConvStrides(),
+                            t.conv.GetConvDilations(),
+                            t.conv.group_count);
+
+    const auto tensors = miopen::ConvDataTensors{
+        t.x.desc, t.x.data.data(), t.w.desc, t.w.data.data(), t.y.desc, t.y.data.data()};
+    t.Run(miopen::solver::conv::ConvHostReferenceFwd{},
+          miopen::conv::Direction::Forward,
+          miopen::conv::DataInvokeParams{tensors, nullptr, 0, false});
+
+    EXPECT_EQ(t.y.data, ref.data);
+}
+
+TEST(CPU_ConvHostReference_FP32, BackwardData)
+{
+    auto t   = HostReferenceConv{};
+    auto ref = t.x;
+    cpu_convolution_backward_data(2,
+                                  ref,
+                                  t.w,
+                                  t.y,
+                                  t.conv.GetConvPads(),
+                                  t.conv.GetConvStrides(),
+                                  t.conv.GetConvDilations(),
+                                  t.conv.group_count);
+
+    /// \ref backward_tensors_reversed_why
+    const auto tensors = miopen::ConvDataTensors{
+        t.y.desc, t.y.data.data(), t.w.desc, t.w.data.data(), t.x.desc, t.x.data.data()};
+    t.Run(miopen::solver::conv::ConvHostReferenceBwd{},
+          miopen::conv::Direction::BackwardData,
+          miopen::conv::DataInvokeParams{tensors, nullptr, 0, false});
+
+    EXPECT_EQ(t.x.data, ref.data);
+}
+
+TEST(CPU_ConvHostReference_FP32, BackwardWeights)
+{
+    auto t   = HostReferenceConv{};
+    auto ref = t.w;
+    cpu_convolution_backward_weight(2,
+                                    t.x,
+                                    ref,
+                                    t.y,
+                                    t.conv.GetConvPads(),
+                                    t.conv.GetConvStrides(),
+                                    t.conv.GetConvDilations(),
+                                    t.conv.group_count);
+
+    const auto tensors = miopen::ConvWrwTensors{
+        t.y.desc, t.y.data.data(), t.x.desc, t.x.data.data(), t.w.desc, t.w.data.data()};
+    t.Run(miopen::solver::conv::ConvHostReferenceWrw{},
+          miopen::conv::Direction::BackwardWeights,
+          miopen::conv::WrWInvokeParams{tensors, nullptr, 0, false});
+
+    EXPECT_EQ(t.w.data, ref.data);
+}
+
+TEST(CPU_ConvHostReference_FP32, NogpuBuffersCarryData)
+{
+#if MIOPEN_MODE_NOGPU
+    auto& handle = get_handle();
+    auto t       = HostReferenceConv{};
+    auto ref     = t.y;
+    cpu_convolution_forward(2,
+                            t.x,
+                            t.w,
+                            ref,
+                            t.conv.GetConvPads(),
+                            t.conv.GetConvStrides(),
+                            t.conv.GetConvDilations(),
+                            t.conv.group_count);
+
+    // Write, device to device copy, invoke on the device buffers and read back.
+    auto x_dev      = handle.Write(t.x.data);
+    auto x_copy_dev = handle.Create<float>(t.x.data.size());
+    handle.Copy(x_dev.get(), x_copy_dev.get(), t.x.data.size() * sizeof(float));
+    auto w_dev = handle.Write(t.w.data);
+    auto y_dev = handle.Create<float>(t.y.data.size());
+
+    const auto tensors = miopen::ConvDataTensors{
+        t.x.desc, x_copy_dev.get(), t.w.desc, w_dev.get(), t.y.desc, y_dev.get()};
+    t.Run(miopen::solver::conv::ConvHostReferenceFwd{},
+          miopen::conv::Direction::Forward,
+          miopen::conv::DataInvokeParams{tensors, nullptr, 0, false});
+
+    EXPECT_EQ(handle.Read<float>(x_copy_dev, t.x.data.size()), t.x.data);
+    EXPECT_EQ(handle.Read<float>(y_dev, t.y.data.size()), ref.data);
+#else
+    GTEST_SKIP() << "Device buffers are host memory only in the nogpu build";
+#endif
+}
+
+TEST(CPU_ConvHostReference_FP32, NogpuKernelSolversSuperseded)
+{
+#if MIOPEN_MODE_NOGPU
+    const auto t       = HostReferenceConv{};
+    const auto ctx     = miopen::ExecutionContext{&get_handle()};
+    const auto problem = t.Problem(miopen::conv::Direction::Forward);
+    const auto host    = miopen::solver::conv::ConvHostReferenceFwd{};
+    const auto kernel  = miopen::solver::conv::ConvDirectNaiveConvFwd{};
+    if(!kernel.IsApplicable(ctx, problem))
+        GTEST_SKIP() << kernel.SolverDbId() << " does not handle the problem";
+
+    // Both the Find path and the immediate mode path only see the host solver.
+    EXPECT_TRUE(miopen::solver::IsApplicableCounted(host, ctx, problem));
+    EXPECT_FALSE(miopen::solver::IsApplicableCounted(kernel, ctx, problem));
+    EXPECT_TRUE(miopen::solver::Id{host.SolverDbId()}.GetSolver().IsApplicable(ctx, problem));
+    EXPECT_FALSE(miopen::solver::Id{kernel.SolverDbId()}.GetSolver().IsApplicable(ctx, problem));
+#else
+    GTEST_SKIP() << "Host solvers are applicable only in the nogpu build";
+#endif
+}
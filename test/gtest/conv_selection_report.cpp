@@ -0,0 +1,80 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/conv/selection_report.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/solver_id.hpp>
+#include <miopen/tensor.hpp>
+
+#include <gtest/gtest.h>
+
+#include "get_handle.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+TEST(GPU_ConvSelectionReport_FP32, CoversEverySolver)
+{
+    auto&& handle = get_handle();
+
+    const auto x    = miopen::TensorDescriptor{miopenFloat, {1, 16, 14, 14}};
+    const auto w    = miopen::TensorDescriptor{miopenFloat, {16, 16, 3, 3}};
+    const auto y    = miopen::TensorDescriptor{miopenFloat, {1, 16, 14, 14}};
+    const auto conv = miopen::ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}};
+
+    const auto problem =
+        miopen::conv::ProblemDescription{x, w, y, conv, miopen::conv::Direction::Forward};
+    auto ctx = miopen::ExecutionContext{&handle};
+    problem.SetupFloats(ctx);
+
+    const auto report = miopen::conv::ExplainSelection(ctx, problem);
+
+    EXPECT_EQ(report.network_config, problem.MakeNetworkConfig().ToString());
+    ASSERT_EQ(report.solvers.size(),
+              miopen::solver::GetSolversByPrimitive(miopen::solver::Primitive::Convolution).size());
+
+    auto ranks = std::vector<int>{};
+    for(const auto& s : report.solvers)
+    {
+        EXPECT_FALSE(s.reason.empty()) << s.name;
+        if(s.rank == 0)
+            continue;
+        EXPECT_TRUE(s.applicable) << s.name;
+        ranks.push_back(s.rank);
+    }
+
+    // Ranks are unique and dense, starting with 1.
+    std::sort(ranks.begin(), ranks.end());
+    for(auto i = 0; i < static_cast<int>(ranks.size()); i++)
+        EXPECT_EQ(ranks[i], i + 1);
+
+    auto text = std::ostringstream{};
+    text << report;
+    EXPECT_NE(text.str().find(report.network_config), std::string::npos);
+    EXPECT_NE(report.ToJson().find("\"solvers\""), std::string::npos);
+}
@@ -27,6 +27,7 @@
 
 #include <gtest/gtest.h>
 #include <hip_float8.hpp>
+#include <miopen/tensor.hpp>
 
 #include "../random.hpp"
 
@@ -107,7 +108,7 @@ template <typename T, typename Tacc>
 struct GenConvData
 {
     /// \note CHWNc filter layout is not supported (different storage layout)
-    GenConvData(const std::vector<std::size_t>& filter, unsigned group_count = 1)
+    GenConvData(const miopen::TensorDims& filter, unsigned group_count = 1)
     {
         static_assert(std::is_integral_v<T> == std::is_integral_v<Tacc>);
         static_assert(sizeof(Tacc) >= sizeof(T));
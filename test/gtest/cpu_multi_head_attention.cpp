@@ -15,3 +15,142 @@ TEST_P(CPU_Mha_FP8, CPUMHATestFloat8Fw) {}
 INSTANTIATE_TEST_SUITE_P(Smoke, CPU_Mha_FP32, testing::ValuesIn(test::cpu::CPUMHAConfigs()));
 
 INSTANTIATE_TEST_SUITE_P(Smoke, CPU_Mha_FP8, testing::ValuesIn(test::cpu::CPUMHAConfigs()));
+
+namespace {
+
+using test::cpu::float8;
+
+void CheckTiledAgainstFull(float dropout_rate)
+{
+    const size_t n = 2, h = 3, s = 70, d = 8;
+    const uint64_t seed = 0xAAFFFFFFFFull, offset = 1;
+
+    auto q = test::cpu::GenScaledTensor<float8>(n, h, s, d);
+    auto k = test::cpu::GenScaledTensor<float8>(n, h, s, d);
+    auto v = test::cpu::GenScaledTensor<float8>(n, h, s, d);
+
+    tensor<float> softmax{n, h, s, s};
+    tensor<float> m_full{n, h, s, 1};
+    tensor<float> z_full{n, h, s, 1};
+    tensor<float8> o_full{n, h, s, d};
+    float amax_s_full = 0.0f, amax_o_full = 0.0f;
+    test::cpu::MultiHeadAttentionForwardfp8(q.mTensor,
+                                            k.mTensor,
+                                            v.mTensor,
+                                            softmax,
+                                            m_full,
+                                            z_full,
+                                            q.mDescale,
+                                            k.mDescale,
+                                            v.mDescale,
+                                            1.0f,
+                                            1.0f,
+                                            1.0f,
+                                            dropout_rate,
+                                            seed,
+                                            offset,
+                                            amax_s_full,
+                                            amax_o_full,
+                                            o_full);
+
+    tensor<float> m_tiled{n, h, s, 1};
+    tensor<float> z_tiled{n, h, s, 1};
+    tensor<float8> o_tiled{n, h, s, d};
+    float amax_s_tiled = 0.0f, amax_o_tiled = 0.0f;
+    test::cpu::MultiHeadAttentionForwardTiled(q.mTensor,
+                                              k.mTensor,
+                                              v.mTensor,
+                                              m_tiled,
+                                              z_tiled,
+                                              q.mDescale,
+                                              k.mDescale,
+                                              v.mDescale,
+                                              1.0f,
+                                              1.0f,
+                                              1.0f,
+                                              dropout_rate,
+                                              seed,
+                                              offset,
+                                              amax_s_tiled,
+                                              amax_o_tiled,
+                                              o_tiled);
+
+    EXPECT_LT(miopen::rms_range(m_full, m_tiled), 1e-6);
+    EXPECT_LT(miopen::rms_range(z_full, z_tiled), 1e-6);
+    EXPECT_LT(miopen::rms_range(o_full, o_tiled), 1e-4);
+    EXPECT_NEAR(amax_s_full, amax_s_tiled, 1e-6);
+    EXPECT_NEAR(amax_o_full, amax_o_tiled, 1e-4);
+
+    if(dropout_rate > 0.0f)
+        return;
+
+    auto dO = test::cpu::GenScaledTensorBackward<float8>(n, h, s, d);
+    tensor<float8> dq_full{n, h, s, d}, dk_full{n, h, s, d}, dv_full{n, h, s, d};
+    tensor<float8> dq_tiled{n, h, s, d}, dk_tiled{n, h, s, d}, dv_tiled{n, h, s, d};
+    float amax_full[4]  = {};
+    float amax_tiled[4] = {};
+
+    test::cpu::MultiHeadAttentionBackwardDataf8(q.mTensor,
+                                                k.mTensor,
+                                                v.mTensor,
+                                                o_full,
+                                                dO.mTensor,
+                                                softmax,
+                                                q.mDescale,
+                                                k.mDescale,
+                                                v.mDescale,
+                                                1.0f,
+                                                1.0f,
+                                                1.0f,
+                                                1.0f,
+                                                1.0f,
+                                                1.0f,
+                                                1.0f,
+                                                1.0f,
+                                                dO.mDescale,
+                                                amax_full[0],
+                                                amax_full[1],
+                                                amax_full[2],
+                                                amax_full[3],
+                                                dq_full,
+                                                dk_full,
+                                                dv_full);
+    test::cpu::MultiHeadAttentionBackwardDataTiled(q.mTensor,
+                                                   k.mTensor,
+                                                   v.mTensor,
+                                                   o_full,
+                                                   dO.mTensor,
+                                                   m_full,
+                                                   z_full,
+                                                   q.mDescale,
+                                                   k.mDescale,
+                                                   v.mDescale,
+                                                   1.0f,
+                                                   1.0f,
+                                                   1.0f,
+                                                   1.0f,
+                                                   1.0f,
+                                                   1.0f,
+                                                   1.0f,
+                                                   1.0f,
+                                                   dO.mDescale,
+                                                   amax_tiled[0],
+                                                   amax_tiled[1],
+                                                   amax_tiled[2],
+                                                   amax_tiled[3],
+                                                   dq_tiled,
+                                                   dk_tiled,
+                                                   dv_tiled);
+
+    EXPECT_LT(miopen::rms_range(dq_full, dq_tiled), 1e-4);
+    EXPECT_LT(miopen::rms_range(dk_full, dk_tiled), 1e-4);
+    EXPECT_LT(miopen::rms_range(dv_full, dv_tiled), 1e-4);
+    for(int i = 0; i < 4; ++i)
+        EXPECT_NEAR(amax_full[i], amax_tiled[i], 1e-4 * std::max(1.0f, amax_full[i]));
+}
+
+} // namespace
+
+TEST(CPU_MhaTiledReference_FP8, MatchesFullReference) { CheckTiledAgainstFull(0.0f); }
+
+TEST(CPU_MhaTiledReference_FP8, MatchesFullReferenceWithDropout) { CheckTiledAgainstFull(0.2f); }
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <gtest/gtest.h>
+
+#include "../driver/timing_stats.hpp"
+
+#include <sstream>
+#include <vector>
+
+namespace {
+
+/// Runs the driver loop, taking the times from `times` cyclically.
+TimingStats RunLoop(const TimingOptions& options, const std::vector<double>& times)
+{
+    TimingStats stats;
+    stats.Reset(options);
+    for(int i = 0; stats.Continue(i); i++)
+        stats.Add(times[i % times.size()]);
+    return stats;
+}
+
+TimingOptions Adaptive(int max_iterations, double ci_percent = 1.0)
+{
+    auto options           = TimingOptions{};
+    options.adaptive       = true;
+    options.max_iterations = max_iterations;
+    options.ci_percent     = ci_percent;
+    return options;
+}
+
+} // namespace
+
+TEST(CPU_DriverTimingStats_NONE, FirstIterationIsWarmup)
+{
+    auto options           = TimingOptions{};
+    options.min_iterations = 3;
+    const auto summary     = RunLoop(options, {10.0, 1.0, 2.0}).Summarize();
+
+    EXPECT_EQ(summary.iterations, 3u);
+    EXPECT_EQ(summary.warmup, 1u);
+    EXPECT_EQ(summary.samples, 2u);
+    EXPECT_DOUBLE_EQ(summary.min, 1.0);
+    EXPECT_DOUBLE_EQ(summary.mean, 1.5);
+}
+
+TEST(CPU_DriverTimingStats_NONE, WarmupEndsWhenStable)
+{
+    // the window of the last five times is stable from the 7th time on
+    const auto stats =
+        RunLoop(Adaptive(7), {9.0, 5.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0});
+    const auto summary = stats.Summarize();
+
+    EXPECT_EQ(stats.Iterations(), 7);
+    EXPECT_EQ(summary.warmup, 2u);
+    EXPECT_EQ(summary.samples, 5u);
+}
+
+TEST(CPU_DriverTimingStats_NONE, WarmupEndsAtMaxWarmup)
+{
+    // never stable, so warm-up stops after max_warmup iterations
+    const auto max_iterations = static_cast<int>(TimingStats::max_warmup) + 10;
+    const auto summary        = RunLoop(Adaptive(max_iterations), {1.0, 2.0}).Summarize();
+
+    EXPECT_EQ(summary.iterations, static_cast<std::size_t>(max_iterations));
+    EXPECT_EQ(summary.warmup, TimingStats::max_warmup);
+    EXPECT_EQ(summary.samples, 10u);
+}
+
+TEST(CPU_DriverTimingStats_NONE, StopsWhenConfidenceIntervalIsNarrow)
+{
+    {
+        // constant times: stable and exact once the first window is filled
+        const auto stats = RunLoop(Adaptive(1000), {2.0});
+        EXPECT_EQ(stats.Iterations(), static_cast<int>(TimingStats::window));
+    }
+    {
+        // 1% noise with a 0.1% target needs a few hundred samples
+        const auto stats   = RunLoop(Adaptive(1000, 0.1), {1.0, 1.02});
+        const auto summary = stats.Summarize();
+        EXPECT_GT(stats.Iterations(), 100);
+        EXPECT_LT(stats.Iterations(), 1000);
+        EXPECT_LE(summary.ci95, summary.mean * 0.1 / 100.0);
+    }
+    {
+        // an unreachable target stops at max_iterations
+        const auto stats = RunLoop(Adaptive(200, 1e-6), {1.0, 1.02});
+        EXPECT_EQ(stats.Iterations(), 200);
+    }
+}
+
+TEST(CPU_DriverTimingStats_NONE, AllIterationsWarmup)
+{
+    // stopped by max_iterations right when warm-up ends: the warm-up times are reported
+    const auto max_iterations = static_cast<int>(TimingStats::max_warmup);
+    const auto summary        = RunLoop(Adaptive(max_iterations), {1.0, 3.0}).Summarize();
+
+    EXPECT_EQ(summary.warmup, 0u);
+    EXPECT_EQ(summary.samples, TimingStats::max_warmup);
+    EXPECT_DOUBLE_EQ(summary.min, 1.0);
+    EXPECT_DOUBLE_EQ(summary.mean, 2.0);
+}
+
+TEST(CPU_DriverTimingStats_NONE, PrintKeepsStreamFormat)
+{
+    std::ostringstream ss;
+    ss.precision(3);
+    const auto flags = ss.flags();
+
+    PrintTimingSummary(ss, "Forward Conv.", TimingSummary{});
+    PrintTimingJson(ss, "Forward Conv.", TimingSummary{});
+
+    EXPECT_EQ(ss.precision(), 3);
+    EXPECT_EQ(ss.flags(), flags);
+}
@@ -0,0 +1,92 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <gtest/gtest.h>
+#include <miopen/batch_norm.hpp>
+#include <miopen/fusion.hpp>
+#include <miopen/fusion_plan.hpp>
+#include <miopen/fusion/problem_description.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/stats.hpp>
+
+#include "get_handle.hpp"
+
+#if MIOPEN_BACKEND_HIP
+namespace {
+
+miopen::FusionPlanDescriptor MakeBnActivPlan()
+{
+    const auto x_desc = miopen::TensorDescriptor{miopenFloat, {2, 8, 7, 7}};
+    auto bn_desc      = miopen::TensorDescriptor{};
+    miopen::DeriveBNTensorDescriptor(bn_desc, x_desc, miopenBNSpatial);
+
+    auto plan = miopen::FusionPlanDescriptor{miopenVerticalFusion, x_desc};
+    EXPECT_EQ(plan.AddOp(std::make_shared<miopen::BatchNormInferenceFusionOpDescriptor>(
+                  miopenBNSpatial, bn_desc)),
+              miopenStatusSuccess);
+    EXPECT_EQ(
+        plan.AddOp(std::make_shared<miopen::ActivFwdFusionOpDescriptor>(miopenActivationRELU)),
+        miopenStatusSuccess);
+    return plan;
+}
+
+} // namespace
+
+TEST(GPU_FusionPlanCache_FP32, SecondCompileReusesSolverAndInvoker)
+{
+    using miopen::stats::Counter;
+    using miopen::stats::Histogram;
+
+    auto&& handle = get_handle();
+    if(handle.GetTargetProperties().Xnack().value_or(false))
+        GTEST_SKIP() << "Fusion does not support xnack";
+
+    auto plan = MakeBnActivPlan();
+    ASSERT_EQ(plan.Compile(handle), miopenStatusSuccess);
+
+    const auto network_config = miopen::FusionDescription{&plan}.MakeNetworkConfig();
+    const auto solver =
+        handle.GetFound1_0SolverId(network_config, miopen::AlgorithmName{"fusion"});
+    ASSERT_TRUE(solver);
+
+    // A fresh handle has no invokers of its own, so only the process-wide cache can serve it.
+    miopen::stats::Reset();
+    auto other_handle = miopen::Handle{};
+    auto other_plan   = MakeBnActivPlan();
+    ASSERT_EQ(other_plan.Compile(other_handle), miopenStatusSuccess);
+
+    const auto snapshot = miopen::stats::Collect();
+    ASSERT_EQ(snapshot.Get(Counter::FusionPlanCacheHit), 1u);
+    ASSERT_EQ(snapshot.Get(Counter::FusionPlanCacheMiss), 0u);
+    ASSERT_EQ(snapshot.Get(Counter::KernelCacheMiss), 0u);
+    ASSERT_EQ(snapshot.Get(Histogram::Compile).count, 0u);
+
+    ASSERT_EQ(other_plan.invokers.size(), plan.invokers.size());
+    ASSERT_EQ(other_handle.GetFound1_0SolverId(network_config, miopen::AlgorithmName{"fusion"}),
+              solver);
+    ASSERT_TRUE(
+        other_handle.GetInvoker(network_config, std::nullopt, miopen::AlgorithmName{"fusion"}));
+}
+#endif
@@ -26,6 +26,7 @@
 #include <gtest/gtest.h>
 #include <gtest/gtest_common.hpp>
 #include <miopen/miopen.h>
+#include <miopen/fusion/fusion_invoke_params.hpp>
 
 #include "tensor_holder.hpp"
 #include "get_handle.hpp"
@@ -126,3 +127,28 @@ INSTANTIATE_TEST_SUITE_P(Full,
                                           testing::Values(miopenTensorNCHW)));
 
 #endif
+
+TEST(CPU_FusionOperatorArgs_NONE, SetArgsReusesStorage)
+{
+    using miopen::fusion::BiasOpInvokeParam;
+    using miopen::fusion::TensorScaleAddOpInvokeParam;
+
+    int buffers[2];
+    miopen::OperatorArgs args;
+
+    args.EmplaceArg<BiasOpInvokeParam>(1, &buffers[0]);
+    ASSERT_EQ(args.params.size(), 2u);
+    const auto* first = args.params[1].get();
+
+    // same op type: updated in place
+    args.EmplaceArg<BiasOpInvokeParam>(1, &buffers[1]);
+    ASSERT_EQ(args.params[1].get(), first);
+    EXPECT_EQ(dynamic_cast<const BiasOpInvokeParam&>(*args.params[1]).bdata, &buffers[1]);
+
+    // another op type: replaced
+    args.EmplaceArg<TensorScaleAddOpInvokeParam>(1, 2.0f, &buffers[0]);
+    const auto* scale_add = dynamic_cast<const TensorScaleAddOpInvokeParam*>(args.params[1].get());
+    ASSERT_NE(scale_add, nullptr);
+    EXPECT_EQ(scale_add->alpha, 2.0f);
+    EXPECT_EQ(scale_add->tensor_ptr, &buffers[0]);
+}
@@ -123,11 +123,6 @@ protected:
         auto [n, h, s, d, drop] = GetParam();
         const Handle& handle    = get_handle();
 
-        if((drop > 0.0f))
-        {
-            GTEST_SKIP() << "CPU Dropout for backward pass currently is not supprorted";
-        }
-
         if((drop > 0.0f) && (s % handle.GetWavefrontWidth() != 0))
         {
             GTEST_SKIP() << "CPU Dropout currently supprorts only fully occupied warps";
@@ -195,7 +190,6 @@ protected:
         InitTensor(miopenTensorMhaDropoutOffset,
                    tensor<int64_t>{1, 1, 1, 1}.generate([](auto...) { return 1; }));
 
-        tensor<float> softmax  = tensor<float>{n, h, s, s};
         tensor<T> oDesc        = tensor<T>{n, h, s, d};
         tensor<float> mDesc    = tensor<float>{n, h, s, 1};
         tensor<float> zInvDesc = tensor<float>{n, h, s, 1};
@@ -204,11 +198,10 @@ protected:
 
         // proper O, M and zInv tensors are required for backward pass.
         // randomly generated M and zInv may lead to nan\inf values
-        test::cpu::MultiHeadAttentionForwardfp8(
+        test::cpu::MultiHeadAttentionForwardTiled(
             std::get<tensor<T>>(tensors[miopenTensorMhaQ]->m_cpu_tensor),
             std::get<tensor<T>>(tensors[miopenTensorMhaK]->m_cpu_tensor),
             std::get<tensor<T>>(tensors[miopenTensorMhaV]->m_cpu_tensor),
-            softmax,
             mDesc,
             zInvDesc,
             q.mDescale,
@@ -273,13 +266,14 @@ protected:
         dKDesc_ref = tensor<T>{n, h, s, d};
         dVDesc_ref = tensor<T>{n, h, s, d};
 
-        test::cpu::MultiHeadAttentionBackwardDataf8(
+        test::cpu::MultiHeadAttentionBackwardDataTiled(
             std::get<tensor<T>>(tensors[miopenTensorMhaQ]->m_cpu_tensor),
             std::get<tensor<T>>(tensors[miopenTensorMhaK]->m_cpu_tensor),
             std::get<tensor<T>>(tensors[miopenTensorMhaV]->m_cpu_tensor),
             std::get<tensor<T>>(tensors[miopenTensorMhaO]->m_cpu_tensor),
             std::get<tensor<dO_T>>(tensors[miopenTensorMhaDO]->m_cpu_tensor),
-            softmax,
+            std::get<tensor<float>>(tensors[miopenTensorMhaM]->m_cpu_tensor),
+            std::get<tensor<float>>(tensors[miopenTensorMhaZInv]->m_cpu_tensor),
             q.mDescale,
             k.mDescale,
             v.mDescale,
@@ -298,7 +292,12 @@ protected:
             amax_dV_ref,
             dQDesc_ref,
             dKDesc_ref,
-            dVDesc_ref);
+            dVDesc_ref,
+            drop,
+            std::get<tensor<int64_t>>(tensors[miopenTensorMhaDropoutSeed]->m_cpu_tensor)
+                .data.front(),
+            std::get<tensor<int64_t>>(tensors[miopenTensorMhaDropoutOffset]->m_cpu_tensor)
+                .data.front());
     }
 
     void TestBody() override
@@ -236,7 +236,6 @@ protected:
             args[i].descriptor = &descVector[i];
         }
 
-        softmax_ref  = tensor<float>{n, h, s, s};
         oDesc_ref    = tensor<T>{n, h, s, d};
         mDesc_ref    = tensor<float>{n, h, s, 1};
         zInvDesc_ref = tensor<float>{n, h, s, 1};
@@ -244,7 +243,6 @@ protected:
         RunReference(std::get<tensor<T>>(tensors[miopenTensorMhaQ]->m_cpu_tensor),
                      std::get<tensor<T>>(tensors[miopenTensorMhaK]->m_cpu_tensor),
                      std::get<tensor<T>>(tensors[miopenTensorMhaV]->m_cpu_tensor),
-                     softmax_ref,
                      mDesc_ref,
                      zInvDesc_ref,
                      q.mDescale,
@@ -266,7 +264,6 @@ protected:
     virtual void RunReference(const tensor<T>& q_val,
                               const tensor<T>& k_val,
                               const tensor<T>& v_val,
-                              tensor<float>& softmax,
                               tensor<float>& attn_max,
                               tensor<float>& Z_sum,
                               float q_descale,
@@ -282,24 +279,23 @@ protected:
                               float& aMax_O,
                               tensor<T>& multi_head_attention_fp8)
     {
-        test::cpu::MultiHeadAttentionForwardfp8(q_val,
-                                                k_val,
-                                                v_val,
-                                                softmax,
-                                                attn_max,
-                                                Z_sum,
-                                                q_descale,
-                                                k_descale,
-                                                v_descale,
-                                                s_descale,
-                                                s_scale,
-                                                o_scale,
-                                                dropout_rate,
-                                                seed,
-                                                offset,
-                                                aMax_S,
-                                                aMax_O,
-                                                multi_head_attention_fp8);
+        test::cpu::MultiHeadAttentionForwardTiled(q_val,
+                                                  k_val,
+                                                  v_val,
+                                                  attn_max,
+                                                  Z_sum,
+                                                  q_descale,
+                                                  k_descale,
+                                                  v_descale,
+                                                  s_descale,
+                                                  s_scale,
+                                                  o_scale,
+                                                  dropout_rate,
+                                                  seed,
+                                                  offset,
+                                                  aMax_S,
+                                                  aMax_O,
+                                                  multi_head_attention_fp8);
     }
 
     void TestBody() override
@@ -382,7 +378,6 @@ protected:
     std::vector<miopenTensorArgument_t> args;
 
     // ref data
-    tensor<float> softmax_ref;
     tensor<T> oDesc_ref;
     tensor<float> mDesc_ref;
     tensor<float> zInvDesc_ref;
@@ -418,7 +413,6 @@ class GPU_Fwd_Mha_FP16 : public Test_Fwd_Mha<half_float::half>
     void RunReference(const tensor<half_float::half>& q_val,
                       const tensor<half_float::half>& k_val,
                       const tensor<half_float::half>& v_val,
-                      tensor<float>& softmax,
                       tensor<float>& attn_max,
                       tensor<float>& Z_sum,
                       [[maybe_unused]] float q_descale,
@@ -434,8 +428,24 @@ class GPU_Fwd_Mha_FP16 : public Test_Fwd_Mha<half_float::half>
                       [[maybe_unused]] float& aMax_O,
                       tensor<half_float::half>& output) override
     {
-        test::cpu::MultiHeadAttentionForwardfp16(
-            q_val, k_val, v_val, softmax, attn_max, Z_sum, output);
+        // fp16 attention takes the inputs unscaled
+        test::cpu::MultiHeadAttentionForwardTiled(q_val,
+                                                  k_val,
+                                                  v_val,
+                                                  attn_max,
+                                                  Z_sum,
+                                                  1.0f,
+                                                  1.0f,
+                                                  1.0f,
+                                                  1.0f,
+                                                  1.0f,
+                                                  1.0f,
+                                                  0.0f,
+                                                  0,
+                                                  0,
+                                                  aMax_S,
+                                                  aMax_O,
+                                                  output);
     }
 
     void VerifyResults(const Handle& handle) override
@@ -703,7 +703,7 @@ protected:
         std::vector<int64_t> dims = {n, h, s, d};
 
         miopen::TensorDescriptor td(dtype, {n, h, s, d});
-        const std::vector<std::size_t>& tdStrides = td.GetStrides();
+        const auto& tdStrides = td.GetStrides();
 
         std::vector<int64_t> strides(tdStrides.size());
         std::copy_n(tdStrides.begin(), tdStrides.size(), strides.begin());
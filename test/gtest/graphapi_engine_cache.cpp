@@ -0,0 +1,146 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/graphapi/engine.hpp>
+#include <miopen/graphapi/opgraph.hpp>
+#include <miopen/graphapi/pointwise.hpp>
+#include <miopen/graphapi/util.hpp>
+#include <miopen/stats.hpp>
+
+#include <gtest/gtest.h>
+
+#include "get_handle.hpp"
+
+namespace {
+
+namespace gr = miopen::graphapi;
+
+/// Y = relu(X + B) * alpha, built from tensors of the same ids every time.
+class BiasReluGraph
+{
+    gr::AutoDeleteAllocator mAlloc;
+    gr::OpGraphBuilder mBuilder;
+
+    gr::Tensor* tensor(std::string_view name, bool isVirtual = false)
+    {
+        const auto dims = std::vector<std::size_t>{2, 3, 4, 5};
+        return isVirtual ? mAlloc.allocate(gr::makeTensor<true>(name, miopenFloat, dims))
+                         : mAlloc.allocate(gr::makeTensor<false>(name, miopenFloat, dims));
+    }
+
+    void add(miopenPointwiseMode_t mode, gr::Tensor* x, gr::Tensor* b, gr::Tensor* y, float alpha)
+    {
+        auto* pw = mAlloc.allocate(
+            gr::PointwiseBuilder{}.setMode(mode).setMathPrecision(miopenFloat).build());
+        gr::OperationPointwiseBuilder builder;
+        builder.setPointwise(pw).setX(x).setY(y).setAlpha1(alpha);
+        if(b != nullptr)
+            builder.setB(b);
+        mBuilder.addNode(mAlloc.allocate(std::move(builder).build()));
+    }
+
+public:
+    gr::OpGraph build(float alpha = 1.0f, bool reversed = false, miopenHandle_t handle = nullptr)
+    {
+        auto* x = tensor("X");
+        auto* b = tensor("B");
+        auto* t = tensor("T", true);
+        auto* y = tensor("Y");
+
+        if(reversed)
+        {
+            add(MIOPEN_POINTWISE_RELU_FWD, t, nullptr, y, alpha);
+            add(MIOPEN_POINTWISE_ADD, x, b, t, 1.0f);
+        }
+        else
+        {
+            add(MIOPEN_POINTWISE_ADD, x, b, t, 1.0f);
+            add(MIOPEN_POINTWISE_RELU_FWD, t, nullptr, y, alpha);
+        }
+        if(handle != nullptr)
+            mBuilder.setHandle(handle);
+        return std::move(mBuilder).build();
+    }
+};
+
+} // namespace
+
+TEST(CPU_GraphApiFingerprint_NONE, IdenticalGraphs)
+{
+    BiasReluGraph g1, g2;
+    const auto graph1 = g1.build();
+    // the order the nodes are added in doesn't matter
+    const auto graph2 = g2.build(1.0f, true);
+
+    const auto fp1 = graph1.getFingerprint();
+    const auto fp2 = graph2.getFingerprint();
+    ASSERT_TRUE(fp1.has_value());
+    ASSERT_TRUE(fp2.has_value());
+    EXPECT_EQ(fp1->nodes.size(), 2u);
+    EXPECT_EQ(fp1->hash, fp2->hash);
+    EXPECT_EQ(*fp1, *fp2);
+}
+
+TEST(CPU_GraphApiFingerprint_NONE, DifferentAttributes)
+{
+    BiasReluGraph g1, g2;
+    const auto graph1 = g1.build(1.0f);
+    const auto graph2 = g2.build(2.0f);
+
+    const auto fp1 = graph1.getFingerprint();
+    const auto fp2 = graph2.getFingerprint();
+    ASSERT_TRUE(fp1.has_value());
+    ASSERT_TRUE(fp2.has_value());
+    // same structure, so only the op attributes tell the graphs apart
+    EXPECT_EQ(graph1.getStructuralHash(), graph2.getStructuralHash());
+    EXPECT_NE(*fp1, *fp2);
+}
+
+TEST(GPU_GraphApiEngineCache_FP32, IdenticalGraphIsCacheHit)
+{
+    using miopen::stats::Counter;
+
+    auto& handle = get_handle();
+
+    BiasReluGraph g1, g2;
+    auto graph1 = g1.build(1.0f, false, &handle);
+    auto graph2 = g2.build(1.0f, false, &handle);
+
+    const auto& engines1 = graph1.getEngines();
+
+    miopen::stats::Reset();
+    const auto& engines2 = graph2.getEngines();
+    const auto snapshot  = miopen::stats::Collect();
+
+    EXPECT_EQ(snapshot.Get(Counter::GraphEngineCacheHit), 1u);
+    EXPECT_EQ(snapshot.Get(Counter::GraphEngineCacheMiss), 0u);
+    ASSERT_EQ(engines1.size(), engines2.size());
+    for(std::size_t i = 0; i < engines1.size(); ++i)
+    {
+        EXPECT_EQ(engines1[i].getExecutor(), engines2[i].getExecutor());
+        EXPECT_EQ(engines1[i].getGlobalIndex(), engines2[i].getGlobalIndex());
+        EXPECT_EQ(engines2[i].getOpGraph(), &graph2);
+    }
+}
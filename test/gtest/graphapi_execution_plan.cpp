@@ -24,10 +24,17 @@
  *
  *******************************************************************************/
 
+#include <miopen/convolution.hpp>
+#include <miopen/graphapi/engine.hpp>
 #include <miopen/graphapi/execution_plan.hpp>
+#include <miopen/graphapi/opgraph.hpp>
+#include <miopen/graphapi/pointwise.hpp>
+#include <miopen/graphapi/util.hpp>
+#include <miopen/solution.hpp>
 
 #include <gtest/gtest.h>
 
+#include "get_handle.hpp"
 #include "graphapi_gtest_common.hpp"
 
 namespace {
@@ -112,3 +119,313 @@ TEST(CPU_GraphApiExecutionPlanBuilder_NONE, ExecutionPlan)
 
     execute();
 }
+
+namespace {
+
+using miopen::graphapi::EngineBuilder;
+using miopen::graphapi::GraphPatternExecutor;
+using miopen::graphapi::OpGraph;
+using miopen::graphapi::VariantPack;
+
+class MockBinding : public GraphPatternExecutor::Binding
+{
+public:
+    explicit MockBinding(int& calls) : mCalls(calls) {}
+
+    void execute([[maybe_unused]] miopenHandle_t handle,
+                 [[maybe_unused]] const VariantPack& vpk) override
+    {
+        ++mCalls;
+    }
+
+private:
+    int& mCalls;
+};
+
+class MockBindingExecutor : public GraphPatternExecutor
+{
+public:
+    int bindCalls    = 0;
+    int executeCalls = 0;
+    int bindingCalls = 0;
+
+    void execute([[maybe_unused]] miopenHandle_t handle,
+                 [[maybe_unused]] const VariantPack& vpk) override
+    {
+        ++executeCalls;
+    }
+    size_t getWorkspaceSize() const override { return 0; }
+    nlohmann::json getJson() override { return {}; };
+    std::unique_ptr<Binding> bind() override
+    {
+        ++bindCalls;
+        return std::make_unique<MockBinding>(bindingCalls);
+    }
+};
+
+} // namespace
+
+TEST(CPU_GraphApiExecutionPlanBuilder_NONE, ExecutionPlanBinding)
+{
+    miopenHandle_t handle;
+    auto status = miopenCreate(&handle);
+    ASSERT_EQ(status, miopenStatusSuccess) << "miopenCreate() failed";
+
+    OpGraph opGraph;
+    auto executor = std::make_shared<MockBindingExecutor>();
+    auto engine =
+        EngineBuilder().setGraph(&opGraph).setGlobalIndex(0).setExecutor(executor).build();
+
+    auto plan = ExecutionPlanBuilder().setHandle(handle).setEngineCfg(EngineCfg{engine}).build();
+    EXPECT_EQ(executor->bindCalls, 1) << "Executor has not been bound when the plan was built";
+
+    VariantPack variantPack;
+    plan.execute(handle, variantPack);
+    plan.execute(handle, variantPack);
+    EXPECT_EQ(executor->bindingCalls, 2) << "Plan execution bypassed the binding";
+    EXPECT_EQ(executor->executeCalls, 0) << "Plan execution went through the unbound executor";
+
+    miopenDestroy(handle);
+}
+
+namespace {
+
+/// Keeps a copy of every variant pack it is executed with.
+class RecordingExecutor : public GraphPatternExecutor
+{
+public:
+    std::vector<int64_t> virtualIds;
+    std::vector<VariantPack> packs;
+
+    void execute([[maybe_unused]] miopenHandle_t handle, const VariantPack& vpk) override
+    {
+        packs.push_back(vpk);
+    }
+    size_t getWorkspaceSize() const override { return 0; }
+    nlohmann::json getJson() override { return {}; };
+    std::vector<int64_t> getVirtualTensorIds() const override { return virtualIds; }
+};
+
+} // namespace
+
+TEST(CPU_GraphApiExecutionPlanBuilder_NONE, ExecutionPlanVirtualTensors)
+{
+    namespace gr = miopen::graphapi;
+
+    miopenHandle_t handle;
+    auto status = miopenCreate(&handle);
+    ASSERT_EQ(status, miopenStatusSuccess) << "miopenCreate() failed";
+
+    // Y = relu(X + B), the sum being a virtual tensor placed in the plan workspace
+    const std::vector<std::size_t> dims{2, 3, 4, 5};
+    auto x   = gr::makeTensor<false>("X", miopenFloat, dims);
+    auto b   = gr::makeTensor<false>("B", miopenFloat, dims);
+    auto t   = gr::makeTensor<true>("T", miopenFloat, dims);
+    auto y   = gr::makeTensor<false>("Y", miopenFloat, dims);
+    auto add = gr::PointwiseBuilder{}
+                   .setMode(MIOPEN_POINTWISE_ADD)
+                   .setMathPrecision(miopenFloat)
+                   .build();
+    auto relu = gr::PointwiseBuilder{}
+                    .setMode(MIOPEN_POINTWISE_RELU_FWD)
+                    .setMathPrecision(miopenFloat)
+                    .build();
+    auto addOp =
+        gr::OperationPointwiseBuilder{}.setPointwise(&add).setX(&x).setB(&b).setY(&t).build();
+    auto reluOp = gr::OperationPointwiseBuilder{}.setPointwise(&relu).setX(&t).setY(&y).build();
+
+    gr::OpGraphBuilder graphBuilder;
+    graphBuilder.addNode(&addOp);
+    graphBuilder.addNode(&reluOp);
+    auto opGraph = std::move(graphBuilder).build();
+
+    auto executor        = std::make_shared<RecordingExecutor>();
+    executor->virtualIds = {t.getId()};
+    auto engine =
+        EngineBuilder().setGraph(&opGraph).setGlobalIndex(0).setExecutor(executor).build();
+    auto plan = ExecutionPlanBuilder().setHandle(handle).setEngineCfg(EngineCfg{engine}).build();
+
+    const auto arenaSize = plan.getMemoryPlan().mArenaSize;
+    ASSERT_GT(arenaSize, 0);
+    std::vector<char> workspace0(arenaSize);
+    std::vector<char> workspace1(arenaSize);
+    std::vector<float> buffers(3);
+    const auto offset = plan.getMemoryPlan().mOffsets.at(0).second;
+
+    plan.execute(handle,
+                 VariantPack{{x.getId(), b.getId(), y.getId()},
+                             {&buffers[0], &buffers[1], &buffers[2]},
+                             workspace0.data()});
+    // same tensor ids, only the pointers move
+    plan.execute(handle,
+                 VariantPack{{x.getId(), b.getId(), y.getId()},
+                             {&buffers[1], &buffers[2], &buffers[0]},
+                             workspace1.data()});
+    // reordered tensor ids
+    plan.execute(handle,
+                 VariantPack{{y.getId(), x.getId(), b.getId()},
+                             {&buffers[2], &buffers[0], &buffers[1]},
+                             workspace0.data()});
+
+    ASSERT_EQ(executor->packs.size(), 3);
+    const auto& packs = executor->packs;
+
+    const std::vector<int64_t> ids{x.getId(), b.getId(), y.getId(), t.getId()};
+    EXPECT_EQ(packs[0].getTensorIds(), ids);
+    EXPECT_EQ(packs[0].getDataPtrs(),
+              (std::vector<void*>{
+                  &buffers[0], &buffers[1], &buffers[2], workspace0.data() + offset}));
+    EXPECT_EQ(packs[0].getWorkspace(), workspace0.data() + arenaSize);
+
+    EXPECT_EQ(packs[1].getTensorIds(), ids);
+    EXPECT_EQ(packs[1].getDataPtrs(),
+              (std::vector<void*>{
+                  &buffers[1], &buffers[2], &buffers[0], workspace1.data() + offset}));
+    EXPECT_EQ(packs[1].getWorkspace(), workspace1.data() + arenaSize);
+
+    EXPECT_EQ(packs[2].getTensorIds(),
+              (std::vector<int64_t>{y.getId(), x.getId(), b.getId(), t.getId()}));
+    EXPECT_EQ(packs[2].getDataPtrs(),
+              (std::vector<void*>{
+                  &buffers[2], &buffers[0], &buffers[1], workspace0.data() + offset}));
+
+    EXPECT_ANY_THROW(plan.execute(
+        handle, VariantPack{{x.getId(), b.getId(), y.getId()}, {&buffers[0]}, workspace0.data()}))
+        << "Plan accepted a variant pack with fewer data pointers than tensor ids";
+
+    miopenDestroy(handle);
+}
+
+namespace {
+
+namespace gr = miopen::graphapi;
+
+/// 1x1 forward convolution solved through Find 2.0 and wrapped into a GraphExecutorFind20,
+/// with host data whose expected output is exact in fp32.
+class Find20ConvBinding
+{
+    static constexpr std::size_t N = 1;
+    static constexpr std::size_t C = 2;
+    static constexpr std::size_t K = 3;
+    static constexpr std::size_t H = 4;
+    static constexpr std::size_t W = 4;
+
+    miopen::TensorDescriptor mXDesc{miopenFloat, std::vector<std::size_t>{N, C, H, W}};
+    miopen::TensorDescriptor mWDesc{miopenFloat, std::vector<std::size_t>{K, C, 1, 1}};
+    miopen::TensorDescriptor mYDesc{miopenFloat, std::vector<std::size_t>{N, K, H, W}};
+    miopen::ConvolutionDescriptor mConvDesc{{0, 0}, {1, 1}, {1, 1}};
+    gr::Tensor mX = gr::makeTensor<false>("X", miopenFloat, std::vector<std::size_t>{N, C, H, W});
+    gr::Tensor mW = gr::makeTensor<false>("W", miopenFloat, std::vector<std::size_t>{K, C, 1, 1});
+    gr::Tensor mY = gr::makeTensor<false>("Y", miopenFloat, std::vector<std::size_t>{N, K, H, W});
+
+public:
+    std::vector<float> xData = std::vector<float>(N * C * H * W);
+    std::vector<float> wData = std::vector<float>(K * C);
+
+    Find20ConvBinding()
+    {
+        for(std::size_t i = 0; i < xData.size(); ++i)
+            xData[i] = static_cast<float>(i % 5) - 2.0f;
+        for(std::size_t i = 0; i < wData.size(); ++i)
+            wData[i] = static_cast<float>(i % 3) - 1.0f;
+    }
+
+    int64_t xId() const { return mX.getId(); }
+    int64_t wId() const { return mW.getId(); }
+    int64_t yId() const { return mY.getId(); }
+    std::size_t ySize() const { return N * K * H * W; }
+
+    std::vector<float> reference() const
+    {
+        std::vector<float> y(ySize());
+        for(std::size_t k = 0; k < K; ++k)
+            for(std::size_t hw = 0; hw < H * W; ++hw)
+            {
+                float acc = 0.0f;
+                for(std::size_t c = 0; c < C; ++c)
+                    acc += xData[c * H * W + hw] * wData[k * C + c];
+                y[k * H * W + hw] = acc;
+            }
+        return y;
+    }
+
+    std::shared_ptr<gr::GraphExecutorFind20> makeExecutor(miopen::Handle& handle)
+    {
+        miopenProblem_t problem;
+        EXPECT_EQ(miopenCreateConvProblem(&problem, &mConvDesc, miopenProblemDirectionForward),
+                  miopenStatusSuccess);
+        EXPECT_EQ(miopenSetProblemTensorDescriptor(problem, miopenTensorConvolutionX, &mXDesc),
+                  miopenStatusSuccess);
+        EXPECT_EQ(miopenSetProblemTensorDescriptor(problem, miopenTensorConvolutionW, &mWDesc),
+                  miopenStatusSuccess);
+        EXPECT_EQ(miopenSetProblemTensorDescriptor(problem, miopenTensorConvolutionY, &mYDesc),
+                  miopenStatusSuccess);
+
+        miopenSolution_t solution;
+        std::size_t found = 0;
+        EXPECT_EQ(miopenFindSolutions(&handle, problem, nullptr, &solution, &found, 1),
+                  miopenStatusSuccess);
+        miopenDestroyProblem(problem);
+        if(found == 0)
+            return nullptr;
+
+        auto tensorInfoMap = std::make_shared<gr::TensorInfoMap>();
+        tensorInfoMap->try_emplace(xId(), miopenTensorConvolutionX, &mX);
+        tensorInfoMap->try_emplace(wId(), miopenTensorConvolutionW, &mW);
+        tensorInfoMap->try_emplace(yId(), miopenTensorConvolutionY, &mY);
+
+        auto executor = std::make_shared<gr::GraphExecutorFind20>(miopen::deref(solution),
+                                                                  tensorInfoMap);
+        miopenDestroySolution(solution);
+        return executor;
+    }
+};
+
+} // namespace
+
+TEST(GPU_GraphApiExecutionPlanBinding_FP32, Find20ReorderedVariantPack)
+{
+    auto& handle = get_handle();
+    Find20ConvBinding t;
+    auto executor = t.makeExecutor(handle);
+    ASSERT_TRUE(executor);
+    auto binding = executor->bind();
+    ASSERT_TRUE(binding);
+
+    const auto ref = t.reference();
+    auto xDev      = handle.Write(t.xData);
+    auto wDev      = handle.Write(t.wData);
+    auto wsDev     = handle.Create(std::max<std::size_t>(executor->getWorkspaceSize(), 1));
+
+    // The second pack lists the same tensors in another order, so the binding has to
+    // resolve its slots again instead of reusing the ones of the first pack.
+    auto yDev0 = handle.Create<float>(ref.size());
+    binding->execute(&handle,
+                     gr::VariantPack{{t.xId(), t.wId(), t.yId()},
+                                     {xDev.get(), wDev.get(), yDev0.get()},
+                                     wsDev.get()});
+    auto yDev1 = handle.Create<float>(ref.size());
+    binding->execute(&handle,
+                     gr::VariantPack{{t.yId(), t.xId(), t.wId()},
+                                     {yDev1.get(), xDev.get(), wDev.get()},
+                                     wsDev.get()});
+
+    EXPECT_EQ(handle.Read<float>(yDev0, ref.size()), ref);
+    EXPECT_EQ(handle.Read<float>(yDev1, ref.size()), ref);
+}
+
+TEST(GPU_GraphApiExecutionPlanBinding_FP32, Find20MissingTensor)
+{
+    auto& handle = get_handle();
+    Find20ConvBinding t;
+    auto executor = t.makeExecutor(handle);
+    ASSERT_TRUE(executor);
+    auto binding = executor->bind();
+    ASSERT_TRUE(binding);
+
+    auto xDev = handle.Write(t.xData);
+    auto yDev = handle.Create<float>(t.ySize());
+    EXPECT_ANY_THROW(binding->execute(
+        &handle, gr::VariantPack{{t.xId(), t.yId()}, {xDev.get(), yDev.get()}, nullptr}))
+        << "Binding accepted a variant pack without the convolution weights";
+}
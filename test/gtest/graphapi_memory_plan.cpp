@@ -0,0 +1,111 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/graphapi/memory_plan.hpp>
+#include <miopen/graphapi/opgraph.hpp>
+#include <miopen/graphapi/pointwise.hpp>
+#include <miopen/graphapi/util.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+namespace gr = miopen::graphapi;
+
+std::size_t getOffset(const gr::MemoryPlan& plan, int64_t id)
+{
+    auto it = std::find_if(plan.mOffsets.cbegin(), plan.mOffsets.cend(), [id](const auto& p) {
+        return p.first == id;
+    });
+    EXPECT_NE(it, plan.mOffsets.cend());
+    return it == plan.mOffsets.cend() ? 0 : it->second;
+}
+
+} // namespace
+
+TEST(CPU_GraphApiMemoryPlan_NONE, DisjointLifetimesShareMemory)
+{
+    auto plan = gr::planMemory({{1, 1000, 0, 1}, {2, 1000, 1, 2}, {3, 1000, 2, 3}});
+
+    EXPECT_EQ(plan.mArenaSize, 2 * 1024u);
+    EXPECT_EQ(getOffset(plan, 1), getOffset(plan, 3));
+    EXPECT_NE(getOffset(plan, 1), getOffset(plan, 2));
+}
+
+TEST(CPU_GraphApiMemoryPlan_NONE, LargestBuffersFirst)
+{
+    // the small buffer fits in the gap left once the first large buffer is dead
+    auto plan = gr::planMemory({{1, 256, 0, 3}, {2, 4096, 0, 1}, {3, 4096, 2, 3}});
+
+    EXPECT_EQ(plan.mArenaSize, 4096u + 256u);
+    EXPECT_EQ(getOffset(plan, 2), 0u);
+    EXPECT_EQ(getOffset(plan, 3), 0u);
+    EXPECT_EQ(getOffset(plan, 1), 4096u);
+}
+
+TEST(CPU_GraphApiMemoryPlan_NONE, LifetimesFollowTopologicalOrder)
+{
+    // X -> neg -> T0 -> abs -> T1 -> exp -> T2 -> neg -> Y
+    gr::AutoDeleteAllocator alloc;
+    const std::vector<std::size_t> dims{1, 1, 16, 16};
+    auto* x  = alloc.allocate(gr::makeTensor<false>("X", miopenFloat, dims));
+    auto* t0 = alloc.allocate(gr::makeTensor<true>("T0", miopenFloat, dims));
+    auto* t1 = alloc.allocate(gr::makeTensor<true>("T1", miopenFloat, dims));
+    auto* t2 = alloc.allocate(gr::makeTensor<true>("T2", miopenFloat, dims));
+    auto* y  = alloc.allocate(gr::makeTensor<false>("Y", miopenFloat, dims));
+
+    gr::OpGraphBuilder builder;
+    auto add = [&](miopenPointwiseMode_t mode, gr::Tensor* in, gr::Tensor* out) {
+        auto* pw = alloc.allocate(
+            gr::PointwiseBuilder{}.setMode(mode).setMathPrecision(miopenFloat).build());
+        builder.addNode(alloc.allocate(
+            gr::OperationPointwiseBuilder{}.setPointwise(pw).setX(in).setY(out).build()));
+    };
+    // added out of order on purpose
+    add(MIOPEN_POINTWISE_EXP, t1, t2);
+    add(MIOPEN_POINTWISE_NEG, x, t0);
+    add(MIOPEN_POINTWISE_NEG, t2, y);
+    add(MIOPEN_POINTWISE_ABS, t0, t1);
+    auto graph = std::move(builder).build();
+
+    auto lifetimes = gr::getBufferLifetimes(graph, {t0->getId(), t1->getId(), t2->getId()});
+    ASSERT_EQ(lifetimes.size(), 3u);
+    for(std::size_t i = 0; i < lifetimes.size(); ++i)
+    {
+        EXPECT_EQ(lifetimes[i].mSize, 16 * 16 * sizeof(float));
+        EXPECT_EQ(lifetimes[i].mFirst, i);
+        EXPECT_EQ(lifetimes[i].mLast, i + 1);
+    }
+
+    auto plan = gr::planMemory(lifetimes);
+    EXPECT_EQ(plan.mArenaSize, 2 * 16 * 16 * sizeof(float));
+    EXPECT_EQ(getOffset(plan, t0->getId()), getOffset(plan, t2->getId()));
+
+    EXPECT_ANY_THROW(gr::getBufferLifetimes(graph, {x->getId()}));
+}
@@ -68,3 +68,85 @@ TEST(CPU_GraphMatchingAPI_NONE, DiamondGraphMatch)
         ASSERT_FALSE(gr::isIsomorphic(dg1->graph(), dg5->graph()));
     }
 }
+
+TEST(CPU_GraphMatchingAPI_NONE, DiamondGraphHash)
+{
+    using namespace graphapi_opgraph_tests;
+
+    auto dg1 = makeDiamondGraph();
+    auto dg2 = makeDiamondGraph();
+
+    ASSERT_EQ(dg1->graph().getStructuralHash(), dg2->graph().getStructuralHash());
+
+    // nodes are listed in a different order and the mirror copy swaps left and right
+    auto dg3 = gr::PatternGraphGenerator::Make({{"bottom", {"t_c", "t_d"}, {"t_out"}},
+                                                {"right", {"t_a"}, {"t_c"}},
+                                                {"left", {"t_b"}, {"t_d"}},
+                                                {"top", {"t_in"}, {"t_a", "t_b"}}});
+    ASSERT_EQ(dg1->graph().getStructuralHash(), dg3->graph().getStructuralHash());
+
+    // same node names, but left and right are chained instead of parallel
+    auto dg4 = gr::PatternGraphGenerator::Make({{"top", {"t_in", "t_x"}, {"t_a"}},
+                                                {"left", {"t_a"}, {"t_c"}},
+                                                {"right", {"t_c"}, {"t_d"}},
+                                                {"bottom", {"t_d"}, {"t_out", "t_y"}}});
+    ASSERT_NE(dg1->graph().getStructuralHash(), dg4->graph().getStructuralHash());
+    ASSERT_FALSE(gr::isIsomorphic(dg1->graph(), dg4->graph()));
+
+    // dummy nodes don't describe their attributes, so they can't be fingerprinted
+    ASSERT_FALSE(dg1->graph().getFingerprint().has_value());
+}
+
+TEST(CPU_GraphMatchingAPI_NONE, CyclicGraphIsRejected)
+{
+    using namespace graphapi_opgraph_tests;
+
+    ASSERT_THROW(gr::PatternGraphGenerator::Make(
+                     {{"first", {"t_in", "t_b"}, {"t_a"}}, {"second", {"t_a"}, {"t_b", "t_out"}}}),
+                 miopen::Exception);
+}
+
+TEST(CPU_GraphMatchingAPI_NONE, DiamondGraphSignature)
+{
+    using namespace graphapi_opgraph_tests;
+
+    auto dg = makeDiamondGraph();
+    const auto& sig = dg->graph().getSignature();
+
+    ASSERT_EQ(sig.mNumEdges, 4u);
+    ASSERT_EQ(sig.mNodeNames, (std::vector<std::string>{"bottom", "left", "right", "top"}));
+    using Degrees = std::vector<std::pair<size_t, size_t>>;
+    ASSERT_EQ(sig.mInOutDegrees, (Degrees{{1, 1}, {1, 1}, {1, 2}, {2, 1}}));
+    ASSERT_EQ(sig.mStructuralHash, dg->graph().getStructuralHash());
+
+    // engines are only looked for when queried
+    ASSERT_FALSE(dg->graph().hasEngines());
+}
+
+TEST(CPU_GraphMatchingAPI_NONE, EqualHashesAreVerified)
+{
+    using namespace graphapi_opgraph_tests;
+
+    // Every u feeds two v and every v is fed by two u. Weisfeiler-Lehman refinement can't
+    // tell one cycle through all the ops from two separate cycles, the exact check can.
+    auto one_cycle = gr::PatternGraphGenerator::Make({{"u", {"i1"}, {"a1"}},
+                                                      {"u", {"i2"}, {"a2"}},
+                                                      {"u", {"i3"}, {"a3"}},
+                                                      {"u", {"i4"}, {"a4"}},
+                                                      {"v", {"a1", "a2"}, {"o1"}},
+                                                      {"v", {"a2", "a3"}, {"o2"}},
+                                                      {"v", {"a3", "a4"}, {"o3"}},
+                                                      {"v", {"a4", "a1"}, {"o4"}}});
+    auto two_cycles = gr::PatternGraphGenerator::Make({{"u", {"i1"}, {"a1"}},
+                                                       {"u", {"i2"}, {"a2"}},
+                                                       {"u", {"i3"}, {"a3"}},
+                                                       {"u", {"i4"}, {"a4"}},
+                                                       {"v", {"a1", "a2"}, {"o1"}},
+                                                       {"v", {"a1", "a2"}, {"o2"}},
+                                                       {"v", {"a3", "a4"}, {"o3"}},
+                                                       {"v", {"a3", "a4"}, {"o4"}}});
+
+    ASSERT_EQ(one_cycle->graph().getStructuralHash(), two_cycles->graph().getStructuralHash());
+    ASSERT_FALSE(gr::isIsomorphic(one_cycle->graph(), two_cycles->graph()));
+    ASSERT_TRUE(gr::isIsomorphic(two_cycles->graph(), two_cycles->graph()));
+}
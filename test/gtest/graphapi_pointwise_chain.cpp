@@ -0,0 +1,397 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/graphapi/convolution.hpp>
+#include <miopen/graphapi/engine.hpp>
+#include <miopen/graphapi/enginecfg.hpp>
+#include <miopen/graphapi/execution_plan.hpp>
+#include <miopen/graphapi/opgraph.hpp>
+#include <miopen/graphapi/pointwise.hpp>
+#include <miopen/graphapi/pointwise_chain.hpp>
+#include <miopen/graphapi/util.hpp>
+#include <miopen/graphapi/variant_pack.hpp>
+#include <miopen/handle.hpp>
+
+#include <gtest/gtest.h>
+
+#include "get_handle.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+namespace gr = miopen::graphapi;
+
+constexpr std::size_t N = 2;
+constexpr std::size_t C = 3;
+constexpr std::size_t H = 4;
+constexpr std::size_t W = 5;
+
+class PointwiseChainGraph
+{
+    gr::AutoDeleteAllocator mAlloc;
+    gr::OpGraphBuilder mBuilder;
+
+public:
+    gr::Tensor* tensor(std::string_view name,
+                       const std::vector<std::size_t>& dims = {N, C, H, W},
+                       miopenDataType_t type                = miopenFloat,
+                       bool isVirtual                       = false)
+    {
+        return isVirtual ? mAlloc.allocate(gr::makeTensor<true>(name, type, dims))
+                         : mAlloc.allocate(gr::makeTensor<false>(name, type, dims));
+    }
+
+    gr::Tensor* virtualTensor(std::string_view name)
+    {
+        return tensor(name, {N, C, H, W}, miopenFloat, true);
+    }
+
+    void add(miopenPointwiseMode_t mode,
+             gr::Tensor* x,
+             gr::Tensor* b,
+             gr::Tensor* y,
+             float alpha1               = 1.0f,
+             miopenDataType_t precision = miopenFloat)
+    {
+        auto* pw = mAlloc.allocate(
+            gr::PointwiseBuilder{}.setMode(mode).setMathPrecision(precision).build());
+        gr::OperationPointwiseBuilder builder;
+        builder.setPointwise(pw).setX(x).setY(y).setAlpha1(alpha1);
+        if(b != nullptr)
+            builder.setB(b);
+        mBuilder.addNode(mAlloc.allocate(std::move(builder).build()));
+    }
+
+    /// 1x1 convolution without padding, so that the output keeps the input lengths.
+    void addConvolution(gr::Tensor* x, gr::Tensor* w, gr::Tensor* y, double alpha = 1.0)
+    {
+        auto* conv = mAlloc.allocate(gr::ConvolutionBuilder{}
+                                         .setCompType(miopenFloat)
+                                         .setMode(miopenConvolution)
+                                         .setSpatialDims(2)
+                                         .setDilations({1, 1})
+                                         .setFilterStrides({1, 1})
+                                         .setPrePaddings({0, 0})
+                                         .setPostPaddings({0, 0})
+                                         .build());
+        mBuilder.addNode(mAlloc.allocate(gr::OperationConvolutionForwardBuilder()
+                                             .setConvolution(conv)
+                                             .setX(x)
+                                             .setW(w)
+                                             .setY(y)
+                                             .setAlpha(alpha)
+                                             .setBeta(0)
+                                             .build()));
+    }
+
+    void setHandle(miopenHandle_t handle) { mBuilder.setHandle(handle); }
+
+    gr::OpGraph build() { return std::move(mBuilder).build(); }
+};
+
+std::vector<float> makeData(std::size_t size, std::size_t period, float scale, float offset)
+{
+    std::vector<float> data(size);
+    for(std::size_t i = 0; i < size; ++i)
+        data[i] = static_cast<float>(i % period) * scale + offset;
+    return data;
+}
+
+/// Host 1x1 convolution of NCHW X with KC11 W, both packed.
+std::vector<float> conv1x1(const std::vector<float>& x, const std::vector<float>& w, std::size_t k)
+{
+    std::vector<float> y(N * k * H * W);
+    for(std::size_t n = 0; n < N; ++n)
+        for(std::size_t o = 0; o < k; ++o)
+            for(std::size_t hw = 0; hw < H * W; ++hw)
+            {
+                float acc = 0.0f;
+                for(std::size_t c = 0; c < C; ++c)
+                    acc += x[(n * C + c) * H * W + hw] * w[o * C + c];
+                y[(n * k + o) * H * W + hw] = acc;
+            }
+    return y;
+}
+
+/// Y = relu(conv(X, W) * 2 + BIAS), anchored on the convolution.
+struct ConvBiasReluGraph
+{
+    PointwiseChainGraph g;
+    gr::Tensor* x    = g.tensor("X");
+    gr::Tensor* w    = g.tensor("W", {C, C, 1, 1});
+    gr::Tensor* bias = g.tensor("BIAS", {1, C, 1, 1});
+    gr::Tensor* y    = g.tensor("Y");
+    gr::Tensor* tc   = g.virtualTensor("T_C");
+    gr::Tensor* t0   = g.virtualTensor("T0");
+
+    std::vector<float> xData    = makeData(N * C * H * W, 7, 0.5f, -1.5f);
+    std::vector<float> wData    = makeData(C * C, 5, 0.25f, -0.5f);
+    std::vector<float> biasData = makeData(C, C, 1.0f, -1.0f);
+
+    ConvBiasReluGraph()
+    {
+        g.addConvolution(x, w, tc, 2.0);
+        g.add(MIOPEN_POINTWISE_ADD, tc, bias, t0);
+        g.add(MIOPEN_POINTWISE_RELU_FWD, t0, nullptr, y);
+    }
+
+    std::vector<float> reference(const gr::PointwiseChain& chain) const
+    {
+        const auto convData = conv1x1(xData, wData, C);
+        std::vector<float> yData(convData.size());
+        gr::evaluatePointwiseChain(chain, {convData.data(), biasData.data()}, {yData.data()});
+        return yData;
+    }
+};
+
+} // namespace
+
+TEST(CPU_GraphApiPointwiseChain_NONE, BiasReluScale)
+{
+    // Y = relu(X + BIAS) * S * 2
+    PointwiseChainGraph g;
+    auto* x    = g.tensor("X");
+    auto* bias = g.tensor("BIAS", {1, C, 1, 1});
+    auto* s    = g.tensor("S");
+    auto* y    = g.tensor("Y");
+    auto* t0   = g.virtualTensor("T0");
+    auto* t1   = g.virtualTensor("T1");
+
+    g.add(MIOPEN_POINTWISE_ADD, x, bias, t0);
+    g.add(MIOPEN_POINTWISE_RELU_FWD, t0, nullptr, t1);
+    g.add(MIOPEN_POINTWISE_MUL, t1, s, y, 2.0f);
+    auto graph = g.build();
+
+    auto chain = gr::analyzePointwiseChain(graph);
+    ASSERT_TRUE(chain);
+    EXPECT_EQ(chain->mAnchorKind, gr::PointwiseChainAnchor::None);
+    EXPECT_EQ(chain->mProgram.mInputs,
+              (std::vector<int64_t>{x->getId(), bias->getId(), s->getId()}));
+    ASSERT_EQ(chain->mProgram.mInstructions.size(), 3u);
+    ASSERT_EQ(chain->mProgram.mOutputs.size(), 1u);
+    EXPECT_EQ(chain->mProgram.mOutputs.front().first, y->getId());
+
+    std::vector<float> xData(N * C * H * W);
+    std::vector<float> biasData(C);
+    std::vector<float> sData(xData.size());
+    std::vector<float> yData(xData.size());
+    for(std::size_t i = 0; i < xData.size(); ++i)
+    {
+        xData[i] = static_cast<float>(i % 7) - 3.0f;
+        sData[i] = static_cast<float>(i % 3) * 0.5f;
+    }
+    for(std::size_t i = 0; i < C; ++i)
+        biasData[i] = static_cast<float>(i) - 1.0f;
+
+    gr::evaluatePointwiseChain(
+        *chain, {xData.data(), biasData.data(), sData.data()}, {yData.data()});
+
+    for(std::size_t i = 0; i < xData.size(); ++i)
+    {
+        const auto c = (i / (H * W)) % C;
+        EXPECT_FLOAT_EQ(yData[i], std::max(xData[i] + biasData[c], 0.0f) * 2.0f * sData[i]);
+    }
+}
+
+TEST(CPU_GraphApiPointwiseChain_NONE, IntermediateOutput)
+{
+    // Y0 = X * X is both an output and an input of Y1 = exp(Y0) - X
+    PointwiseChainGraph g;
+    auto* x  = g.tensor("X");
+    auto* y0 = g.tensor("Y0");
+    auto* y1 = g.tensor("Y1");
+    auto* t0 = g.virtualTensor("T0");
+
+    g.add(MIOPEN_POINTWISE_EXP, y0, nullptr, t0);
+    g.add(MIOPEN_POINTWISE_MUL, x, x, y0);
+    g.add(MIOPEN_POINTWISE_SUB, t0, x, y1);
+    auto graph = g.build();
+
+    auto chain = gr::analyzePointwiseChain(graph);
+    ASSERT_TRUE(chain);
+    EXPECT_EQ(chain->mProgram.mInputs, (std::vector<int64_t>{x->getId()}));
+    ASSERT_EQ(chain->mProgram.mOutputs.size(), 2u);
+
+    std::vector<float> xData(N * C * H * W);
+    for(std::size_t i = 0; i < xData.size(); ++i)
+        xData[i] = static_cast<float>(i % 5) * 0.25f;
+
+    std::vector<float> y0Data(xData.size());
+    std::vector<float> y1Data(xData.size());
+    std::vector<float*> outputs(2);
+    for(std::size_t j = 0; j < 2; ++j)
+        outputs[j] = chain->mOutputTensors[j] == y0 ? y0Data.data() : y1Data.data();
+
+    gr::evaluatePointwiseChain(*chain, {xData.data()}, outputs);
+
+    for(std::size_t i = 0; i < xData.size(); ++i)
+    {
+        EXPECT_FLOAT_EQ(y0Data[i], xData[i] * xData[i]);
+        EXPECT_FLOAT_EQ(y1Data[i], std::exp(xData[i] * xData[i]) - xData[i]);
+    }
+}
+
+TEST(CPU_GraphApiPointwiseChain_NONE, Rejected)
+{
+    {
+        // comparison modes have no kernel implementation
+        PointwiseChainGraph g;
+        g.add(MIOPEN_POINTWISE_CMP_GT, g.tensor("X"), g.tensor("B"), g.tensor("Y"));
+        auto graph = g.build();
+        EXPECT_FALSE(gr::analyzePointwiseChain(graph));
+    }
+    {
+        // only float tensors are supported
+        PointwiseChainGraph g;
+        g.add(MIOPEN_POINTWISE_ADD,
+              g.tensor("X", {N, C, H, W}, miopenHalf),
+              g.tensor("B", {N, C, H, W}, miopenHalf),
+              g.tensor("Y", {N, C, H, W}, miopenHalf));
+        auto graph = g.build();
+        EXPECT_FALSE(gr::analyzePointwiseChain(graph));
+    }
+    {
+        // all outputs of the chain must have the same lengths
+        PointwiseChainGraph g;
+        g.add(MIOPEN_POINTWISE_ADD, g.tensor("X"), g.tensor("B"), g.tensor("Y0"));
+        g.add(MIOPEN_POINTWISE_RELU_FWD,
+              g.tensor("S", {1, C, 1, 1}),
+              nullptr,
+              g.tensor("Y1", {1, C, 1, 1}));
+        auto graph = g.build();
+        EXPECT_FALSE(gr::analyzePointwiseChain(graph));
+    }
+    {
+        // ops which share no tensor don't form one chain
+        PointwiseChainGraph g;
+        g.add(MIOPEN_POINTWISE_ADD, g.tensor("X0"), g.tensor("B0"), g.tensor("Y0"));
+        g.add(MIOPEN_POINTWISE_MUL, g.tensor("X1"), g.tensor("B1"), g.tensor("Y1"));
+        auto graph = g.build();
+        EXPECT_FALSE(gr::analyzePointwiseChain(graph));
+    }
+}
+
+TEST(CPU_GraphApiPointwiseChain_NONE, ConvolutionAnchor)
+{
+    ConvBiasReluGraph t;
+    auto graph = t.g.build();
+
+    auto chain = gr::analyzePointwiseChain(graph);
+    ASSERT_TRUE(chain);
+    EXPECT_EQ(chain->mAnchorKind, gr::PointwiseChainAnchor::Convolution);
+    const auto anchorInputs = std::vector<gr::Tensor*>{t.x, t.w};
+    EXPECT_TRUE(std::is_permutation(chain->mAnchorInputs.begin(),
+                                    chain->mAnchorInputs.end(),
+                                    anchorInputs.begin(),
+                                    anchorInputs.end()));
+    EXPECT_EQ(chain->mProgram.mInputs, (std::vector<int64_t>{t.tc->getId(), t.bias->getId()}));
+
+    // the convolution alpha is applied by the chain to the anchor output
+    const auto yData    = t.reference(*chain);
+    const auto convData = conv1x1(t.xData, t.wData, C);
+    for(std::size_t i = 0; i < yData.size(); ++i)
+    {
+        const auto c = (i / (H * W)) % C;
+        EXPECT_FLOAT_EQ(yData[i], std::max(convData[i] * 2.0f + t.biasData[c], 0.0f));
+    }
+}
+
+TEST(GPU_GraphApiPointwiseChain_FP32, Executor)
+{
+    // Y = relu(X + BIAS) * S
+    PointwiseChainGraph g;
+    auto* x    = g.tensor("X");
+    auto* bias = g.tensor("BIAS", {1, C, 1, 1});
+    auto* s    = g.tensor("S");
+    auto* y    = g.tensor("Y");
+    auto* t0   = g.virtualTensor("T0");
+    auto* t1   = g.virtualTensor("T1");
+
+    g.add(MIOPEN_POINTWISE_ADD, x, bias, t0);
+    g.add(MIOPEN_POINTWISE_RELU_FWD, t0, nullptr, t1);
+    g.add(MIOPEN_POINTWISE_MUL, t1, s, y);
+    auto graph = g.build();
+
+    auto chain = gr::analyzePointwiseChain(graph);
+    ASSERT_TRUE(chain);
+
+    const auto xData    = makeData(N * C * H * W, 7, 1.0f, -3.0f);
+    const auto biasData = makeData(C, C, 1.0f, -1.0f);
+    const auto sData    = makeData(N * C * H * W, 3, 0.5f, 0.0f);
+    std::vector<float> ref(xData.size());
+    gr::evaluatePointwiseChain(*chain, {xData.data(), biasData.data(), sData.data()}, {ref.data()});
+
+    auto& handle  = get_handle();
+    auto xDev     = handle.Write(xData);
+    auto biasDev  = handle.Write(biasData);
+    auto sDev     = handle.Write(sData);
+    auto yDev     = handle.Create<float>(xData.size());
+    auto executor = gr::PointwiseChainExecutor{*chain};
+    executor.execute(&handle,
+                     gr::VariantPack{{x->getId(), bias->getId(), s->getId(), y->getId()},
+                                     {xDev.get(), biasDev.get(), sDev.get(), yDev.get()},
+                                     nullptr});
+
+    const auto yData = handle.Read<float>(yDev, xData.size());
+    for(std::size_t i = 0; i < yData.size(); ++i)
+        EXPECT_NEAR(yData[i], ref[i], 1e-5f * std::max(1.0f, std::abs(ref[i])));
+}
+
+TEST(GPU_GraphApiPointwiseChain_FP32, ConvolutionAnchor)
+{
+    auto& handle = get_handle();
+    ConvBiasReluGraph t;
+    t.g.setHandle(&handle);
+    auto graph = t.g.build();
+
+    auto chain = gr::analyzePointwiseChain(graph);
+    ASSERT_TRUE(chain);
+    const auto ref = t.reference(*chain);
+
+    auto engines = gr::findEngines(&graph);
+    ASSERT_FALSE(engines.empty());
+    auto plan = gr::ExecutionPlanBuilder{}
+                    .setEngineCfg(gr::EngineCfgBuilder{}.setEngine(engines.front()).build())
+                    .setHandle(&handle)
+                    .build();
+
+    auto xDev    = handle.Write(t.xData);
+    auto wDev    = handle.Write(t.wData);
+    auto biasDev = handle.Write(t.biasData);
+    auto yDev    = handle.Create<float>(ref.size());
+    auto wsDev   = handle.Create(plan.getWorkspaceSize());
+    plan.execute(&handle,
+                 gr::VariantPack{{t.x->getId(), t.w->getId(), t.bias->getId(), t.y->getId()},
+                                 {xDev.get(), wDev.get(), biasDev.get(), yDev.get()},
+                                 wsDev.get()});
+
+    const auto yData = handle.Read<float>(yDev, ref.size());
+    for(std::size_t i = 0; i < yData.size(); ++i)
+        EXPECT_NEAR(yData[i], ref[i], 1e-4f * std::max(1.0f, std::abs(ref[i])));
+}
@@ -0,0 +1,159 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <gtest/gtest.h>
+
+#include <half/half.hpp>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "../gemm.hpp"
+
+namespace {
+
+struct GemmCase
+{
+    bool trans_a;
+    bool trans_b;
+    std::size_t m;
+    std::size_t n;
+    std::size_t k;
+    std::size_t batch;
+};
+
+template <class T>
+std::vector<T> Random(std::size_t size, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<T> data(size);
+    for(auto& x : data)
+        x = static_cast<T>(dist(gen));
+    return data;
+}
+
+/// Straightforward triple loop, the reference for the blocked implementation.
+template <class Ta, class Tc>
+void NaiveGemm(const GemmCase& gc,
+               double alpha,
+               const std::vector<Ta>& a,
+               std::size_t lda,
+               const std::vector<Ta>& b,
+               std::size_t ldb,
+               double beta,
+               std::vector<Tc>& c,
+               std::size_t ldc)
+{
+    const auto stride_a = a.size() / gc.batch;
+    const auto stride_b = b.size() / gc.batch;
+    const auto stride_c = c.size() / gc.batch;
+    for(std::size_t bt = 0; bt < gc.batch; ++bt)
+        for(std::size_t i = 0; i < gc.m; ++i)
+            for(std::size_t j = 0; j < gc.n; ++j)
+            {
+                double acc = 0.0;
+                for(std::size_t p = 0; p < gc.k; ++p)
+                {
+                    const auto a_ip = gc.trans_a ? a[bt * stride_a + p * lda + i]
+                                                 : a[bt * stride_a + i * lda + p];
+                    const auto b_pj = gc.trans_b ? b[bt * stride_b + j * ldb + p]
+                                                 : b[bt * stride_b + p * ldb + j];
+                    acc += static_cast<double>(a_ip) * static_cast<double>(b_pj);
+                }
+                auto& dst = c[bt * stride_c + i * ldc + j];
+                dst       = static_cast<Tc>(alpha * acc + beta * static_cast<double>(dst));
+            }
+}
+
+template <class Ta, class Tc, class Tacc>
+void CheckGemm(const GemmCase& gc, double tolerance)
+{
+    // Padded leading dimensions exercise the strided access.
+    const std::size_t lda      = (gc.trans_a ? gc.m : gc.k) + 3;
+    const std::size_t ldb      = (gc.trans_b ? gc.k : gc.n) + 1;
+    const std::size_t ldc      = gc.n + 2;
+    const std::size_t stride_a = (gc.trans_a ? gc.k : gc.m) * lda;
+    const std::size_t stride_b = (gc.trans_b ? gc.n : gc.k) * ldb;
+    const std::size_t stride_c = gc.m * ldc;
+
+    const auto a = Random<Ta>(stride_a * gc.batch, 1);
+    const auto b = Random<Ta>(stride_b * gc.batch, 2);
+    auto c_ref   = Random<Tc>(stride_c * gc.batch, 3);
+    auto c       = c_ref;
+
+    NaiveGemm(gc, 0.5, a, lda, b, ldb, 2.0, c_ref, ldc);
+    host_gemm::gemm_strided_batched<Tacc>(gc.trans_a,
+                                          gc.trans_b,
+                                          gc.m,
+                                          gc.n,
+                                          gc.k,
+                                          0.5,
+                                          a.data(),
+                                          lda,
+                                          stride_a,
+                                          b.data(),
+                                          ldb,
+                                          stride_b,
+                                          2.0,
+                                          c.data(),
+                                          ldc,
+                                          stride_c,
+                                          gc.batch);
+
+    for(std::size_t i = 0; i < c.size(); ++i)
+    {
+        ASSERT_NEAR(static_cast<double>(c_ref[i]), static_cast<double>(c[i]), tolerance)
+            << "index " << i;
+    }
+}
+
+std::vector<GemmCase> GemmCases()
+{
+    std::vector<GemmCase> cases;
+    for(bool ta : {false, true})
+        for(bool tb : {false, true})
+        {
+            cases.push_back({ta, tb, 7, 5, 3, 2});
+            // crosses every block boundary
+            cases.push_back({ta, tb, 130, 260, 300, 3});
+        }
+    return cases;
+}
+
+} // namespace
+
+TEST(CPU_HostGemm_FP32, MatchesNaiveGemm)
+{
+    for(const auto& gc : GemmCases())
+        CheckGemm<float, float, double>(gc, 1e-5);
+}
+
+TEST(CPU_HostGemm_FP16, MixedPrecisionAccumulate)
+{
+    for(const auto& gc : GemmCases())
+        CheckGemm<half_float::half, float, float>(gc, 1e-3);
+}
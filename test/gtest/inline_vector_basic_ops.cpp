@@ -200,3 +200,35 @@ TEST(CPU_InlineVectorClear_NONE, Test)
     in_v12.clear();
     EXPECT_EQ(in_v12.size(), 0);
 }
+
+TEST(CPU_InlineVectorCompareAndConvert_NONE, Test)
+{
+    miopen::InlineVector<size_t, 5> in_v13{1, 2, 3};
+    miopen::InlineVector<size_t, 5> in_v14{1, 2, 4};
+    std::vector<size_t> v13{1, 2, 3};
+
+    EXPECT_TRUE(in_v13 == in_v13);
+    EXPECT_TRUE(in_v13 != in_v14);
+    EXPECT_TRUE(in_v13 < in_v14);
+    EXPECT_TRUE(in_v14 > in_v13);
+    EXPECT_TRUE(in_v13 == v13);
+    EXPECT_TRUE(v13 != in_v14);
+
+    const std::vector<size_t> converted(in_v13);
+    EXPECT_EQ(converted, v13);
+    EXPECT_FALSE((std::is_convertible_v<miopen::InlineVector<size_t, 5>, std::vector<size_t>>));
+}
+
+TEST(CPU_InlineVectorInsert_NONE, Test)
+{
+    miopen::InlineVector<size_t, 4> in_v15{1, 3};
+    std::vector<size_t> v15{1, 3};
+
+    in_v15.insert(in_v15.begin() + 1, 2);
+    v15.insert(v15.begin() + 1, 2);
+    in_v15.insert(in_v15.begin(), 0);
+    v15.insert(v15.begin(), 0);
+
+    EXPECT_EQ(in_v15, v15);
+    EXPECT_ANY_THROW(in_v15.insert(in_v15.end(), 4));
+}
@@ -0,0 +1,166 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/invoke_params.hpp>
+#include <miopen/invoker_profiler.hpp>
+#include <miopen/miopen.h>
+#include <miopen/tensor.hpp>
+
+#include <gtest/gtest.h>
+
+#include "get_handle.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+namespace {
+
+struct InvokerProfilerEnabler
+{
+    InvokerProfilerEnabler() : cached(miopen::invoker_profiler::IsEnabled())
+    {
+        miopen::invoker_profiler::Enable(true);
+        miopen::invoker_profiler::Reset();
+    }
+    ~InvokerProfilerEnabler() { miopen::invoker_profiler::Enable(cached); }
+
+private:
+    bool cached;
+};
+
+const miopen::invoker_profiler::SolverProfile&
+Find(const std::vector<miopen::invoker_profiler::SolverProfile>& profiles, const std::string& name)
+{
+    const auto it = std::find_if(
+        profiles.begin(), profiles.end(), [&](const auto& p) { return p.solver == name; });
+    EXPECT_NE(it, profiles.end()) << name;
+    return *it;
+}
+
+} // namespace
+
+TEST(GPU_InvokerProfiler_FP32, SplitsHostTimeByPhaseAndSolver)
+{
+    using miopen::invoker_profiler::Phase;
+
+    const InvokerProfilerEnabler enabler;
+    auto&& handle = get_handle();
+
+    const auto inner = miopen::invoker_profiler::Wrap(
+        [](const miopen::Handle&, const miopen::AnyInvokeParams&) {
+            miopen::invoker_profiler::AddTime(Phase::Lookup, 10);
+            miopen::invoker_profiler::AddTime(Phase::Launch, 20);
+        },
+        "Inner");
+    const auto outer = miopen::invoker_profiler::Wrap(
+        [&](const miopen::Handle& h, const miopen::AnyInvokeParams& params) {
+            miopen::invoker_profiler::AddTime(Phase::Launch, 5);
+            inner(h, params);
+        },
+        "Outer");
+
+    outer(handle, {});
+    outer(handle, {});
+    ASSERT_FALSE(miopen::invoker_profiler::IsInsideInvoker());
+
+    // Outside of invoker calls the time is dropped.
+    miopen::invoker_profiler::AddTime(Phase::Launch, 1000);
+
+    const auto profiles = miopen::invoker_profiler::Collect();
+    ASSERT_EQ(profiles.size(), 2u);
+
+    const auto& in = Find(profiles, "Inner");
+    EXPECT_EQ(in.calls, 2u);
+    EXPECT_EQ(in.launches, 2u);
+    EXPECT_EQ(in.lookup, 20u);
+    EXPECT_EQ(in.launch, 40u);
+    EXPECT_EQ(in.nested, 0u);
+    EXPECT_GE(in.total, in.lookup + in.launch);
+
+    const auto& out = Find(profiles, "Outer");
+    EXPECT_EQ(out.calls, 2u);
+    EXPECT_EQ(out.launches, 2u);
+    EXPECT_EQ(out.launch, 10u);
+    EXPECT_EQ(out.nested, in.total);
+    EXPECT_GE(out.total, out.nested + out.launch);
+
+    auto text = std::ostringstream{};
+    miopen::invoker_profiler::Print(text, profiles);
+    EXPECT_NE(text.str().find("Inner"), std::string::npos);
+
+    miopen::invoker_profiler::Reset();
+    EXPECT_TRUE(miopen::invoker_profiler::Collect().empty());
+}
+
+TEST(GPU_InvokerProfiler_FP32, DisabledKeepsInvokers)
+{
+    miopen::invoker_profiler::Enable(false);
+    miopen::invoker_profiler::Reset();
+    auto&& handle = get_handle();
+
+    auto called        = 0;
+    const auto invoker = miopen::invoker_profiler::Wrap(
+        [&](const miopen::Handle&, const miopen::AnyInvokeParams&) { ++called; }, "Solver");
+    invoker(handle, {});
+
+    EXPECT_EQ(called, 1);
+    EXPECT_TRUE(miopen::invoker_profiler::Collect().empty());
+}
+
+TEST(GPU_InvokerProfiler_FP32, TimesCachedSolverInvoker)
+{
+    const InvokerProfilerEnabler enabler;
+    auto&& handle = get_handle();
+
+    auto desc    = miopen::TensorDescriptor{miopenFloat, std::vector<std::size_t>{3, 5, 7, 11}};
+    const auto x = std::vector<float>(desc.GetElementSize(), -1.0f);
+    auto x_dev   = handle.Write(x);
+    auto y_dev   = handle.Write(x);
+
+    miopenActivationDescriptor_t activ;
+    ASSERT_EQ(miopenCreateActivationDescriptor(&activ), miopenStatusSuccess);
+    ASSERT_EQ(miopenSetActivationDescriptor(activ, miopenActivationRELU, 0.0, 0.0, 0.0),
+              miopenStatusSuccess);
+
+    // The first call builds the invoker and runs it directly, the second one takes it from the
+    // invoker cache, which returns the profiled invoker.
+    const float alpha = 1.0f;
+    const float beta  = 0.0f;
+    for(auto i = 0; i < 2; ++i)
+        ASSERT_EQ(miopenActivationForward(
+                      &handle, activ, &alpha, &desc, x_dev.get(), &beta, &desc, y_dev.get()),
+                  miopenStatusSuccess);
+    miopenDestroyActivationDescriptor(activ);
+
+    const auto profiles = miopen::invoker_profiler::Collect();
+    ASSERT_FALSE(profiles.empty());
+    const auto& p = profiles.front();
+    EXPECT_GE(p.calls, 1u) << p.solver;
+    EXPECT_GE(p.launches, p.calls) << p.solver;
+    EXPECT_GT(p.lookup, 0u) << p.solver << ": Handle::Run was not timed";
+    EXPECT_GT(p.launch, 0u) << p.solver << ": the kernel launch was not timed";
+    EXPECT_GE(p.total, p.lookup + p.launch + p.wait) << p.solver;
+}
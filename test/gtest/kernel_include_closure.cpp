@@ -0,0 +1,74 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/kernel.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <set>
+#include <string>
+
+namespace {
+
+std::set<std::string> Names(const std::vector<std::reference_wrapper<const miopen::fs::path>>& v)
+{
+    auto names = std::set<std::string>{};
+    std::transform(v.begin(), v.end(), std::inserter(names, names.end()), [](const auto& path) {
+        return path.get().filename().string();
+    });
+    return names;
+}
+
+} // namespace
+
+TEST(CPU_KernelIncludeClosure_NONE, FollowsNestedIncludes)
+{
+    const auto closure = miopen::GetKernelIncClosure("#include <type_traits>\n"
+                                                     "  #  include \"hip_float8.hpp\"\n"
+                                                     "__global__ void kernel() {}\n");
+
+    EXPECT_EQ(closure.size(), Names(closure).size());
+    EXPECT_EQ(Names(closure),
+              (std::set<std::string>{"hip_float8.hpp",
+                                     "hip_f8_impl.hpp",
+                                     "miopen_cstdint.hpp",
+                                     "miopen_limits.hpp",
+                                     "miopen_type_traits.hpp"}));
+}
+
+TEST(CPU_KernelIncludeClosure_NONE, NoIncludes)
+{
+    EXPECT_TRUE(miopen::GetKernelIncClosure("__global__ void kernel() {}\n").empty());
+}
+
+TEST(CPU_KernelIncludeClosure_NONE, MacroIncludeFallsBackToAllHeaders)
+{
+    const auto closure = miopen::GetKernelIncClosure("#define HEADER \"hip_float8.hpp\"\n"
+                                                     "#include HEADER\n");
+
+    EXPECT_EQ(closure.size(), miopen::GetKernelIncList().size());
+}
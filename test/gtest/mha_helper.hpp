@@ -29,6 +29,11 @@
 #include <hip_float8.hpp>
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
 // disable __device__ qualifiers
 #ifdef FQUALIFIERS
 #error rocrand FQUALIFIERS defined externally, probably one of rocrand device header included prior to this
@@ -632,6 +637,388 @@ void MultiHeadAttentionBackwardDataf8(const tensor<T>& q_val,
     ScaleMult(dK_val_fp32, dK_scale, dK_val);
 }
 
+namespace detail {
+
+/// Rows of Q and columns of K processed together by the tiled references.
+constexpr size_t mha_tile_size = 64;
+
+/// Dropout decision for element (row, col) of the NHSS probability matrix of head
+/// `bh`, identical to DropOut() applied to the full matrix.
+inline bool MhaDropped(float dropout_rate,
+                       uint64_t seed,
+                       uint64_t offset,
+                       size_t bh,
+                       size_t s,
+                       size_t row,
+                       size_t col)
+{
+    rocrand_state_xorwow rng;
+    rocrand_init(prng::hash(seed + (bh * s + row) * s + col), 0, offset, &rng);
+    return prng::xorwow_uniform(&rng) < dropout_rate;
+}
+
+/// Descaled Q.dot(K_transpose) for rows [q_begin, q_end) and columns [k_begin, k_end)
+/// of head (b_id, h_id), with the same rounding as Dot_4D_4D_T followed by ScaleMult.
+template <typename T>
+void MhaScoresTile(const tensor<T>& q_val,
+                   const tensor<T>& k_val,
+                   float qk_descale,
+                   const tensor<float>* optional_bias,
+                   size_t b_id,
+                   size_t h_id,
+                   size_t q_begin,
+                   size_t q_end,
+                   size_t k_begin,
+                   size_t k_end,
+                   std::vector<float>& scores)
+{
+    const size_t d_k   = q_val.desc.GetLengths()[3];
+    const size_t width = k_end - k_begin;
+    for(size_t i = q_begin; i < q_end; ++i)
+    {
+        for(size_t j = k_begin; j < k_end; ++j)
+        {
+            double sum(0);
+            for(size_t k_id = 0; k_id < d_k; ++k_id)
+            {
+                sum += float(q_val(b_id, h_id, i, k_id)) * float(k_val(b_id, h_id, j, k_id));
+            }
+            float score = float(sum) * qk_descale;
+            if(optional_bias != nullptr)
+                score += (*optional_bias)(b_id, h_id, i, j);
+            scores[(i - q_begin) * width + (j - k_begin)] = score;
+        }
+    }
+}
+
+} // namespace detail
+
+/* Tiled (flash-attention style) counterpart of MultiHeadAttentionForwardfp8/fp16.
+ *
+ * The S x S probability matrix is never materialized: every block of query rows streams
+ * over key blocks twice. The first sweep computes the row max and the normalizer with an
+ * online softmax, the second one recomputes the scores, normalizes them (so that fp8
+ * quantization of the probabilities matches the full reference) and accumulates P.dot(V)
+ * in double. Blocks of (batch, head, query rows) are processed in parallel.
+ * Memory is O(S) per block instead of O(S^2) per head.
+ */
+template <typename T>
+void MultiHeadAttentionForwardTiled(const tensor<T>& q_val,
+                                    const tensor<T>& k_val,
+                                    const tensor<T>& v_val,
+                                    tensor<float>& attn_max,
+                                    tensor<float>& Z_sum,
+                                    float q_descale,
+                                    float k_descale,
+                                    float v_descale,
+                                    float s_descale,
+                                    float s_scale,
+                                    float o_scale,
+                                    float dropout_rate,
+                                    uint64_t seed,
+                                    uint64_t offset,
+                                    float& aMax_S,
+                                    float& aMax_O,
+                                    tensor<T>& multi_head_attention,
+                                    const tensor<float>* optional_bias = nullptr)
+{
+    // fp8 probabilities are quantized before P.dot(V), wider types keep them in fp32
+    using P_T = std::conditional_t<std::is_same_v<T, float8>, T, float>;
+
+    const auto& lens    = q_val.desc.GetLengths();
+    const size_t n      = lens[0];
+    const size_t h      = lens[1];
+    const size_t s      = lens[2];
+    const size_t d_k    = lens[3];
+    const size_t tile   = detail::mha_tile_size;
+    const size_t blocks = (s + tile - 1) / tile;
+    const float scale   = 1.0f / (1.0f - dropout_rate);
+
+    std::vector<float> amax_s(n * h * blocks, 0.0f);
+    std::vector<float> amax_o(n * h * blocks, 0.0f);
+
+    miopen::par_for(n * h * blocks, 1, [&](size_t task) {
+        const size_t bh      = task / blocks;
+        const size_t b_id    = bh / h;
+        const size_t h_id    = bh % h;
+        const size_t q_begin = (task % blocks) * tile;
+        const size_t q_end   = std::min(s, q_begin + tile);
+        const size_t rows    = q_end - q_begin;
+
+        std::vector<float> scores(rows * tile);
+        std::vector<float> row_max(rows, -std::numeric_limits<float>::infinity());
+        std::vector<double> row_sum(rows, 0.0);
+        std::vector<float> z_inv(rows);
+        std::vector<double> acc(rows * d_k, 0.0);
+
+        // 1st sweep: online row max and softmax normalizer
+        for(size_t k_begin = 0; k_begin < s; k_begin += tile)
+        {
+            const size_t k_end = std::min(s, k_begin + tile);
+            const size_t width = k_end - k_begin;
+            detail::MhaScoresTile(q_val,
+                                  k_val,
+                                  q_descale * k_descale,
+                                  optional_bias,
+                                  b_id,
+                                  h_id,
+                                  q_begin,
+                                  q_end,
+                                  k_begin,
+                                  k_end,
+                                  scores);
+            for(size_t i = 0; i < rows; ++i)
+            {
+                const float* row = &scores[i * width];
+                const float new_max = std::max(row_max[i], *std::max_element(row, row + width));
+                double sum = row_sum[i] * std::exp(double(row_max[i]) - double(new_max));
+                for(size_t j = 0; j < width; ++j)
+                    sum += std::exp(row[j] - new_max);
+                row_max[i] = new_max;
+                row_sum[i] = sum;
+            }
+        }
+
+        for(size_t i = 0; i < rows; ++i)
+        {
+            z_inv[i]                             = 1.0f / row_sum[i];
+            attn_max(b_id, h_id, q_begin + i, 0) = row_max[i];
+            Z_sum(b_id, h_id, q_begin + i, 0)    = z_inv[i];
+        }
+
+        // 2nd sweep: normalized probabilities, dropout and P.dot(V)
+        float local_amax_s = 0.0f;
+        for(size_t k_begin = 0; k_begin < s; k_begin += tile)
+        {
+            const size_t k_end = std::min(s, k_begin + tile);
+            const size_t width = k_end - k_begin;
+            detail::MhaScoresTile(q_val,
+                                  k_val,
+                                  q_descale * k_descale,
+                                  optional_bias,
+                                  b_id,
+                                  h_id,
+                                  q_begin,
+                                  q_end,
+                                  k_begin,
+                                  k_end,
+                                  scores);
+            for(size_t i = 0; i < rows; ++i)
+            {
+                for(size_t j = 0; j < width; ++j)
+                {
+                    float p = float(std::exp(scores[i * width + j] - row_max[i])) * z_inv[i];
+                    local_amax_s = std::max(local_amax_s, std::abs(p));
+                    if(dropout_rate > 0.0f)
+                    {
+                        const bool drop = detail::MhaDropped(
+                            dropout_rate, seed, offset, bh, s, q_begin + i, k_begin + j);
+                        p = drop ? 0.0f : p * scale;
+                    }
+                    const double p_q = double(P_T(p * s_scale));
+                    for(size_t dk_id = 0; dk_id < d_k; ++dk_id)
+                    {
+                        acc[i * d_k + dk_id] +=
+                            p_q * double(v_val(b_id, h_id, k_begin + j, dk_id));
+                    }
+                }
+            }
+        }
+
+        float local_amax_o = 0.0f;
+        for(size_t i = 0; i < rows; ++i)
+        {
+            for(size_t dk_id = 0; dk_id < d_k; ++dk_id)
+            {
+                const float o = float(acc[i * d_k + dk_id]) * (s_descale * v_descale);
+                local_amax_o  = std::max(local_amax_o, std::abs(o));
+                multi_head_attention(b_id, h_id, q_begin + i, dk_id) = T(o * o_scale);
+            }
+        }
+
+        amax_s[task] = local_amax_s;
+        amax_o[task] = local_amax_o;
+    });
+
+    aMax_S = *std::max_element(amax_s.begin(), amax_s.end());
+    aMax_O = *std::max_element(amax_o.begin(), amax_o.end());
+}
+
+/* Tiled counterpart of MultiHeadAttentionBackwardDataf8.
+ *
+ * Takes the row max and inverse normalizer produced by the forward pass instead of the
+ * full softmax and recomputes the probabilities block by block. Every (batch, head) is
+ * processed by one task, which sweeps blocks of query rows and, within them, key blocks;
+ * dQ rows are completed per query block while dK and dV are accumulated in double over
+ * the whole sequence.
+ */
+template <typename T = float8, typename U = T>
+void MultiHeadAttentionBackwardDataTiled(const tensor<T>& q_val,
+                                         const tensor<T>& k_val,
+                                         const tensor<T>& v_val,
+                                         const tensor<T>& O_val, // attention (O)
+                                         const tensor<U>& dO_val,
+                                         const tensor<float>& attn_max,
+                                         const tensor<float>& Z_sum,
+                                         float q_descale,
+                                         float k_descale,
+                                         float v_descale,
+                                         float dQ_scale,
+                                         float dK_scale,
+                                         float dV_scale,
+                                         float s_scale,
+                                         float s_descale,
+                                         float ds_scale,
+                                         float ds_descale,
+                                         float O_descale,
+                                         float dO_descale,
+                                         float& aMax_dS,
+                                         float& aMax_dQ,
+                                         float& aMax_dK,
+                                         float& aMax_dV,
+                                         tensor<T>& dQ_val,
+                                         tensor<T>& dK_val,
+                                         tensor<T>& dV_val,
+                                         float dropout_rate = 0.0f,
+                                         uint64_t seed      = 0,
+                                         uint64_t offset    = 0)
+{
+    const auto& lens  = q_val.desc.GetLengths();
+    const size_t n    = lens[0];
+    const size_t h    = lens[1];
+    const size_t s    = lens[2];
+    const size_t d_k  = lens[3];
+    const size_t tile = detail::mha_tile_size;
+    const float scale = 1.0f / (1.0f - dropout_rate);
+
+    std::vector<std::array<float, 4>> amax(n * h, {0.0f, 0.0f, 0.0f, 0.0f});
+
+    miopen::par_for(n * h, 1, [&](size_t bh) {
+        const size_t b_id = bh / h;
+        const size_t h_id = bh % h;
+
+        // rowsum(dO . O) per query row
+        std::vector<float> delta(s);
+        for(size_t i = 0; i < s; ++i)
+        {
+            double sum(0);
+            for(size_t dk_id = 0; dk_id < d_k; ++dk_id)
+            {
+                sum += float(dO_val(b_id, h_id, i, dk_id) * dO_descale) *
+                       float(O_val(b_id, h_id, i, dk_id) * O_descale);
+            }
+            delta[i] = sum;
+        }
+
+        std::vector<double> dk_acc(s * d_k, 0.0);
+        std::vector<double> dv_acc(s * d_k, 0.0);
+        std::vector<double> dq_acc(tile * d_k);
+        std::vector<float> scores(tile * tile);
+        float& amax_ds = amax[bh][0];
+        float& amax_dq = amax[bh][1];
+
+        for(size_t q_begin = 0; q_begin < s; q_begin += tile)
+        {
+            const size_t q_end = std::min(s, q_begin + tile);
+            const size_t rows  = q_end - q_begin;
+            std::fill(dq_acc.begin(), dq_acc.end(), 0.0);
+
+            for(size_t k_begin = 0; k_begin < s; k_begin += tile)
+            {
+                const size_t k_end = std::min(s, k_begin + tile);
+                const size_t width = k_end - k_begin;
+                detail::MhaScoresTile(q_val,
+                                      k_val,
+                                      q_descale * k_descale,
+                                      nullptr,
+                                      b_id,
+                                      h_id,
+                                      q_begin,
+                                      q_end,
+                                      k_begin,
+                                      k_end,
+                                      scores);
+
+                for(size_t i = 0; i < rows; ++i)
+                {
+                    const size_t q_id = q_begin + i;
+                    const float m     = attn_max(b_id, h_id, q_id, 0);
+                    const float z_inv = Z_sum(b_id, h_id, q_id, 0);
+                    for(size_t j = 0; j < width; ++j)
+                    {
+                        const size_t k_id = k_begin + j;
+                        const float p     = float(std::exp(scores[i * width + j] - m)) * z_inv;
+                        // dropout keeps the element scaled by 1 / (1 - rate), or zeroes it
+                        float keep = 1.0f;
+                        if(dropout_rate > 0.0f)
+                        {
+                            const bool drop = detail::MhaDropped(
+                                dropout_rate, seed, offset, bh, s, q_id, k_id);
+                            keep = drop ? 0.0f : scale;
+                        }
+
+                        // dV += dropout(softmax)_T x dO, dP = dO x V_T
+                        const float p_s = p * keep * s_scale;
+                        double dp(0);
+                        for(size_t dk_id = 0; dk_id < d_k; ++dk_id)
+                        {
+                            dv_acc[k_id * d_k + dk_id] +=
+                                p_s * float(dO_val(b_id, h_id, q_id, dk_id));
+                            dp += float(dO_val(b_id, h_id, q_id, dk_id)) *
+                                  float(v_val(b_id, h_id, k_id, dk_id));
+                        }
+
+                        // dS = softmax . (dropout(dP) - delta)
+                        const float ds =
+                            (float(dp) * (dO_descale * v_descale) * keep - delta[q_id]) * p;
+                        const T ds_q   = T(ds * ds_scale);
+                        amax_ds        = std::max(amax_ds, std::abs(ds));
+                        for(size_t dk_id = 0; dk_id < d_k; ++dk_id)
+                        {
+                            dq_acc[i * d_k + dk_id] +=
+                                double(ds_q) * double(k_val(b_id, h_id, k_id, dk_id));
+                            dk_acc[k_id * d_k + dk_id] +=
+                                float(ds_q) * float(q_val(b_id, h_id, q_id, dk_id));
+                        }
+                    }
+                }
+            }
+
+            for(size_t i = 0; i < rows; ++i)
+            {
+                for(size_t dk_id = 0; dk_id < d_k; ++dk_id)
+                {
+                    const float dq = float(dq_acc[i * d_k + dk_id]) * (ds_descale * k_descale);
+                    amax_dq        = std::max(amax_dq, std::abs(dq));
+                    dQ_val(b_id, h_id, q_begin + i, dk_id) = T(dq * dQ_scale);
+                }
+            }
+        }
+
+        for(size_t k_id = 0; k_id < s; ++k_id)
+        {
+            for(size_t dk_id = 0; dk_id < d_k; ++dk_id)
+            {
+                const float dk = float(dk_acc[k_id * d_k + dk_id]) * (ds_descale * q_descale);
+                const float dv = float(dv_acc[k_id * d_k + dk_id]) * (s_descale * dO_descale);
+                amax[bh][2]    = std::max(amax[bh][2], std::abs(dk));
+                amax[bh][3]    = std::max(amax[bh][3], std::abs(dv));
+                dK_val(b_id, h_id, k_id, dk_id) = T(dk * dK_scale);
+                dV_val(b_id, h_id, k_id, dk_id) = T(dv * dV_scale);
+            }
+        }
+    });
+
+    aMax_dS = aMax_dQ = aMax_dK = aMax_dV = 0.0f;
+    for(const auto& a : amax)
+    {
+        aMax_dS = std::max(aMax_dS, a[0]);
+        aMax_dQ = std::max(aMax_dQ, a[1]);
+        aMax_dK = std::max(aMax_dK, a[2]);
+        aMax_dV = std::max(aMax_dV, a[3]);
+    }
+}
+
 template <typename T>
 tensor<float> ExtractGoldenDataFromJson(std::string_view json_attention_data,
                                         const tensor<T>& tensor_val)
@@ -0,0 +1,140 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <half/half.hpp>
+#include <miopen/bfloat16.hpp>
+
+#include "../random.hpp"
+
+namespace {
+
+template <typename T>
+std::vector<T> Fill(std::size_t n, T A, T B, std::uint64_t stream, std::size_t threads)
+{
+    std::vector<T> data(n);
+    prng::fill_A_to_B(data.data(), data.size(), A, B, stream, threads);
+    return data;
+}
+
+} // namespace
+
+// Not a multiple of the block size nor of the Philox output width, 5 blocks.
+constexpr std::size_t n_5_blocks = (std::size_t{1} << 18) + 7;
+
+TEST(CPU_PrngFillThreadCountInvariant_FP32, Test)
+{
+    constexpr auto n = n_5_blocks;
+
+    const auto ref = Fill(n, -1.0f, 1.0f, 1, 1);
+    for(std::size_t threads : {2, 3, 5, 64})
+        EXPECT_EQ(ref, Fill(n, -1.0f, 1.0f, 1, threads)) << "threads: " << threads;
+
+    EXPECT_TRUE(std::all_of(ref.begin(), ref.end(), [](auto v) { return v >= -1.0f && v < 1.0f; }));
+    EXPECT_NE(ref, Fill(n, -1.0f, 1.0f, 2, 1));
+}
+
+TEST(CPU_PrngParForBlocksThreadCountInvariant_FP32, Test)
+{
+    constexpr auto n = n_5_blocks;
+
+    const auto draw = [](std::size_t threads) {
+        std::vector<float> data(n);
+        std::set<std::thread::id> workers;
+        std::mutex mutex;
+        prng::par_for_blocks(
+            n,
+            1,
+            [&](std::size_t first, std::size_t last) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    workers.insert(std::this_thread::get_id());
+                }
+                for(auto i = first; i < last; ++i)
+                    data[i] = prng::gen_canonical<float>();
+            },
+            threads);
+        return std::make_pair(data, workers.size());
+    };
+
+    const auto ref = draw(1);
+    EXPECT_EQ(ref.second, std::size_t{1});
+    for(std::size_t threads : {2, 3, 5})
+    {
+        const auto result = draw(threads);
+        // The blocks must really run on several threads, even on a single core machine.
+        EXPECT_EQ(result.second, threads);
+        EXPECT_EQ(ref.first, result.first) << "threads: " << threads;
+    }
+}
+
+TEST(CPU_PrngFillRange_FP16, Test)
+{
+    // Half has a spacing of 1 in [1024, 2048), so rounding would often reach B.
+    using half = half_float::half;
+    const auto data = Fill(100000, half{2047.0f}, half{2048.0f}, 1, 4);
+    EXPECT_TRUE(std::all_of(data.begin(), data.end(), [](auto v) { return v == half{2047.0f}; }));
+}
+
+TEST(CPU_PrngFillRange_BFP16, Test)
+{
+    // Bfloat16 has a spacing of 1 in [128, 256), so rounding would often reach B.
+    const auto data = Fill(100000, bfloat16{254.0f}, bfloat16{256.0f}, 1, 4);
+    EXPECT_TRUE(std::all_of(data.begin(), data.end(), [](auto v) {
+        return static_cast<float>(v) >= 254.0f && static_cast<float>(v) < 256.0f;
+    }));
+    EXPECT_TRUE(std::any_of(
+        data.begin(), data.end(), [](auto v) { return static_cast<float>(v) == 255.0f; }));
+}
+
+TEST(CPU_PrngFillRange_I32, Test)
+{
+    const auto data = Fill(1000, 3, 10, 1, 4);
+    EXPECT_TRUE(std::all_of(data.begin(), data.end(), [](auto v) { return v >= 3 && v < 10; }));
+    EXPECT_EQ(*std::min_element(data.begin(), data.end()), 3);
+    EXPECT_EQ(*std::max_element(data.begin(), data.end()), 9);
+}
+
+TEST(CPU_PrngPhiloxKnownAnswer_NONE, Test)
+{
+    // Philox4x32-10 known answer vectors of the Random123 reference implementation. The counter
+    // is {block, stream} and the key is {key}, both split into 32-bit words low word first.
+    using Words = std::array<std::uint32_t, 4>;
+
+    EXPECT_EQ((prng::philox{0, 0}(0)), (Words{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+    EXPECT_EQ((prng::philox{~0ull, ~0ull}(~0ull)),
+              (Words{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+    EXPECT_EQ((prng::philox{0x299f31d0a4093822, 0x0370734413198a2e}(0x85a308d3243f6a88)),
+              (Words{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
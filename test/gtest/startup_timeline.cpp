@@ -0,0 +1,120 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/readonlyramdb.hpp>
+#include <miopen/solver_id.hpp>
+#include <miopen/startup.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include "get_handle.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::size_t Count(const std::vector<miopen::startup::Event>& timeline,
+                  miopen::startup::Step step,
+                  const std::string& detail)
+{
+    return std::count_if(timeline.begin(), timeline.end(), [&](const auto& event) {
+        return event.step == step && event.detail == detail;
+    });
+}
+
+} // namespace
+
+TEST(CPU_StartupTimeline_NONE, RecordsScopedSteps)
+{
+    const auto detail = std::string{"startup timeline test"};
+    {
+        const miopen::startup::ScopedStep step{miopen::startup::Step::AiModel, detail};
+    }
+
+    const auto timeline = miopen::startup::GetTimeline();
+    const auto it       = std::find_if(timeline.begin(), timeline.end(), [&](const auto& event) {
+        return event.detail == detail;
+    });
+    ASSERT_NE(it, timeline.end());
+    EXPECT_EQ(it->step, miopen::startup::Step::AiModel);
+    EXPECT_LE(it->begin, it->end);
+    EXPECT_FALSE(it->warm_start);
+
+    std::ostringstream ss;
+    miopen::startup::Print(ss, timeline);
+    EXPECT_NE(ss.str().find("AiModel"), std::string::npos);
+    EXPECT_NE(ss.str().find(detail), std::string::npos);
+}
+
+TEST(CPU_StartupTimeline_NONE, ConcurrentPrefetchLoadsOnce)
+{
+    const miopen::TmpDir tmp{"startup_timeline"};
+    const auto path = tmp / "test.fdb.txt";
+    {
+        std::ofstream file{path};
+        file << "key=id:value" << std::endl;
+    }
+
+    auto& embed_fs_override    = miopen::debug::rordb_embed_fs_override();
+    const auto cached_override = embed_fs_override;
+    embed_fs_override          = true;
+
+    constexpr auto thread_count = 8;
+    auto dbs                    = std::vector<const miopen::ReadonlyRamDb*>(thread_count);
+    auto threads                = std::vector<std::thread>{};
+    for(auto i = 0; i < thread_count; ++i)
+    {
+        threads.emplace_back([&, i]() {
+            dbs[i] = &miopen::ReadonlyRamDb::GetCached(miopen::DbKinds::FindDb, path, false);
+        });
+    }
+    for(auto& thread : threads)
+        thread.join();
+    embed_fs_override = cached_override;
+
+    for(const auto* db : dbs)
+    {
+        ASSERT_EQ(db, dbs.front());
+        EXPECT_TRUE(db->FindRecord(std::string{"key"}));
+    }
+    EXPECT_EQ(
+        Count(miopen::startup::GetTimeline(), miopen::startup::Step::DbPrefetch, path.string()),
+        1);
+}
+
+TEST(GPU_StartupTimeline_FP32, WarmStartRegistersSolvers)
+{
+    miopen::startup::WarmStart(get_handle());
+    miopen::startup::WaitForWarmStart();
+
+    EXPECT_FALSE(miopen::solver::GetSolversByPrimitive(miopen::solver::Primitive::Convolution)
+                     .empty());
+}
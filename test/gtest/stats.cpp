@@ -0,0 +1,98 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/stats.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+TEST(CPU_Stats_NONE, CountersAreAggregatedAcrossThreads)
+{
+    using miopen::stats::Counter;
+
+    miopen::stats::Reset();
+    miopen::stats::Increment(Counter::FindDbHit);
+    std::thread([]() {
+        miopen::stats::Increment(Counter::FindDbHit, 2);
+        miopen::stats::Increment(Counter::InvokerCacheMiss);
+    }).join();
+
+    auto snapshot = miopen::stats::Collect();
+    ASSERT_EQ(snapshot.Get(Counter::FindDbHit), 3u);
+    ASSERT_EQ(snapshot.Get(Counter::InvokerCacheMiss), 1u);
+    ASSERT_EQ(snapshot.Get(Counter::PerfDbMiss), 0u);
+
+    miopen::stats::Reset();
+    miopen::stats::Increment(Counter::FindDbHit);
+    snapshot = miopen::stats::Collect();
+    ASSERT_EQ(snapshot.Get(Counter::FindDbHit), 1u);
+    ASSERT_EQ(snapshot.Get(Counter::InvokerCacheMiss), 0u);
+}
+
+TEST(CPU_Stats_NONE, Histograms)
+{
+    using miopen::stats::Histogram;
+
+    miopen::stats::Reset();
+    for(std::uint64_t value : {0, 1, 3, 100, 1000})
+        miopen::stats::Record(Histogram::Compile, value);
+
+    const auto snapshot = miopen::stats::Collect();
+    const auto& data    = snapshot.Get(Histogram::Compile);
+    ASSERT_EQ(data.count, 5u);
+    ASSERT_EQ(data.sum, 1104u);
+    ASSERT_EQ(data.buckets[0], 1u);
+    ASSERT_EQ(data.buckets[2], 1u);
+    ASSERT_EQ(data.Percentile(0), 0u);
+    ASSERT_EQ(data.Percentile(50), 3u);
+    ASSERT_EQ(data.Percentile(100), 1023u);
+    ASSERT_EQ(snapshot.Get(Histogram::FindDbLookup).count, 0u);
+
+    std::ostringstream ss;
+    ss << snapshot;
+    ASSERT_NE(ss.str().find("Compile: count 5, total 1.104 ms"), std::string::npos);
+}
+
+TEST(CPU_Stats_NONE, ExitedThreadsAreRetired)
+{
+    using miopen::stats::Counter;
+
+    miopen::stats::Reset();
+    miopen::stats::Increment(Counter::FindDbHit);
+    const auto registered = miopen::stats::GetNumThreads();
+
+    std::vector<std::thread> threads;
+    for(int i = 0; i < 8; ++i)
+        threads.emplace_back([]() { miopen::stats::Increment(Counter::FindDbHit); });
+    for(auto& thread : threads)
+        thread.join();
+
+    // counters of exited threads are kept, their registrations are not
+    ASSERT_EQ(miopen::stats::GetNumThreads(), registered);
+    ASSERT_EQ(miopen::stats::Collect().Get(Counter::FindDbHit), 9u);
+}
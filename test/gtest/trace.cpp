@@ -0,0 +1,158 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/trace.hpp>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <thread>
+#include <tuple>
+
+namespace {
+
+std::vector<miopen::trace::ThreadRecord> DrainAll()
+{
+    std::vector<miopen::trace::ThreadRecord> records;
+    std::ignore = miopen::trace::Drain(records);
+    return records;
+}
+
+class TraceEnabled
+{
+public:
+    TraceEnabled() : was_enabled(miopen::trace::IsEnabled())
+    {
+        miopen::trace::Enable(true);
+        std::ignore = DrainAll();
+    }
+    ~TraceEnabled() { miopen::trace::Enable(was_enabled); }
+
+private:
+    bool was_enabled;
+};
+
+} // namespace
+
+TEST(CPU_TraceRingBuffer_NONE, PushPop)
+{
+    miopen::trace::RingBuffer<int, 4> buffer;
+    for(int i = 0; i < 4; ++i)
+        ASSERT_TRUE(buffer.TryPush(i));
+    ASSERT_FALSE(buffer.TryPush(4));
+    ASSERT_EQ(buffer.Size(), 4u);
+
+    int item = -1;
+    ASSERT_TRUE(buffer.TryPop(item));
+    ASSERT_EQ(item, 0);
+    ASSERT_TRUE(buffer.TryPush(4));
+
+    for(int i = 1; i <= 4; ++i)
+    {
+        ASSERT_TRUE(buffer.TryPop(item));
+        ASSERT_EQ(item, i);
+    }
+    ASSERT_FALSE(buffer.TryPop(item));
+}
+
+TEST(CPU_Trace_NONE, ScopesAndEvents)
+{
+    const TraceEnabled enabled;
+    {
+        MIOPEN_TRACE_SCOPE(Coarse, Compile, miopen::trace::Intern("program.cpp"), 1);
+        MIOPEN_TRACE_EVENT(Detail, PerfDbMiss, "Solver", 2);
+    }
+    std::thread([]() { MIOPEN_TRACE_EVENT(Detail, FindDbHit, "FindDb", 3); }).join();
+
+    const auto records = DrainAll();
+    ASSERT_EQ(records.size(), 4u);
+    ASSERT_EQ(records[0].record.phase, miopen::trace::Phase::Begin);
+    ASSERT_STREQ(records[0].record.name, "program.cpp");
+    ASSERT_EQ(records[1].record.event, miopen::trace::Event::PerfDbMiss);
+    ASSERT_EQ(records[1].record.arg, 2u);
+    ASSERT_EQ(records[2].record.phase, miopen::trace::Phase::End);
+    ASSERT_LE(records[0].record.timestamp, records[2].record.timestamp);
+    ASSERT_EQ(records[3].record.event, miopen::trace::Event::FindDbHit);
+    ASSERT_NE(records[3].tid, records[0].tid);
+
+    std::ostringstream ss;
+    ss << '[';
+    miopen::trace::WriteChromeTrace(ss, records);
+    ss << ']';
+    const auto json = nlohmann::json::parse(ss.str());
+    ASSERT_EQ(json.size(), 4u);
+    ASSERT_EQ(json[0]["ph"], "B");
+    ASSERT_EQ(json[0]["cat"], "Compile");
+    ASSERT_EQ(json[1]["s"], "t");
+    ASSERT_EQ(json[3]["name"], "FindDb");
+}
+
+TEST(CPU_Trace_NONE, DisabledAndOverflow)
+{
+    {
+        const TraceEnabled enabled;
+        miopen::trace::Enable(false);
+        MIOPEN_TRACE_EVENT(Coarse, KernelLaunch, "Kernel", 0);
+        ASSERT_TRUE(DrainAll().empty());
+    }
+
+    const TraceEnabled enabled;
+    constexpr std::size_t count = 10000;
+    for(std::size_t i = 0; i < count; ++i)
+        MIOPEN_TRACE_EVENT(Coarse, KernelLaunch, "Kernel", i);
+
+    std::vector<miopen::trace::ThreadRecord> records;
+    const auto dropped = miopen::trace::Drain(records);
+    ASSERT_FALSE(records.empty());
+    ASSERT_EQ(records.size() + dropped, count);
+    ASSERT_TRUE(std::is_sorted(records.begin(), records.end(), [](auto& l, auto& r) {
+        return l.record.arg < r.record.arg;
+    }));
+}
+
+TEST(CPU_Trace_NONE, ExitedThreadsReleaseBuffers)
+{
+    const TraceEnabled enabled;
+    const auto registered = miopen::trace::GetNumThreadBuffers();
+
+    std::vector<std::thread> threads;
+    for(int i = 0; i < 4; ++i)
+        threads.emplace_back([i]() { MIOPEN_TRACE_EVENT(Coarse, KernelLaunch, "Kernel", i); });
+    for(auto& thread : threads)
+        thread.join();
+
+    // events of exited threads are still delivered, then their buffers are released
+    ASSERT_EQ(DrainAll().size(), 4u);
+    ASSERT_EQ(miopen::trace::GetNumThreadBuffers(), registered);
+
+    // a thread exiting with an empty buffer releases it at once
+    std::thread([]() {
+        MIOPEN_TRACE_EVENT(Coarse, KernelLaunch, "Kernel", 0);
+        std::ignore = DrainAll();
+    }).join();
+    ASSERT_EQ(miopen::trace::GetNumThreadBuffers(), registered);
+}
@@ -60,7 +60,7 @@ protected:
         const auto& [lens, offset] = GetParam();
         ASSERT_GE(superTensor.desc.GetNumDims(), lens.size());
 
-        const std::vector<size_t>& superStrides = superTensor.desc.GetStrides();
+        const auto& superStrides = superTensor.desc.GetStrides();
         std::vector<size_t> strides(superStrides.begin() +
                                         (superTensor.desc.GetNumDims() - lens.size()),
                                     superStrides.end());
@@ -26,6 +26,7 @@
 
 #include <gtest/gtest.h>
 #include <miopen/logger.hpp>
+#include <miopen/tensor_layout.hpp>
 
 #include "unit_TensorDescriptor.hpp"
 
@@ -424,6 +425,7 @@ public:
         const auto p  = GetParam();
         const auto td = p.tp.GetTensorDescriptor();
         ASSERT_EQ(td.GetLayout_str(), p.actual_layout);
+        ASSERT_EQ(td.GetLayoutCode(), miopen::TensorLayoutCode{p.actual_layout});
     }
 };
 
@@ -663,3 +665,16 @@ INSTANTIATE_TEST_SUITE_P(Full,
 INSTANTIATE_TEST_SUITE_P(Full,
                          CPU_TensorTestCheckDimsFitIntoInt_NONE,
                          testing::ValuesIn(TestCheckDimsFitIntoInt::GetTestCases()));
+
+TEST(CPU_TensorTestMaxDims_NONE, TensorDescriptor)
+{
+    const auto max_dims = std::vector<std::size_t>(miopen::tensor_max_dims, 2);
+    const auto desc     = miopen::TensorDescriptor{miopenFloat, max_dims};
+    EXPECT_EQ(desc.GetLengths(), max_dims);
+
+    const auto copy = desc;
+    EXPECT_EQ(copy, desc);
+
+    const auto too_many_dims = std::vector<std::size_t>(miopen::tensor_max_dims + 1, 2);
+    EXPECT_ANY_THROW((miopen::TensorDescriptor{miopenFloat, too_many_dims}));
+}
@@ -27,6 +27,8 @@
 #include <gtest/gtest.h>
 #include <miopen/conv/problem_description.hpp>
 
+#include <sstream>
+
 #include "unit_TensorDescriptor.hpp"
 #include "unit_conv_ConvolutionDescriptor.hpp"
 
@@ -244,6 +246,9 @@ public:
         ASSERT_EQ(pd.GetInLayout(), p.layout_in);
         ASSERT_EQ(pd.GetWeightsLayout(), p.layout_weights);
         ASSERT_EQ(pd.GetOutLayout(), p.layout_out);
+        ASSERT_EQ(pd.GetInLayoutCode(), miopen::TensorLayoutCode{p.layout_in});
+        ASSERT_EQ(pd.GetWeightsLayoutCode(), miopen::TensorLayoutCode{p.layout_weights});
+        ASSERT_EQ(pd.GetOutLayoutCode(), miopen::TensorLayoutCode{p.layout_out});
     }
 };
 
@@ -256,3 +261,22 @@ TEST_P(CPU_ConvProblemDescriptionTestLayoutCalc_NONE, ConvProblemDescription) {
 INSTANTIATE_TEST_SUITE_P(Full,
                          CPU_ConvProblemDescriptionTestLayoutCalc_NONE,
                          testing::ValuesIn(TestLayoutCalc::GetTestCases()));
+
+TEST(CPU_TensorLayoutCode_NONE, ConvProblemDescription)
+{
+    for(const std::string layout :
+        {"NCHW", "NHWC", "CHWN", "NCDHW", "NDHWC", "NCHWc", "CHWNc", "NWHC", "UNKNOWN"})
+    {
+        const auto code = miopen::TensorLayoutCode{layout};
+        EXPECT_EQ(code.ToString(), layout);
+        std::ostringstream ss;
+        ss << code;
+        EXPECT_EQ(ss.str(), layout);
+    }
+
+    static_assert(miopen::tensor_layout::NCHW != miopen::tensor_layout::NHWC);
+    static_assert(miopen::tensor_layout::NCHWc != miopen::tensor_layout::NCHW);
+    static_assert(miopen::tensor_layout::NCDHW.GetNumDims() == 5);
+    static_assert(miopen::TensorLayoutCode{}.IsUnknown());
+    EXPECT_ANY_THROW(miopen::TensorLayoutCode{"NCHWX"});
+}
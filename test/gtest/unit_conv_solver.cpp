@@ -35,6 +35,7 @@
 #include "conv_tensor_gen.hpp"
 #include "tensor_holder.hpp"
 
+#include "../verification_cache.hpp"
 #include "../workspace.hpp"
 
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_ENABLE_DEPRECATED_SOLVERS)
@@ -320,6 +321,20 @@ void VerifyData(const std::vector<T>& data,
 //**********************************
 // Fwd
 //**********************************
+template <typename Tin, typename Twei, typename Tout, typename Tref>
+verification_cache::Key MakeCpuRefKey(const std::string& primitive,
+                                      const miopen::TensorDescriptor& x,
+                                      const miopen::TensorDescriptor& w,
+                                      const miopen::TensorDescriptor& y,
+                                      const miopen::ConvolutionDescriptor& conv)
+{
+    std::ostringstream ss;
+    ss << x << w << y << conv;
+    ss << miopen::type_name<Tin>() << ',' << miopen::type_name<Twei>() << ','
+       << miopen::type_name<Tout>();
+    return verification_cache::Key::Make<Tref>(primitive, ss.str());
+}
+
 template <typename Tin, typename Twei, typename Tout, typename Tref>
 void RunSolverFwd(const miopen::solver::conv::ConvSolverInterface& solv,
                   const UnitTestConvSolverParams& params,
@@ -401,14 +416,23 @@ void RunSolverFwd(const miopen::solver::conv::ConvSolverInterface& solv,
     auto ref_out = tensor<Tref>{output.desc};
     if(params.use_cpu_ref)
     {
-        cpu_convolution_forward(conv_desc.GetSpatialDimension(),
-                                input,
-                                weights,
-                                ref_out,
-                                conv_desc.GetConvPads(),
-                                conv_desc.GetConvStrides(),
-                                conv_desc.GetConvDilations(),
-                                conv_desc.GetGroupCount());
+        verification_cache::LoadOrCompute(
+            verification_cache::Store::FromEnv(),
+            MakeCpuRefKey<Tin, Twei, Tout, Tref>(
+                "conv_fwd", input.desc, weights.desc, output.desc, conv_desc)
+                .AddInput(input.data)
+                .AddInput(weights.data),
+            ref_out.data,
+            [&]() {
+                cpu_convolution_forward(conv_desc.GetSpatialDimension(),
+                                        input,
+                                        weights,
+                                        ref_out,
+                                        conv_desc.GetConvPads(),
+                                        conv_desc.GetConvStrides(),
+                                        conv_desc.GetConvDilations(),
+                                        conv_desc.GetGroupCount());
+            });
     }
     else
     {
@@ -513,14 +537,23 @@ void RunSolverBwd(const miopen::solver::conv::ConvSolverInterface& solv,
     auto ref_in = tensor<Tref>{input.desc};
     if(params.use_cpu_ref)
     {
-        cpu_convolution_backward_data(conv_desc.GetSpatialDimension(),
-                                      ref_in,
-                                      weights,
-                                      output,
-                                      conv_desc.GetConvPads(),
-                                      conv_desc.GetConvStrides(),
-                                      conv_desc.GetConvDilations(),
-                                      conv_desc.GetGroupCount());
+        verification_cache::LoadOrCompute(
+            verification_cache::Store::FromEnv(),
+            MakeCpuRefKey<Tin, Twei, Tout, Tref>(
+                "conv_bwd", input.desc, weights.desc, output.desc, conv_desc)
+                .AddInput(output.data)
+                .AddInput(weights.data),
+            ref_in.data,
+            [&]() {
+                cpu_convolution_backward_data(conv_desc.GetSpatialDimension(),
+                                              ref_in,
+                                              weights,
+                                              output,
+                                              conv_desc.GetConvPads(),
+                                              conv_desc.GetConvStrides(),
+                                              conv_desc.GetConvDilations(),
+                                              conv_desc.GetGroupCount());
+            });
     }
     else
     {
@@ -625,14 +658,23 @@ void RunSolverWrw(const miopen::solver::conv::ConvSolverInterface& solv,
     auto ref_weights = tensor<Tref>{weights.desc};
     if(params.use_cpu_ref)
     {
-        cpu_convolution_backward_weight(conv_desc.GetSpatialDimension(),
-                                        input,
-                                        ref_weights,
-                                        output,
-                                        conv_desc.GetConvPads(),
-                                        conv_desc.GetConvStrides(),
-                                        conv_desc.GetConvDilations(),
-                                        conv_desc.GetGroupCount());
+        verification_cache::LoadOrCompute(
+            verification_cache::Store::FromEnv(),
+            MakeCpuRefKey<Tin, Twei, Tout, Tref>(
+                "conv_wrw", input.desc, weights.desc, output.desc, conv_desc)
+                .AddInput(input.data)
+                .AddInput(output.data),
+            ref_weights.data,
+            [&]() {
+                cpu_convolution_backward_weight(conv_desc.GetSpatialDimension(),
+                                                input,
+                                                ref_weights,
+                                                output,
+                                                conv_desc.GetConvPads(),
+                                                conv_desc.GetConvStrides(),
+                                                conv_desc.GetConvDilations(),
+                                                conv_desc.GetGroupCount());
+            });
     }
     else
     {
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+#include "../verification_cache.hpp"
+
+TEST(CPU_VerificationCacheRoundTrip_NONE, Test)
+{
+    const miopen::TmpDir dir{"verification_cache"};
+    const auto store = verification_cache::Store{dir.path};
+    const auto key   = verification_cache::Key::Make<float>("conv_fwd", "1x2x3x4");
+
+    // Small enough to be compressed.
+    std::vector<float> small(1024);
+    std::iota(small.begin(), small.end(), 0.0f);
+    store.Save(key, small.data(), small.size());
+
+    std::vector<float> loaded(small.size());
+    ASSERT_TRUE(store.Load(key, loaded.data(), loaded.size()));
+    EXPECT_EQ(small, loaded);
+
+    // Element count mismatch must not be read back.
+    std::vector<float> wrong(small.size() + 1);
+    EXPECT_FALSE(store.Load(key, wrong.data(), wrong.size()));
+}
+
+TEST(CPU_VerificationCacheKey_NONE, Test)
+{
+    const miopen::TmpDir dir{"verification_cache"};
+    const auto store = verification_cache::Store{dir.path};
+
+    const auto input   = std::vector<float>{1.0f, 2.0f, 3.0f};
+    auto other_input   = input;
+    other_input.back() = 4.0f;
+
+    using verification_cache::Key;
+    const auto key       = Key::Make<float>("conv_fwd", "1x2x3x4").AddInput(input);
+    const auto input_key = Key::Make<float>("conv_fwd", "1x2x3x4").AddInput(other_input);
+    const auto type_key  = Key::Make<double>("conv_fwd", "1x2x3x4").AddInput(input);
+    auto version_key     = key;
+    version_key.version += 1;
+
+    // Equal problems, different data: the inputs themselves tell the entries apart.
+    EXPECT_NE(key.Digest(), input_key.Digest());
+    EXPECT_NE(key.Digest(), type_key.Digest());
+    EXPECT_NE(key.Digest(), version_key.Digest());
+
+    std::vector<float> data(16, 1.0f);
+    store.Save(key, data.data(), data.size());
+    EXPECT_FALSE(store.Load(input_key, data.data(), data.size()));
+    EXPECT_FALSE(store.Load(version_key, data.data(), data.size()));
+
+    auto calls = 0;
+    std::vector<float> out(data.size());
+    EXPECT_TRUE(verification_cache::LoadOrCompute(store, key, out, [&]() { ++calls; }));
+    EXPECT_FALSE(verification_cache::LoadOrCompute(store, input_key, out, [&]() { ++calls; }));
+    EXPECT_EQ(calls, 1);
+    EXPECT_TRUE(verification_cache::LoadOrCompute(store, input_key, out, [&]() { ++calls; }));
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(CPU_VerificationCacheDisabled_NONE, Test)
+{
+    const auto store = verification_cache::Store{};
+    const auto key   = verification_cache::Key::Make<float>("conv_fwd", "1x2x3x4");
+
+    std::vector<float> data(16, 1.0f);
+    EXPECT_FALSE(store.Enabled());
+    store.Save(key, data.data(), data.size());
+    EXPECT_FALSE(store.Load(key, data.data(), data.size()));
+}
@@ -708,7 +708,7 @@ struct cpu_rnn_universal_ref : rnn_ref<T>
                                           x_tensor_converted.data);
             ///////////////////////////////////////////////////////////////
 
-            auto& hid = hiddenDesc.GetLengths();
+            const std::vector<size_t> hid(hiddenDesc.GetLengths());
 
             std::vector<T> hxData_converted{};
             if(!nohx)
@@ -819,7 +819,7 @@ struct cpu_rnn_universal_ref : rnn_ref<T>
                                           dyData,
                                           dy_tensor_converted.data);
             ///////////////////////////////////////////////////////////////
-            auto& hid = hiddenDesc.GetLengths();
+            const std::vector<size_t> hid(hiddenDesc.GetLengths());
 
             std::vector<T> dhyData_converted{};
             if(!nodhy)
@@ -933,7 +933,7 @@ struct cpu_rnn_universal_ref : rnn_ref<T>
                                           dyData,
                                           dy_tensor_converted.data);
             ///////////////////////////////////////////////////////////////
-            auto& hid = hiddenDesc.GetLengths();
+            const std::vector<size_t> hid(hiddenDesc.GetLengths());
 
             std::vector<T> hxData_converted{};
             if(!nohx)
@@ -165,6 +165,25 @@ struct tensor
     {
     }
 
+    tensor(const miopen::TensorDims& dims) : tensor(std::vector<std::size_t>(dims)) {}
+
+    tensor(const miopen::TensorDims& dims, const miopen::TensorDims& strides)
+        : tensor(std::vector<std::size_t>(dims), std::vector<std::size_t>(strides))
+    {
+    }
+
+    tensor(miopenTensorLayout_t layout, const miopen::TensorDims& dims)
+        : tensor(layout, std::vector<std::size_t>(dims))
+    {
+    }
+
+    tensor(miopenTensorLayout_t layout,
+           const miopen::TensorDims& dims,
+           const miopen::TensorDims& strides)
+        : tensor(layout, std::vector<std::size_t>(dims), std::vector<std::size_t>(strides))
+    {
+    }
+
     template <class X>
     tensor(const std::vector<X>& dims, const std::vector<X>& strides)
         : desc(miopen_type<T>{}, dims, strides), data(desc.GetElementSpace())
@@ -220,25 +239,18 @@ struct tensor
     template <class G>
     tensor& generate(G g) &
     {
-        if(this->desc.GetVectorLength() > 1)
-            this->generate_vect_impl(g);
-        else
-            this->generate_impl(g);
+        this->generate_impl(std::move(g));
         return *this;
     }
 
     template <class G>
     tensor&& generate(G g) &&
     {
-        if(this->desc.GetVectorLength() > 1)
-            this->generate_vect_impl(g);
-        else
-            this->generate_impl(g);
+        this->generate_impl(std::move(g));
         return std::move(*this);
     }
 
-    template <class G>
-    void generate_impl(G g)
+    std::size_t generate_seed() const
     {
         auto seed = std::accumulate(desc.GetLengths().begin(),
                                     desc.GetLengths().end(),
@@ -249,44 +261,62 @@ struct tensor
                                     });
         seed ^= data.size();
         seed ^= desc.GetLengths().size();
-        prng::reset_seed(seed);
-        auto iterator = data.begin();
-        auto assign   = [&](T x) {
-            *iterator = x;
-            ++iterator;
-        };
-        this->for_each(
-            miopen::compose(miopen::compose(assign, miopen::cast_to<T>()), std::move(g)));
+        return seed;
     }
 
+    /// Calls `g` for the elements in parallel, see prng::par_for_blocks(). Whatever `g` draws from
+    /// the prng depends only on generate_seed() and the element, so the data does not depend on
+    /// the thread count.
     template <class G>
-    void generate_vect_impl(G g)
+    void generate_impl(G g)
     {
-        auto seed = std::accumulate(desc.GetLengths().begin(),
-                                    desc.GetLengths().end(),
-                                    std::size_t{521288629},
-                                    [](auto x, auto y) {
-                                        x ^= x << 1U;
-                                        return x ^ y;
-                                    });
-        seed ^= data.size();
-        seed ^= desc.GetLengths().size();
-        prng::reset_seed(seed);
-        auto iterator     = data.begin();
-        auto vectorLength = desc.GetVectorLength();
-        auto assign       = [&](T x) {
-            assert(iterator < data.end());
-            // for debugging
-            for(auto i = 0; i < vectorLength; i++)
-            {
-                *(iterator + i) = x;
-            }
-            iterator += vectorLength;
+        const auto vector_length = desc.GetVectorLength();
+        auto assign              = [&](std::size_t i, T x) {
+            assert((i + 1) * vector_length <= data.size());
+            std::fill_n(data.begin() + i * vector_length, vector_length, x);
         };
-        this->for_each(
-            miopen::compose(miopen::compose(assign, miopen::cast_to<T>()), std::move(g)));
+        visit_tensor_size(desc.GetLengths().size(), [&](auto size) {
+            auto dims = miopen::tien<size>(desc.GetLengths());
+            using loop_type = prng_ford<decltype(assign)>;
+            miopen::unpack(
+                for_each_unpacked<loop_type, G>{loop_type{generate_seed(), assign}, std::move(g)},
+                dims);
+        });
     }
 
+    /// Loops over the element indexes like par_ford, but in the blocks of prng::par_for_blocks(),
+    /// and stores each result of the element function with `assign`.
+    template <class Assign>
+    struct prng_ford
+    {
+        std::size_t stream;
+        Assign assign;
+
+        template <class... Ts>
+        auto operator()(Ts... xs) const
+        {
+            return [=](auto f) {
+                using array_type = std::array<std::size_t, sizeof...(Ts)>;
+                const array_type lens = {{static_cast<std::size_t>(xs)...}};
+                const auto size       = std::accumulate(
+                    lens.begin(), lens.end(), std::size_t{1}, std::multiplies<std::size_t>());
+                prng::par_for_blocks(size, stream, [&](std::size_t first, std::size_t last) {
+                    for(auto i = first; i < last; ++i)
+                    {
+                        array_type indices;
+                        auto rest = i;
+                        for(auto d = lens.size(); d > 0; --d)
+                        {
+                            indices[d - 1] = rest % lens[d - 1];
+                            rest /= lens[d - 1];
+                        }
+                        assign(i, miopen::cast_to<T>{}(miopen::unpack(f, indices)));
+                    }
+                });
+            };
+        }
+    };
+
     template <class Loop, class F>
     struct for_each_unpacked
     {
@@ -403,8 +433,8 @@ void serialize(std::istream& s, tensor<T>& x)
 template <class T>
 void serialize(std::ostream& s, const tensor<T>& x)
 {
-    const auto& lens    = x.desc.GetLengths();
-    const auto& strides = x.desc.GetStrides();
+    const std::vector<std::size_t> lens(x.desc.GetLengths());
+    const std::vector<std::size_t> strides(x.desc.GetStrides());
     serialize(s, lens);
     serialize(s, strides);
     serialize(s, x.data);
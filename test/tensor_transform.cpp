@@ -55,7 +55,7 @@ static void show_tensor(const tensor<T>& ten)
     int height     = 1;
     int width      = 1;
     // get the underlying array
-    std::vector<size_t> lens = ten.desc.GetLengths();
+    std::vector<size_t> lens(ten.desc.GetLengths());
     int dim                  = ten.desc.GetLengths().size();
 
     switch(dim)
@@ -397,8 +397,8 @@ struct tensor_transform_driver : test_driver
         printf("\n DST: \n");
         show_tensor(super_dst);
 #endif
-        std::vector<size_t> superStrides_src = super_src.desc.GetStrides();
-        std::vector<size_t> superStrides_dst = super_dst.desc.GetStrides();
+        std::vector<size_t> superStrides_src(super_src.desc.GetStrides());
+        std::vector<size_t> superStrides_dst(super_dst.desc.GetStrides());
         std::vector<int> subStrides_src(superStrides_src.begin() +
                                             (super_src.desc.GetNumDims() - subLens.size()),
                                         superStrides_src.end());
@@ -194,7 +194,7 @@ struct verify_tensor_vec_forward
         auto dst_dev  = handle.Write(r.data);
         int vec_size  = 4 / sizeof(T);
         miopen::transpose_NCHW2Vec(handle,
-                                   src.desc.GetLengths(),
+                                   std::vector<std::size_t>(src.desc.GetLengths()),
                                    src_dev.get(),
                                    dst_dev.get(),
                                    vec_size,
@@ -252,7 +252,7 @@ struct verify_tensor_vec_backward
         auto dst_dev  = handle.Write(r.data);
         int vec_size  = 4 / sizeof(T);
         miopen::transpose_NCHW2Vec(handle,
-                                   dst.desc.GetLengths(),
+                                   std::vector<std::size_t>(dst.desc.GetLengths()),
                                    src_dev.get(),
                                    dst_dev.get(),
                                    vec_size,
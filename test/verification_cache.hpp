@@ -0,0 +1,247 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_TEST_VERIFICATION_CACHE_HPP
+#define GUARD_MIOPEN_TEST_VERIFICATION_CACHE_HPP
+
+#include <miopen/bz2.hpp>
+#include <miopen/env.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/md5.hpp>
+#include <miopen/type_name.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <random>
+#include <string>
+#include <vector>
+
+/// Directory of the golden output store used by the gtest host references.
+/// MIOpenDriver takes the directory from the '--verification_cache' option instead.
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_VERIFICATION_CACHE_PATH)
+
+/// Golden output store shared by MIOpenDriver verifiers and gtest host references.
+///
+/// Entries are content-addressed: the file name is a digest of the primitive, the problem
+/// descriptor, the contents of the host input buffers and the version of the host
+/// reference. Changing any of them simply misses the cache, so stale outputs are never
+/// read back. Small outputs are bz2-compressed; large ones are stored raw.
+///
+/// Only the references which dominate verification time use the store: the convolution
+/// driver and gtests, and the softmax driver forward pass. The other drivers and gtest
+/// references are cheap next to hashing their inputs, and the RNN drivers keep their own
+/// '--verification_cache' files.
+namespace verification_cache {
+
+/// Bump this when host references change their results, to invalidate existing stores.
+constexpr std::uint32_t reference_version = 3;
+
+struct Key
+{
+    std::string primitive;
+    std::string problem;
+    /// Digests of the host buffers the reference reads, in the order they were added.
+    std::string inputs = {};
+    std::uint32_t version = reference_version;
+
+    template <class T>
+    Key& AddInput(const T* data, std::size_t count)
+    {
+        inputs += miopen::md5(data, count * sizeof(T));
+        inputs += ',';
+        return *this;
+    }
+
+    template <class T>
+    Key& AddInput(const std::vector<T>& data)
+    {
+        return AddInput(data.data(), data.size());
+    }
+
+    std::string Digest() const
+    {
+        std::ostringstream ss;
+        ss << primitive << '\n' << problem << '\n' << inputs << '\n' << version;
+        return miopen::md5(ss.str());
+    }
+
+    template <class Tref>
+    static Key Make(std::string primitive, std::string problem)
+    {
+        problem += "_REF";
+        problem += miopen::type_name<Tref>();
+        return {std::move(primitive), std::move(problem)};
+    }
+};
+
+namespace detail {
+
+constexpr char magic[8]                 = {'M', 'I', 'O', 'V', 'C', 'A', 'C', 'H'};
+constexpr std::uint32_t format_version  = 2;
+constexpr std::size_t max_compress_size = std::size_t{64} << 20;
+
+struct Header
+{
+    char magic[8];
+    std::uint32_t format;
+    std::uint32_t elem_size;
+    std::uint64_t elem_count;
+    std::uint64_t payload_size;
+    std::uint32_t compressed;
+    std::uint32_t reserved;
+};
+
+inline bool ReadPayload(std::ifstream& file, char* dst, std::size_t size)
+{
+    file.read(dst, static_cast<std::streamsize>(size));
+    return static_cast<std::size_t>(file.gcount()) == size;
+}
+
+} // namespace detail
+
+class Store
+{
+public:
+    Store() = default;
+    explicit Store(miopen::fs::path dir_) : dir(std::move(dir_)) {}
+
+    /// Store located at MIOPEN_VERIFICATION_CACHE_PATH, disabled if it is not set.
+    static Store FromEnv() { return Store{miopen::env::value(MIOPEN_VERIFICATION_CACHE_PATH)}; }
+
+    bool Enabled() const { return !dir.empty(); }
+
+    miopen::fs::path GetPath(const Key& key) const { return dir / (key.Digest() + ".vcache"); }
+
+    template <class T>
+    bool Load(const Key& key, T* data, std::size_t count) const
+    {
+        if(!Enabled() || data == nullptr)
+            return false;
+
+        const auto path = GetPath(key);
+        std::ifstream file(path, std::ios::binary);
+        if(!file)
+            return false;
+
+        detail::Header header{};
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if(!file || std::memcmp(header.magic, detail::magic, sizeof(detail::magic)) != 0 ||
+           header.format != detail::format_version || header.elem_size != sizeof(T) ||
+           header.elem_count != count)
+            return false;
+
+        const auto size = count * sizeof(T);
+
+        if(header.compressed == 0)
+        {
+            if(header.payload_size != size)
+                return false;
+            return detail::ReadPayload(file, reinterpret_cast<char*>(data), size);
+        }
+
+        std::vector<char> packed(header.payload_size);
+        if(!detail::ReadPayload(file, packed.data(), packed.size()))
+            return false;
+        const auto unpacked = miopen::decompress(packed, static_cast<unsigned int>(size));
+        if(unpacked.size() != size)
+            return false;
+        std::memcpy(data, unpacked.data(), size);
+        return true;
+    }
+
+    /// Writes into a temporary file which is then renamed, so concurrent test processes
+    /// sharing the store never observe partially written entries.
+    template <class T>
+    void Save(const Key& key, const T* data, std::size_t count) const
+    {
+        if(!Enabled() || data == nullptr)
+            return;
+
+        const auto size = count * sizeof(T);
+        const auto* raw = reinterpret_cast<const char*>(data);
+
+        detail::Header header{};
+        std::memcpy(header.magic, detail::magic, sizeof(detail::magic));
+        header.format     = detail::format_version;
+        header.elem_size  = sizeof(T);
+        header.elem_count = count;
+
+        std::vector<char> packed;
+        bool compressed = false;
+        if(size <= detail::max_compress_size)
+            packed = miopen::compress(std::vector<char>(raw, raw + size), &compressed);
+
+        header.compressed   = compressed ? 1 : 0;
+        header.payload_size = compressed ? packed.size() : size;
+
+        std::error_code ec;
+        miopen::fs::create_directories(dir, ec);
+
+        const auto path = GetPath(key);
+        auto tmp        = path;
+        tmp += ".tmp" + std::to_string(std::random_device{}());
+
+        {
+            std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+            if(!file)
+                return;
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            if(compressed)
+                file.write(packed.data(), static_cast<std::streamsize>(packed.size()));
+            else
+                file.write(raw, static_cast<std::streamsize>(size));
+            if(!file)
+            {
+                file.close();
+                miopen::fs::remove(tmp, ec);
+                return;
+            }
+        }
+        miopen::fs::rename(tmp, path, ec);
+        if(ec)
+            miopen::fs::remove(tmp, ec);
+    }
+
+private:
+    miopen::fs::path dir;
+};
+
+/// Fills `data` from the store, or runs `compute` to fill it and records the result.
+/// Returns true on a cache hit.
+template <class T, class F>
+bool LoadOrCompute(const Store& store, const Key& key, std::vector<T>& data, F compute)
+{
+    if(store.Load(key, data.data(), data.size()))
+        return true;
+    compute();
+    store.Save(key, data.data(), data.size());
+    return false;
+}
+
+} // namespace verification_cache
+
+#endif // GUARD_MIOPEN_TEST_VERIFICATION_CACHE_HPP